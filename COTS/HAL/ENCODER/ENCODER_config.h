@@ -0,0 +1,38 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  ENCODER_config.h
+ *       Module:  ENCODER Module
+ *  Description:  Configuration header file for quadrature encoder decoder
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _ENCODER_CONFIG_H
+#define _ENCODER_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*number of encoders (max 4)*/
+#define ENCODER_NUM                 2
+
+/*{port , channel A pin , channel B pin} of every encoder, encoder number is the index in this list.
+  A and B of one encoder must be on the same port (both read from one IDR access) and
+  no two pins in the list may share a pin number (one EXTI line per pin number)*/
+#define ENCODER_CHANNELS            { {_GPIOA_PORT, pin0, pin1}, \
+                                      {_GPIOB_PORT, pin6, pin7} }
+
+/*input mode of the channel pins
+  Options: INPUT_FLOATING , INPUT_PULLUP_PULLDOWN (pull-up selected)*/
+#define ENCODER_PIN_MODE            INPUT_FLOATING
+
+/*SysTick interrupt frequency set by the application, scales velocity to counts per second*/
+#define ENCODER_TICK_FREQUENCY_HZ   1000
+
+/*velocity reads 0 when no edge arrived within this number of SysTick ticks*/
+#define ENCODER_STOP_TIMEOUT_TICKS  100
+
+#endif
@@ -0,0 +1,111 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  ENCODER_interface.h
+ *       Module:  ENCODER Module
+ *  Description:  Interface header file for quadrature encoder decoder.
+ *                both channels of an encoder trigger EXTI on any change, the ISR reads A and B
+ *                from one IDR access and updates the position from a 16-entry transition table.
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _ENCODER_INTERFACE_H
+#define _ENCODER_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+
+#include "ENCODER_config.h"
+#include "ENCODER_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidInit(void)
+* \Description     : configure channel pins as inputs and route them to ANY_CHANGE EXTI lines,
+*                    EXTI IRQs of the used lines must be enabled in NVIC by the application
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : sint32 HENCODER_sint32GetPosition(uint8 Copy_uint8Encoder)
+* \Description     : position in counts (4 counts per encoder line)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number (index in ENCODER_CHANNELS)
+* \Parameters (out): None
+* \Return value:   : sint32 position
+*******************************************************************************/
+sint32 HENCODER_sint32GetPosition(uint8 Copy_uint8Encoder);
+
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidSetPosition(uint8 Copy_uint8Encoder , sint32 Copy_sint32Position)
+* \Description     : preset position (homing)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder , sint32 Copy_sint32Position
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidSetPosition(uint8 Copy_uint8Encoder , sint32 Copy_sint32Position);
+
+/******************************************************************************
+* \Syntax          : sint32 HENCODER_sint32GetVelocity(uint8 Copy_uint8Encoder)
+* \Description     : counts per second between the edge timestamps of this call and the previous call,
+*                    call periodically (e.g. every control loop)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number
+* \Parameters (out): None
+* \Return value:   : sint32 velocity in counts/s
+*******************************************************************************/
+sint32 HENCODER_sint32GetVelocity(uint8 Copy_uint8Encoder);
+
+/******************************************************************************
+* \Syntax          : uint32 HENCODER_uint32GetErrorCount(uint8 Copy_uint8Encoder)
+* \Description     : number of illegal transitions (both channels changed between two ISRs: missed edge)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number
+* \Parameters (out): None
+* \Return value:   : uint32 error count
+*******************************************************************************/
+uint32 HENCODER_uint32GetErrorCount(uint8 Copy_uint8Encoder);
+
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidClearErrors(uint8 Copy_uint8Encoder)
+* \Description     : reset illegal transition counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidClearErrors(uint8 Copy_uint8Encoder);
+
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidUpdate(uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr , uint32 Copy_uint32Tick)
+* \Description     : decode one sample of the port input register (called from the EXTI ISR,
+*                    public so recorded edge sequences can be replayed without hardware)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr : IDR value , uint32 Copy_uint32Tick : SysTick timestamp
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidUpdate(uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr , uint32 Copy_uint32Tick);
+
+#endif
@@ -0,0 +1,50 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  ENCODER_private.h
+ *       Module:  ENCODER Module
+ *  Description:  Private header file for quadrature encoder decoder
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _ENCODER_PRIVATE_H
+#define _ENCODER_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    GPIO_Num    Port;
+    GPIO_PinNum PinA;
+    GPIO_PinNum PinB;
+}ENCODER_Channels_t;
+
+/*runtime state of one encoder, written by the EXTI ISR*/
+typedef struct
+{
+    volatile GPIO_t*  Gpio;
+    volatile sint32   Position;
+    volatile uint32   ErrorCount;
+    volatile uint32   LastEdgeTick;
+    volatile uint8    State;          /*last (A<<1)|B*/
+    /*velocity bookkeeping (thread context only)*/
+    sint32            SamplePosition;
+    uint32            SampleTick;
+    sint32            Velocity;
+}ENCODER_State_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*transition table entry of a two step (both channels changed) move*/
+#define ENCODER_ILLEGAL             2
+
+#if (ENCODER_NUM < 1) || (ENCODER_NUM > 4)
+#error "ENCODER_NUM must be 1..4"
+#endif
+
+#endif
@@ -0,0 +1,281 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  ENCODER_program.c
+ *       Module:  ENCODER Module
+ *  Description:  implementaion C file for quadrature encoder decoder
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "ENCODER_interface.h"
+#include "../../MCAL/RCC/RCC_interface.h"
+#include "../../MCAL/SYSTick/SYSTick_interface.h"
+#include "../../MCAL/External_Interrupt/External_Interrupt_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static const ENCODER_Channels_t ENCODER_Channels[ENCODER_NUM] = ENCODER_CHANNELS;
+
+static ENCODER_State_t ENCODER_States[ENCODER_NUM];
+
+/*count change indexed by (previous state << 2) | new state , state = (A << 1) | B.
+  forward gray sequence 00 -> 01 -> 11 -> 10 -> 00 counts up*/
+static const sint8 ENCODER_Transition[16] =
+{
+    /*prev 00*/  0,               +1,               -1,               ENCODER_ILLEGAL,
+    /*prev 01*/ -1,                0,               ENCODER_ILLEGAL,  +1,
+    /*prev 10*/ +1,               ENCODER_ILLEGAL,   0,               -1,
+    /*prev 11*/ ENCODER_ILLEGAL,  -1,               +1,                0
+};
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*EXTI callbacks carry no line number: one entry per encoder, both of its lines share it*/
+static void HENCODER_VoidEdge0(void)
+{
+    HENCODER_VoidUpdate(0,ENCODER_States[0].Gpio->IDR,MSYSTICK_uint32GetTickCount());
+}
+#if ENCODER_NUM > 1
+static void HENCODER_VoidEdge1(void)
+{
+    HENCODER_VoidUpdate(1,ENCODER_States[1].Gpio->IDR,MSYSTICK_uint32GetTickCount());
+}
+#endif
+#if ENCODER_NUM > 2
+static void HENCODER_VoidEdge2(void)
+{
+    HENCODER_VoidUpdate(2,ENCODER_States[2].Gpio->IDR,MSYSTICK_uint32GetTickCount());
+}
+#endif
+#if ENCODER_NUM > 3
+static void HENCODER_VoidEdge3(void)
+{
+    HENCODER_VoidUpdate(3,ENCODER_States[3].Gpio->IDR,MSYSTICK_uint32GetTickCount());
+}
+#endif
+
+static void (* const ENCODER_EdgeCallback[ENCODER_NUM])(void) =
+{
+    HENCODER_VoidEdge0,
+#if ENCODER_NUM > 1
+    HENCODER_VoidEdge1,
+#endif
+#if ENCODER_NUM > 2
+    HENCODER_VoidEdge2,
+#endif
+#if ENCODER_NUM > 3
+    HENCODER_VoidEdge3,
+#endif
+};
+
+static uint8 HENCODER_uint8ReadState(uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr)
+{
+    const ENCODER_Channels_t* Local_pChannels = &ENCODER_Channels[Copy_uint8Encoder];
+    return (uint8)((((Copy_uint32Idr >> Local_pChannels->PinA) & 1U) << 1) |
+                    ((Copy_uint32Idr >> Local_pChannels->PinB) & 1U));
+}
+
+static void HENCODER_VoidInitLine(GPIO_Num Copy_Port , GPIO_PinNum Copy_Pin , void (*Copy_pCallback)(void))
+{
+    MGPIO_VoidSetPinMode_TYPE(Copy_Port,Copy_Pin,ENCODER_PIN_MODE);
+    if(ENCODER_PIN_MODE == INPUT_PULLUP_PULLDOWN)
+    {
+        GPIO_PORT_ADDRESS(Copy_Port)->BSRR = (1UL << Copy_Pin);   /*ODR=1 selects pull-up*/
+    }
+    MEXTERNAL_INTERRUPT_VoidSetPort((EXTERNAL_InterruptNumber_t)Copy_Pin,(EXTERNAL_INTERRUPT_PORTS_t)Copy_Port);
+    MEXTERNAL_INTERRUPT_VoidSetTriggerType((EXTERNAL_InterruptNumber_t)Copy_Pin,ANY_CHANGE);
+    MEXTERNAL_INTERRUPT_VoidInterruptCallback((EXTERNAL_InterruptNumber_t)Copy_Pin,Copy_pCallback);
+    MEXTERNAL_INTERRUPT_VoidEnableInterrupt((EXTERNAL_InterruptNumber_t)Copy_Pin);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidInit(void)
+* \Description     : configure channel pins as inputs and route them to ANY_CHANGE EXTI lines,
+*                    EXTI IRQs of the used lines must be enabled in NVIC by the application
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidInit(void)
+{
+    uint8 Local_uint8Encoder;
+    const ENCODER_Channels_t* Local_pChannels;
+    ENCODER_State_t* Local_pState;
+
+    /*EXTI port selection lives in AFIO*/
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_AFIO,RCC_CLIENT_ENCODER);
+    for(Local_uint8Encoder = 0; Local_uint8Encoder < ENCODER_NUM; Local_uint8Encoder++)
+    {
+        Local_pChannels = &ENCODER_Channels[Local_uint8Encoder];
+        Local_pState = &ENCODER_States[Local_uint8Encoder];
+
+        (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_IOPA + Local_pChannels->Port,RCC_CLIENT_ENCODER);
+        Local_pState->Gpio = GPIO_PORT_ADDRESS(Local_pChannels->Port);
+        Local_pState->Position = 0;
+        Local_pState->ErrorCount = 0;
+        Local_pState->LastEdgeTick = MSYSTICK_uint32GetTickCount();
+        Local_pState->SamplePosition = 0;
+        Local_pState->SampleTick = Local_pState->LastEdgeTick;
+        Local_pState->Velocity = 0;
+
+        HENCODER_VoidInitLine(Local_pChannels->Port,Local_pChannels->PinA,ENCODER_EdgeCallback[Local_uint8Encoder]);
+        HENCODER_VoidInitLine(Local_pChannels->Port,Local_pChannels->PinB,ENCODER_EdgeCallback[Local_uint8Encoder]);
+        Local_pState->State = HENCODER_uint8ReadState(Local_uint8Encoder,Local_pState->Gpio->IDR);
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidUpdate(uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr , uint32 Copy_uint32Tick)
+* \Description     : decode one sample of the port input register (called from the EXTI ISR,
+*                    public so recorded edge sequences can be replayed without hardware)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr : IDR value , uint32 Copy_uint32Tick : SysTick timestamp
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidUpdate(uint8 Copy_uint8Encoder , uint32 Copy_uint32Idr , uint32 Copy_uint32Tick)
+{
+    ENCODER_State_t* Local_pState = &ENCODER_States[Copy_uint8Encoder];
+    uint8 Local_uint8State = HENCODER_uint8ReadState(Copy_uint8Encoder,Copy_uint32Idr);
+    sint8 Local_sint8Step = ENCODER_Transition[(Local_pState->State << 2) | Local_uint8State];
+
+    /*on an illegal step resynchronise on the new state, the direction is unknown*/
+    Local_pState->State = Local_uint8State;
+    if(Local_sint8Step == ENCODER_ILLEGAL)
+    {
+        Local_pState->ErrorCount++;
+    }
+    else if(Local_sint8Step != 0)
+    {
+        Local_pState->Position += Local_sint8Step;
+        Local_pState->LastEdgeTick = Copy_uint32Tick;
+    }
+    else
+    {
+        /*glitch shorter than the ISR latency: no movement*/
+    }
+}
+
+/******************************************************************************
+* \Syntax          : sint32 HENCODER_sint32GetPosition(uint8 Copy_uint8Encoder)
+* \Description     : position in counts (4 counts per encoder line)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number (index in ENCODER_CHANNELS)
+* \Parameters (out): None
+* \Return value:   : sint32 position
+*******************************************************************************/
+sint32 HENCODER_sint32GetPosition(uint8 Copy_uint8Encoder)
+{
+    return ENCODER_States[Copy_uint8Encoder].Position;
+}
+
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidSetPosition(uint8 Copy_uint8Encoder , sint32 Copy_sint32Position)
+* \Description     : preset position (homing)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder , sint32 Copy_sint32Position
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidSetPosition(uint8 Copy_uint8Encoder , sint32 Copy_sint32Position)
+{
+    ENCODER_State_t* Local_pState = &ENCODER_States[Copy_uint8Encoder];
+    /*keep the velocity window continuous across the preset*/
+    Local_pState->SamplePosition += Copy_sint32Position - Local_pState->Position;
+    Local_pState->Position = Copy_sint32Position;
+}
+
+/******************************************************************************
+* \Syntax          : sint32 HENCODER_sint32GetVelocity(uint8 Copy_uint8Encoder)
+* \Description     : counts per second between the edge timestamps of this call and the previous call,
+*                    call periodically (e.g. every control loop)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number
+* \Parameters (out): None
+* \Return value:   : sint32 velocity in counts/s
+*******************************************************************************/
+sint32 HENCODER_sint32GetVelocity(uint8 Copy_uint8Encoder)
+{
+    ENCODER_State_t* Local_pState = &ENCODER_States[Copy_uint8Encoder];
+    sint32 Local_sint32Position;
+    uint32 Local_uint32EdgeTick;
+    uint32 Local_uint32Elapsed;
+
+    /*position and timestamp of the same edge: retry if an edge of a later tick came in between*/
+    do
+    {
+        Local_uint32EdgeTick = Local_pState->LastEdgeTick;
+        Local_sint32Position = Local_pState->Position;
+    }while(Local_uint32EdgeTick != Local_pState->LastEdgeTick);
+
+    if(Local_sint32Position != Local_pState->SamplePosition)
+    {
+        /*measure between edges, not between calls: no quantisation by the call period.
+          edges still inside the tick of the last sample are kept for a longer window*/
+        Local_uint32Elapsed = Local_uint32EdgeTick - Local_pState->SampleTick;
+        if(Local_uint32Elapsed != 0)
+        {
+            Local_pState->Velocity = ((Local_sint32Position - Local_pState->SamplePosition) * ENCODER_TICK_FREQUENCY_HZ)
+                                     / (sint32)Local_uint32Elapsed;
+            Local_pState->SamplePosition = Local_sint32Position;
+            Local_pState->SampleTick = Local_uint32EdgeTick;
+        }
+    }
+    else if((MSYSTICK_uint32GetTickCount() - Local_pState->SampleTick) > ENCODER_STOP_TIMEOUT_TICKS)
+    {
+        /*stopped: slide the window so the first edge after standstill is averaged over at most the timeout*/
+        Local_pState->Velocity = 0;
+        Local_pState->SampleTick = MSYSTICK_uint32GetTickCount() - ENCODER_STOP_TIMEOUT_TICKS;
+    }
+    else
+    {
+        /*no new edge yet: keep last value*/
+    }
+    return Local_pState->Velocity;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 HENCODER_uint32GetErrorCount(uint8 Copy_uint8Encoder)
+* \Description     : number of illegal transitions (both channels changed between two ISRs: missed edge)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number
+* \Parameters (out): None
+* \Return value:   : uint32 error count
+*******************************************************************************/
+uint32 HENCODER_uint32GetErrorCount(uint8 Copy_uint8Encoder)
+{
+    return ENCODER_States[Copy_uint8Encoder].ErrorCount;
+}
+
+/******************************************************************************
+* \Syntax          : void HENCODER_VoidClearErrors(uint8 Copy_uint8Encoder)
+* \Description     : reset illegal transition counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Encoder : encoder number
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HENCODER_VoidClearErrors(uint8 Copy_uint8Encoder)
+{
+    ENCODER_States[Copy_uint8Encoder].ErrorCount = 0;
+}
@@ -0,0 +1,37 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_I2C_config.h
+ *       Module:  SOFT_I2C Module
+ *  Description:  Configuration header file for bit-banged I2C master
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SOFT_I2C_CONFIG_H
+#define _SOFT_I2C_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*SCL and SDA on one port (open drain, external pull-ups required)
+  Options: _GPIOA_PORT ... _GPIOE_PORT*/
+#define SOFT_I2C_PORT               _GPIOB_PORT
+#define SOFT_I2C_SCL_PIN            pin10
+#define SOFT_I2C_SDA_PIN            pin11
+
+/*busy loop iterations in every SCL half period, tune for 100KHZ/400KHZ at the used core clock,
+  0 -> no delay (fastest, slave must stretch the clock if it can not follow)*/
+#define SOFT_I2C_HALF_PERIOD_DELAY  10
+
+/*longest clock stretch accepted from a slave in microseconds (SysTick timebase) before the transfer is aborted.
+  while the timebase is stopped the wait is bounded by a poll count of at least this time at 72MHZ instead*/
+#define SOFT_I2C_STRETCH_TIMEOUT_US 1000UL
+
+/*effective bit rate of every transfer measured with the DWT cycle counter (HSOFTI2C_uint32GetBitRate) , 1 on , 0 off.
+  the cycle counter must be started by the application (MDWT_VoidEnableCycleCounter)*/
+#define SOFT_I2C_MEASURE_BITRATE    1
+
+#endif
@@ -0,0 +1,95 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_I2C_interface.h
+ *       Module:  SOFT_I2C Module
+ *  Description:  Interface header file for bit-banged I2C master (7-bit addressing, clock stretching) on GPIO pins
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SOFT_I2C_INTERFACE_H
+#define _SOFT_I2C_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../LIB/Bus_Types.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+
+#include "SOFT_I2C_config.h"
+#include "SOFT_I2C_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*driver table for transport independent application code*/
+extern const I2C_Driver_t HSOFTI2C_Driver;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HSOFTI2C_VoidInit(void)
+* \Description     : configure SCL/SDA as open drain outputs, release the bus and clock out a stuck slave
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTI2C_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSOFTI2C_Std_ReturnTypeWrite(uint8 Copy_uint8Address , const uint8* Copy_pData , uint16 Copy_uint16Length)
+* \Description     : START , address+W , data bytes , STOP
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Address : 7-bit slave address , const uint8* Copy_pData , uint16 Copy_uint16Length
+* \Parameters (out): None
+* \Return value:   : OK , N_OK on NACK or clock stretch timeout
+*******************************************************************************/
+Std_ReturnType HSOFTI2C_Std_ReturnTypeWrite(uint8 Copy_uint8Address , const uint8* Copy_pData , uint16 Copy_uint16Length);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSOFTI2C_Std_ReturnTypeRead(uint8 Copy_uint8Address , uint8* Copy_pData , uint16 Copy_uint16Length)
+* \Description     : START , address+R , data bytes (NACK on last) , STOP
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Address : 7-bit slave address , uint16 Copy_uint16Length
+* \Parameters (out): uint8* Copy_pData : received bytes
+* \Return value:   : OK , N_OK on NACK or clock stretch timeout
+*******************************************************************************/
+Std_ReturnType HSOFTI2C_Std_ReturnTypeRead(uint8 Copy_uint8Address , uint8* Copy_pData , uint16 Copy_uint16Length);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSOFTI2C_Std_ReturnTypeWriteRead(uint8 Copy_uint8Address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength ,
+*                                                                     uint8* Copy_pRx , uint16 Copy_uint16RxLength)
+* \Description     : write (register address) then repeated START and read, typical sensor register read
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Address : 7-bit slave address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength , uint16 Copy_uint16RxLength
+* \Parameters (out): uint8* Copy_pRx : received bytes
+* \Return value:   : OK , N_OK on NACK or clock stretch timeout
+*******************************************************************************/
+Std_ReturnType HSOFTI2C_Std_ReturnTypeWriteRead(uint8 Copy_uint8Address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength ,
+                                                uint8* Copy_pRx , uint16 Copy_uint16RxLength);
+
+/******************************************************************************
+* \Syntax          : uint32 HSOFTI2C_uint32GetBitRate(void)
+* \Description     : effective bit rate of the last completed transfer: SCL clocks (9 per byte) * HCLK / DWT cycles
+*                    from START to STOP , so START/STOP and stretch time lower it compared to the SCL frequency
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 bits per second , 0 before the first transfer , with SOFT_I2C_MEASURE_BITRATE 0 or
+*                    with the DWT cycle counter stopped
+*******************************************************************************/
+uint32 HSOFTI2C_uint32GetBitRate(void);
+
+#endif
@@ -0,0 +1,77 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_I2C_private.h
+ *       Module:  SOFT_I2C Module
+ *  Description:  Private header file for bit-banged I2C master
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SOFT_I2C_PRIVATE_H
+#define _SOFT_I2C_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define SOFT_I2C_GPIO               GPIO_PORT_ADDRESS(SOFT_I2C_PORT)
+
+/*open drain: setting the output releases the line (pulled up) , resetting drives it low*/
+#define SOFT_I2C_SCL_RELEASE()      (SOFT_I2C_GPIO->BSRR = (1UL << SOFT_I2C_SCL_PIN))
+#define SOFT_I2C_SCL_LOW()          (SOFT_I2C_GPIO->BSRR = (1UL << (SOFT_I2C_SCL_PIN + 16)))
+#define SOFT_I2C_SDA_RELEASE()      (SOFT_I2C_GPIO->BSRR = (1UL << SOFT_I2C_SDA_PIN))
+#define SOFT_I2C_SDA_LOW()          (SOFT_I2C_GPIO->BSRR = (1UL << (SOFT_I2C_SDA_PIN + 16)))
+#define SOFT_I2C_SDA_SET_MASK       (1UL << SOFT_I2C_SDA_PIN)
+#define SOFT_I2C_SDA_RESET_MASK     (1UL << (SOFT_I2C_SDA_PIN + 16))
+#define SOFT_I2C_SCL_READ()         ((SOFT_I2C_GPIO->IDR >> SOFT_I2C_SCL_PIN) & 1U)
+#define SOFT_I2C_SDA_READ()         ((SOFT_I2C_GPIO->IDR >> SOFT_I2C_SDA_PIN) & 1U)
+
+#if SOFT_I2C_HALF_PERIOD_DELAY == 0
+#define SOFT_I2C_DELAY()
+#else
+#define SOFT_I2C_DELAY()            do{ volatile uint32 Local_uint32Delay = SOFT_I2C_HALF_PERIOD_DELAY; while(Local_uint32Delay--); }while(0)
+#endif
+
+/*stretch wait bound while the timebase is stopped: one SCL poll takes at least 4 cycles , at most 72 cycles per us*/
+#define SOFT_I2C_STRETCH_TIMEOUT_LOOPS  (SOFT_I2C_STRETCH_TIMEOUT_US * (72UL / 4UL))
+
+/*release SCL , the stretch wait is only called while a slave holds it low.
+  returns N_OK from the calling function on a stretch timeout*/
+#define SOFT_I2C_SCL_HIGH_OR_RETURN()           do{                                                                         \
+                                                    SOFT_I2C_SCL_RELEASE();                                                 \
+                                                    if((SOFT_I2C_SCL_READ() == 0) &&                                        \
+                                                       (HSOFTI2C_Std_ReturnTypeStretchWait() != OK))                        \
+                                                    {                                                                       \
+                                                        return N_OK;                                                        \
+                                                    }                                                                       \
+                                                }while(0)
+
+/*one bit out: SDA in one BSRR write while SCL is low , SCL high , SCL low (returns N_OK on a stretch timeout)*/
+#define SOFT_I2C_WRITE_BIT_OR_RETURN(TX,BIT)    do{                                                                         \
+                                                    SOFT_I2C_GPIO->BSRR = ((TX) & (1U << (BIT))) ?                          \
+                                                        SOFT_I2C_SDA_SET_MASK : SOFT_I2C_SDA_RESET_MASK;                    \
+                                                    SOFT_I2C_DELAY();                                                       \
+                                                    SOFT_I2C_SCL_HIGH_OR_RETURN();                                          \
+                                                    SOFT_I2C_DELAY();                                                       \
+                                                    SOFT_I2C_SCL_LOW();                                                     \
+                                                }while(0)
+
+/*one bit in: SCL high , sample SDA , SCL low (SDA released by the caller , returns N_OK on a stretch timeout)*/
+#define SOFT_I2C_READ_BIT_OR_RETURN(RX)         do{                                                                         \
+                                                    SOFT_I2C_DELAY();                                                       \
+                                                    SOFT_I2C_SCL_HIGH_OR_RETURN();                                          \
+                                                    (RX) = ((RX) << 1) | SOFT_I2C_SDA_READ();                               \
+                                                    SOFT_I2C_DELAY();                                                       \
+                                                    SOFT_I2C_SCL_LOW();                                                     \
+                                                }while(0)
+
+/*address byte direction bit*/
+#define SOFT_I2C_WRITE              0U
+#define SOFT_I2C_READ               1U
+
+#define SOFT_I2C_ACK                0U
+#define SOFT_I2C_NACK               1U
+
+#endif
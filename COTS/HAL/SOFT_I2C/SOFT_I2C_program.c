@@ -0,0 +1,278 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_I2C_program.c
+ *       Module:  SOFT_I2C Module
+ *  Description:  implementaion C file for bit-banged I2C master
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "SOFT_I2C_interface.h"
+#include "../../MCAL/RCC/RCC_interface.h"
+#include "../../MCAL/SYSTick/SYSTick_interface.h"
+#include "../../MCAL/DWT/DWT_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+const I2C_Driver_t HSOFTI2C_Driver =
+{
+    HSOFTI2C_VoidInit,
+    HSOFTI2C_Std_ReturnTypeWrite,
+    HSOFTI2C_Std_ReturnTypeRead,
+    HSOFTI2C_Std_ReturnTypeWriteRead
+};
+
+#if SOFT_I2C_MEASURE_BITRATE == 1
+/*core cycles and SCL clocks (9 per byte) of the last completed transfer*/
+static uint32 SOFT_I2C_uint32LastCycles = 0;
+static uint32 SOFT_I2C_uint32LastBits = 0;
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*wait while a slave holds SCL low (at once OK when it is released) , bounded by the timebase or by a poll count while
+  the timebase is stopped*/
+static Std_ReturnType HSOFTI2C_Std_ReturnTypeStretchWait(void)
+{
+    /*0: timebase stopped (MSYSTICK_uint64GetTimeUs contract) , MSYSTICK_uint8TimeoutExpired would never expire*/
+    uint64 Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+    uint32 Local_uint32Loops = SOFT_I2C_STRETCH_TIMEOUT_LOOPS;
+    while(SOFT_I2C_SCL_READ() == 0)
+    {
+        if(Local_uint64Start != 0)
+        {
+            if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,SOFT_I2C_STRETCH_TIMEOUT_US))
+            {
+                return N_OK;
+            }
+        }
+        else if(--Local_uint32Loops == 0)
+        {
+            return N_OK;
+        }
+        else{}
+    }
+    return OK;
+}
+
+/*START (or repeated START when called with SCL low): SDA falls while SCL is high*/
+static Std_ReturnType HSOFTI2C_Std_ReturnTypeStart(void)
+{
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_HIGH_OR_RETURN();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SDA_LOW();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_LOW();
+    return OK;
+}
+
+/*STOP: SDA rises while SCL is high*/
+static void HSOFTI2C_VoidStop(void)
+{
+    SOFT_I2C_SCL_LOW();
+    SOFT_I2C_SDA_LOW();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_RELEASE();
+    (void)HSOFTI2C_Std_ReturnTypeStretchWait();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_DELAY();
+}
+
+/*MSB first byte then read slave ACK , bits unrolled (no loop counter , SDA mask selected per bit)*/
+static Std_ReturnType HSOFTI2C_Std_ReturnTypeWriteByte(uint8 Copy_uint8Data)
+{
+    uint8 Local_uint8Ack;
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,7);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,6);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,5);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,4);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,3);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,2);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,1);
+    SOFT_I2C_WRITE_BIT_OR_RETURN(Copy_uint8Data,0);
+    /*ACK clock: slave pulls SDA low*/
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_HIGH_OR_RETURN();
+    Local_uint8Ack = SOFT_I2C_SDA_READ();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_LOW();
+    return (Local_uint8Ack == SOFT_I2C_ACK) ? OK : N_OK;
+}
+
+/*MSB first byte then send ACK (more bytes follow) or NACK (last byte) , bits unrolled*/
+static Std_ReturnType HSOFTI2C_Std_ReturnTypeReadByte(uint8* Copy_pData , uint8 Copy_uint8Ack)
+{
+    uint32 Local_uint32Data = 0;
+    SOFT_I2C_SDA_RELEASE();
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    SOFT_I2C_READ_BIT_OR_RETURN(Local_uint32Data);
+    if(Copy_uint8Ack == SOFT_I2C_ACK)
+    {
+        SOFT_I2C_SDA_LOW();
+    }
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_HIGH_OR_RETURN();
+    SOFT_I2C_DELAY();
+    SOFT_I2C_SCL_LOW();
+    SOFT_I2C_SDA_RELEASE();
+    *Copy_pData = (uint8)Local_uint32Data;
+    return OK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HSOFTI2C_VoidInit(void)
+* \Description     : configure SCL/SDA as open drain outputs, release the bus and clock out a stuck slave
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTI2C_VoidInit(void)
+{
+    uint8 Local_uint8Itr;
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_IOPA + SOFT_I2C_PORT,RCC_CLIENT_SOFT_I2C);
+    SOFT_I2C_SCL_RELEASE();
+    SOFT_I2C_SDA_RELEASE();
+    MGPIO_VoidSetPinMode_TYPE(SOFT_I2C_PORT,SOFT_I2C_SCL_PIN,OUTPUT_SPEED_50MHZ_OPENDRAIN);
+    MGPIO_VoidSetPinMode_TYPE(SOFT_I2C_PORT,SOFT_I2C_SDA_PIN,OUTPUT_SPEED_50MHZ_OPENDRAIN);
+    /*a slave reset in the middle of a read may hold SDA low: 9 clocks let it finish its byte*/
+    for(Local_uint8Itr = 0; (Local_uint8Itr < 9) && (SOFT_I2C_SDA_READ() == 0); Local_uint8Itr++)
+    {
+        SOFT_I2C_SCL_LOW();
+        SOFT_I2C_DELAY();
+        SOFT_I2C_SCL_RELEASE();
+    (void)HSOFTI2C_Std_ReturnTypeStretchWait();
+        SOFT_I2C_DELAY();
+    }
+    HSOFTI2C_VoidStop();
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSOFTI2C_Std_ReturnTypeWriteRead(uint8 Copy_uint8Address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength ,
+*                                                                     uint8* Copy_pRx , uint16 Copy_uint16RxLength)
+* \Description     : write (register address) then repeated START and read, typical sensor register read
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Address : 7-bit slave address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength , uint16 Copy_uint16RxLength
+* \Parameters (out): uint8* Copy_pRx : received bytes
+* \Return value:   : OK , N_OK on NACK or clock stretch timeout
+*******************************************************************************/
+Std_ReturnType HSOFTI2C_Std_ReturnTypeWriteRead(uint8 Copy_uint8Address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength ,
+                                                uint8* Copy_pRx , uint16 Copy_uint16RxLength)
+{
+#if SOFT_I2C_MEASURE_BITRATE == 1
+    uint32 Local_uint32Start = MDWT_CYCLE_COUNT();
+    /*address byte of each phase + data bytes*/
+    uint32 Local_uint32Bits = 9UL * ((uint32)Copy_uint16TxLength + Copy_uint16RxLength +
+                              (((Copy_uint16TxLength != 0) || (Copy_uint16RxLength == 0)) ? 1UL : 0UL) +
+                              ((Copy_uint16RxLength != 0) ? 1UL : 0UL));
+#endif
+    Std_ReturnType Local_Status = HSOFTI2C_Std_ReturnTypeStart();
+
+    /*write phase (also used alone as address probe when both lengths are 0)*/
+    if((Local_Status == OK) && ((Copy_uint16TxLength != 0) || (Copy_uint16RxLength == 0)))
+    {
+        Local_Status = HSOFTI2C_Std_ReturnTypeWriteByte((uint8)((Copy_uint8Address << 1) | SOFT_I2C_WRITE));
+        while((Local_Status == OK) && (Copy_uint16TxLength != 0))
+        {
+            Local_Status = HSOFTI2C_Std_ReturnTypeWriteByte(*Copy_pTx++);
+            Copy_uint16TxLength--;
+        }
+        if((Local_Status == OK) && (Copy_uint16RxLength != 0))
+        {
+            Local_Status = HSOFTI2C_Std_ReturnTypeStart();
+        }
+    }
+
+    if((Local_Status == OK) && (Copy_uint16RxLength != 0))
+    {
+        Local_Status = HSOFTI2C_Std_ReturnTypeWriteByte((uint8)((Copy_uint8Address << 1) | SOFT_I2C_READ));
+        while((Local_Status == OK) && (Copy_uint16RxLength != 0))
+        {
+            Copy_uint16RxLength--;
+            Local_Status = HSOFTI2C_Std_ReturnTypeReadByte(Copy_pRx++,
+                                (Copy_uint16RxLength != 0) ? SOFT_I2C_ACK : SOFT_I2C_NACK);
+        }
+    }
+
+    HSOFTI2C_VoidStop();
+#if SOFT_I2C_MEASURE_BITRATE == 1
+    if(Local_Status == OK)
+    {
+        SOFT_I2C_uint32LastCycles = MDWT_CYCLE_COUNT() - Local_uint32Start;
+        SOFT_I2C_uint32LastBits = Local_uint32Bits;
+    }
+#endif
+    return Local_Status;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSOFTI2C_Std_ReturnTypeWrite(uint8 Copy_uint8Address , const uint8* Copy_pData , uint16 Copy_uint16Length)
+* \Description     : START , address+W , data bytes , STOP
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Address : 7-bit slave address , const uint8* Copy_pData , uint16 Copy_uint16Length
+* \Parameters (out): None
+* \Return value:   : OK , N_OK on NACK or clock stretch timeout
+*******************************************************************************/
+Std_ReturnType HSOFTI2C_Std_ReturnTypeWrite(uint8 Copy_uint8Address , const uint8* Copy_pData , uint16 Copy_uint16Length)
+{
+    return HSOFTI2C_Std_ReturnTypeWriteRead(Copy_uint8Address,Copy_pData,Copy_uint16Length,NULL,0);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSOFTI2C_Std_ReturnTypeRead(uint8 Copy_uint8Address , uint8* Copy_pData , uint16 Copy_uint16Length)
+* \Description     : START , address+R , data bytes (NACK on last) , STOP
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Address : 7-bit slave address , uint16 Copy_uint16Length
+* \Parameters (out): uint8* Copy_pData : received bytes
+* \Return value:   : OK , N_OK on NACK or clock stretch timeout
+*******************************************************************************/
+Std_ReturnType HSOFTI2C_Std_ReturnTypeRead(uint8 Copy_uint8Address , uint8* Copy_pData , uint16 Copy_uint16Length)
+{
+    return HSOFTI2C_Std_ReturnTypeWriteRead(Copy_uint8Address,NULL,0,Copy_pData,Copy_uint16Length);
+}
+
+/******************************************************************************
+* \Syntax          : uint32 HSOFTI2C_uint32GetBitRate(void)
+* \Description     : effective bit rate of the last completed transfer: SCL clocks (9 per byte) * HCLK / DWT cycles
+*                    from START to STOP , so START/STOP and stretch time lower it compared to the SCL frequency
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 bits per second , 0 before the first transfer , with SOFT_I2C_MEASURE_BITRATE 0 or
+*                    with the DWT cycle counter stopped
+*******************************************************************************/
+uint32 HSOFTI2C_uint32GetBitRate(void)
+{
+#if SOFT_I2C_MEASURE_BITRATE == 1
+    return MDWT_uint32GetRate(SOFT_I2C_uint32LastBits,SOFT_I2C_uint32LastCycles,MRCC_u32GetHclk());
+#else
+    return 0;
+#endif
+}
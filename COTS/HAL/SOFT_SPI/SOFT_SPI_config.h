@@ -0,0 +1,35 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_SPI_config.h
+ *       Module:  SOFT_SPI Module
+ *  Description:  Configuration header file for bit-banged SPI master
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SOFT_SPI_CONFIG_H
+#define _SOFT_SPI_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*all SPI pins on one port so SCK and MOSI change in the same BSRR write
+  Options: _GPIOA_PORT ... _GPIOE_PORT*/
+#define SOFT_SPI_PORT               _GPIOB_PORT
+#define SOFT_SPI_SCK_PIN            pin13
+#define SOFT_SPI_MISO_PIN           pin14
+#define SOFT_SPI_MOSI_PIN           pin15
+#define SOFT_SPI_CS_PIN             pin12
+
+/*busy loop iterations in every SCK half period, 0 -> no delay (maximum clock rate,
+  slave must support it at the used core clock)*/
+#define SOFT_SPI_HALF_PERIOD_DELAY  0
+
+/*effective bit rate of every transfer measured with the DWT cycle counter (HSOFTSPI_uint32GetBitRate) , 1 on , 0 off.
+  the cycle counter must be started by the application (MDWT_VoidEnableCycleCounter)*/
+#define SOFT_SPI_MEASURE_BITRATE    1
+
+#endif
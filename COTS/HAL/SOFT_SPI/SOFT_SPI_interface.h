@@ -0,0 +1,104 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_SPI_interface.h
+ *       Module:  SOFT_SPI Module
+ *  Description:  Interface header file for bit-banged SPI master (modes 0-3, MSB first) on GPIO pins
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SOFT_SPI_INTERFACE_H
+#define _SOFT_SPI_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../LIB/Bus_Types.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+
+#include "SOFT_SPI_config.h"
+#include "SOFT_SPI_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*driver table for transport independent application code*/
+extern const SPI_Driver_t HSOFTSPI_Driver;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidInit(SPI_Mode_t Copy_Mode)
+* \Description     : configure SCK/MOSI/CS as push-pull outputs and MISO as floating input, precompute BSRR masks of the mode
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : SPI_Mode_t Copy_Mode : SPI_MODE0..SPI_MODE3
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidInit(SPI_Mode_t Copy_Mode);
+
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidSelect(void)
+* \Description     : drive chip select low
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidSelect(void);
+
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidDeselect(void)
+* \Description     : drive chip select high
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidDeselect(void);
+
+/******************************************************************************
+* \Syntax          : uint8 HSOFTSPI_uint8Transfer(uint8 Copy_uint8Data)
+* \Description     : full duplex transfer of one byte
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Data : byte to send
+* \Parameters (out): None
+* \Return value:   : uint8 received byte
+*******************************************************************************/
+uint8 HSOFTSPI_uint8Transfer(uint8 Copy_uint8Data);
+
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidTransferBlock(const uint8* Copy_pTx , uint8* Copy_pRx , uint16 Copy_uint16Length)
+* \Description     : full duplex transfer of a block with the byte loop inlined (no call per byte)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : const uint8* Copy_pTx : bytes to send or NULL to send 0xFF , uint16 Copy_uint16Length : number of bytes
+* \Parameters (out): uint8* Copy_pRx : received bytes or NULL to discard
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidTransferBlock(const uint8* Copy_pTx , uint8* Copy_pRx , uint16 Copy_uint16Length);
+
+/******************************************************************************
+* \Syntax          : uint32 HSOFTSPI_uint32GetBitRate(void)
+* \Description     : effective bit rate of the last transfer: SCK clocks (8 per byte) * HCLK / DWT cycles of the whole
+*                    transfer , so the byte loop and pointer handling lower it compared to the SCK frequency
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 bits per second , 0 before the first transfer , with SOFT_SPI_MEASURE_BITRATE 0 or
+*                    with the DWT cycle counter stopped
+*******************************************************************************/
+uint32 HSOFTSPI_uint32GetBitRate(void);
+
+#endif
@@ -0,0 +1,55 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_SPI_private.h
+ *       Module:  SOFT_SPI Module
+ *  Description:  Private header file for bit-banged SPI master
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SOFT_SPI_PRIVATE_H
+#define _SOFT_SPI_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define SOFT_SPI_GPIO               GPIO_PORT_ADDRESS(SOFT_SPI_PORT)
+
+/*BSRR masks, lower half sets the pin , upper half resets it*/
+#define SOFT_SPI_SCK_SET            (1UL << SOFT_SPI_SCK_PIN)
+#define SOFT_SPI_SCK_RESET          (1UL << (SOFT_SPI_SCK_PIN + 16))
+#define SOFT_SPI_MOSI_SET           (1UL << SOFT_SPI_MOSI_PIN)
+#define SOFT_SPI_MOSI_RESET         (1UL << (SOFT_SPI_MOSI_PIN + 16))
+#define SOFT_SPI_CS_SET             (1UL << SOFT_SPI_CS_PIN)
+#define SOFT_SPI_CS_RESET           (1UL << (SOFT_SPI_CS_PIN + 16))
+
+#if SOFT_SPI_HALF_PERIOD_DELAY == 0
+#define SOFT_SPI_DELAY()
+#else
+#define SOFT_SPI_DELAY()            do{ volatile uint32 Local_uint32Delay = SOFT_SPI_HALF_PERIOD_DELAY; while(Local_uint32Delay--); }while(0)
+#endif
+
+/*one bit: leading edge with MOSI in the same write , trailing edge , sample MISO
+  (mode is folded in the precomputed lead/trail masks)*/
+#define SOFT_SPI_BIT(TX,RX,BIT)     do{                                                                 \
+                                        Local_pGpio->BSRR = SOFT_SPI_LeadMask |                         \
+                                            (((TX) & (1U << (BIT))) ? SOFT_SPI_MOSI_SET : SOFT_SPI_MOSI_RESET); \
+                                        SOFT_SPI_DELAY();                                               \
+                                        Local_pGpio->BSRR = SOFT_SPI_TrailMask;                         \
+                                        (RX) = ((RX) << 1) | ((Local_pGpio->IDR >> SOFT_SPI_MISO_PIN) & 1U); \
+                                        SOFT_SPI_DELAY();                                               \
+                                    }while(0)
+
+/*unrolled MSB first byte, idle mask restores CPOL level after CPHA=0 bytes*/
+#define SOFT_SPI_BYTE(TX,RX)        do{                                                                 \
+                                        SOFT_SPI_BIT(TX,RX,7); SOFT_SPI_BIT(TX,RX,6);                   \
+                                        SOFT_SPI_BIT(TX,RX,5); SOFT_SPI_BIT(TX,RX,4);                   \
+                                        SOFT_SPI_BIT(TX,RX,3); SOFT_SPI_BIT(TX,RX,2);                   \
+                                        SOFT_SPI_BIT(TX,RX,1); SOFT_SPI_BIT(TX,RX,0);                   \
+                                        Local_pGpio->BSRR = SOFT_SPI_IdleMask;                          \
+                                    }while(0)
+
+#endif
@@ -0,0 +1,188 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SOFT_SPI_program.c
+ *       Module:  SOFT_SPI Module
+ *  Description:  implementaion C file for bit-banged SPI master
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "SOFT_SPI_interface.h"
+#include "../../MCAL/RCC/RCC_interface.h"
+#include "../../MCAL/DWT/DWT_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*SCK masks of current mode: lead edge comes with MOSI, trail edge is followed by MISO sampling*/
+static uint32 SOFT_SPI_LeadMask  = SOFT_SPI_SCK_RESET;
+static uint32 SOFT_SPI_TrailMask = SOFT_SPI_SCK_SET;
+static uint32 SOFT_SPI_IdleMask  = SOFT_SPI_SCK_RESET;
+
+#if SOFT_SPI_MEASURE_BITRATE == 1
+/*core cycles and SCK clocks (8 per byte) of the last transfer*/
+static uint32 SOFT_SPI_uint32LastCycles = 0;
+static uint32 SOFT_SPI_uint32LastBits = 0;
+#endif
+
+const SPI_Driver_t HSOFTSPI_Driver =
+{
+    HSOFTSPI_VoidInit,
+    HSOFTSPI_VoidSelect,
+    HSOFTSPI_VoidDeselect,
+    HSOFTSPI_uint8Transfer,
+    HSOFTSPI_VoidTransferBlock
+};
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidInit(SPI_Mode_t Copy_Mode)
+* \Description     : configure SCK/MOSI/CS as push-pull outputs and MISO as floating input, precompute BSRR masks of the mode
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : SPI_Mode_t Copy_Mode : SPI_MODE0..SPI_MODE3
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidInit(SPI_Mode_t Copy_Mode)
+{
+    uint8 Local_uint8Cpol = (Copy_Mode >> 1) & 1U;
+    uint8 Local_uint8Cpha = Copy_Mode & 1U;
+
+    /*CPHA=0: data set while SCK idle and sampled on the first (active) edge
+      CPHA=1: data set on the first (active) edge and sampled on the second (idle) edge*/
+    SOFT_SPI_IdleMask = Local_uint8Cpol ? SOFT_SPI_SCK_SET : SOFT_SPI_SCK_RESET;
+    if((Local_uint8Cpol ^ Local_uint8Cpha) == 0)
+    {
+        SOFT_SPI_LeadMask  = SOFT_SPI_SCK_RESET;
+        SOFT_SPI_TrailMask = SOFT_SPI_SCK_SET;
+    }
+    else
+    {
+        SOFT_SPI_LeadMask  = SOFT_SPI_SCK_SET;
+        SOFT_SPI_TrailMask = SOFT_SPI_SCK_RESET;
+    }
+
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_IOPA + SOFT_SPI_PORT,RCC_CLIENT_SOFT_SPI);
+    /*idle levels before switching pins to outputs*/
+    SOFT_SPI_GPIO->BSRR = SOFT_SPI_IdleMask | SOFT_SPI_CS_SET | SOFT_SPI_MOSI_RESET;
+    MGPIO_VoidSetPinMode_TYPE(SOFT_SPI_PORT,SOFT_SPI_SCK_PIN,OUTPUT_SPEED_50MHZ_PUSHPULL);
+    MGPIO_VoidSetPinMode_TYPE(SOFT_SPI_PORT,SOFT_SPI_MOSI_PIN,OUTPUT_SPEED_50MHZ_PUSHPULL);
+    MGPIO_VoidSetPinMode_TYPE(SOFT_SPI_PORT,SOFT_SPI_CS_PIN,OUTPUT_SPEED_50MHZ_PUSHPULL);
+    MGPIO_VoidSetPinMode_TYPE(SOFT_SPI_PORT,SOFT_SPI_MISO_PIN,INPUT_FLOATING);
+}
+
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidSelect(void)
+* \Description     : drive chip select low
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidSelect(void)
+{
+    SOFT_SPI_GPIO->BSRR = SOFT_SPI_CS_RESET;
+}
+
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidDeselect(void)
+* \Description     : drive chip select high
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidDeselect(void)
+{
+    SOFT_SPI_GPIO->BSRR = SOFT_SPI_CS_SET;
+}
+
+/******************************************************************************
+* \Syntax          : uint8 HSOFTSPI_uint8Transfer(uint8 Copy_uint8Data)
+* \Description     : full duplex transfer of one byte
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Data : byte to send
+* \Parameters (out): None
+* \Return value:   : uint8 received byte
+*******************************************************************************/
+uint8 HSOFTSPI_uint8Transfer(uint8 Copy_uint8Data)
+{
+    volatile GPIO_t* Local_pGpio = SOFT_SPI_GPIO;
+    uint32 Local_uint32Rx = 0;
+#if SOFT_SPI_MEASURE_BITRATE == 1
+    uint32 Local_uint32Start = MDWT_CYCLE_COUNT();
+#endif
+    SOFT_SPI_BYTE(Copy_uint8Data,Local_uint32Rx);
+#if SOFT_SPI_MEASURE_BITRATE == 1
+    SOFT_SPI_uint32LastCycles = MDWT_CYCLE_COUNT() - Local_uint32Start;
+    SOFT_SPI_uint32LastBits = 8UL;
+#endif
+    return (uint8)Local_uint32Rx;
+}
+
+/******************************************************************************
+* \Syntax          : void HSOFTSPI_VoidTransferBlock(const uint8* Copy_pTx , uint8* Copy_pRx , uint16 Copy_uint16Length)
+* \Description     : full duplex transfer of a block with the byte loop inlined (no call per byte)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : const uint8* Copy_pTx : bytes to send or NULL to send 0xFF , uint16 Copy_uint16Length : number of bytes
+* \Parameters (out): uint8* Copy_pRx : received bytes or NULL to discard
+* \Return value:   : None
+*******************************************************************************/
+void HSOFTSPI_VoidTransferBlock(const uint8* Copy_pTx , uint8* Copy_pRx , uint16 Copy_uint16Length)
+{
+    volatile GPIO_t* Local_pGpio = SOFT_SPI_GPIO;
+    uint32 Local_uint32Tx;
+    uint32 Local_uint32Rx;
+#if SOFT_SPI_MEASURE_BITRATE == 1
+    uint32 Local_uint32Start = MDWT_CYCLE_COUNT();
+    uint32 Local_uint32Bits = 8UL * Copy_uint16Length;
+#endif
+    while(Copy_uint16Length--)
+    {
+        Local_uint32Tx = (Copy_pTx != NULL) ? *Copy_pTx++ : 0xFFU;
+        Local_uint32Rx = 0;
+        SOFT_SPI_BYTE(Local_uint32Tx,Local_uint32Rx);
+        if(Copy_pRx != NULL)
+        {
+            *Copy_pRx++ = (uint8)Local_uint32Rx;
+        }
+    }
+#if SOFT_SPI_MEASURE_BITRATE == 1
+    SOFT_SPI_uint32LastCycles = MDWT_CYCLE_COUNT() - Local_uint32Start;
+    SOFT_SPI_uint32LastBits = Local_uint32Bits;
+#endif
+}
+
+/******************************************************************************
+* \Syntax          : uint32 HSOFTSPI_uint32GetBitRate(void)
+* \Description     : effective bit rate of the last transfer: SCK clocks (8 per byte) * HCLK / DWT cycles of the whole
+*                    transfer , so the byte loop and pointer handling lower it compared to the SCK frequency
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 bits per second , 0 before the first transfer , with SOFT_SPI_MEASURE_BITRATE 0 or
+*                    with the DWT cycle counter stopped
+*******************************************************************************/
+uint32 HSOFTSPI_uint32GetBitRate(void)
+{
+#if SOFT_SPI_MEASURE_BITRATE == 1
+    return MDWT_uint32GetRate(SOFT_SPI_uint32LastBits,SOFT_SPI_uint32LastCycles,MRCC_u32GetHclk());
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,45 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SWPWM_config.h
+ *       Module:  SWPWM Module
+ *  Description:  Configuration header file for software PWM engine
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SWPWM_CONFIG_H
+#define _SWPWM_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*port of all PWM channels (one BSRR write per edge group needs all channels on the same port)
+  Options: _GPIOA_PORT ... _GPIOE_PORT*/
+#define SWPWM_PORT                  _GPIOA_PORT
+
+/*pins of the channels, channel number is the index in this list*/
+#define SWPWM_CHANNEL_PINS          {pin0, pin1, pin2, pin3}
+#define SWPWM_NUM_CHANNELS          4
+
+/*timer that schedules the edges, its IRQ must be enabled in NVIC by the application
+  Options: TIM_2 , TIM_3 , TIM_4*/
+#define SWPWM_TIMER                 TIM_2
+
+/*timer counter clock in HZ -> 1 tick per 1us. the prescaler is derived from the live APB1 clock by the TIM driver
+  and again after every run time clock change (MRCC_Std_ReturnTypeSetClockMode) , so periods and duties keep their
+  length in every clock mode. at most the 8 MHZ HSI clock*/
+#define SWPWM_TICK_HZ               1000000UL
+
+/*PWM period and duty resolution in timer ticks (max 65535) -> 1000us = 1KHZ*/
+#define SWPWM_PERIOD_TICKS          1000
+
+/*worst case HCLK cycles of one edge interrupt: exception entry + TIMx_IRQHandler + HSWPWM_VoidEdgeISR + exit.
+  replace the estimate with the MaxCycles the PROFILER service reports for the timer vector on target.
+  the minimum gap between two edge interrupts is derived from it and the live HCLK (HSWPWM_uint16GetMinEdgeGap) ,
+  channel edges closer than that gap are merged in one BSRR write*/
+#define SWPWM_ISR_CYCLES            96
+
+#endif
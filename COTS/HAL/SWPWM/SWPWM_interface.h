@@ -0,0 +1,125 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SWPWM_interface.h
+ *       Module:  SWPWM Module
+ *  Description:  Interface header file for multi-channel software PWM on GPIO pins.
+ *                every period is precomputed as a sorted list of (BSRR mask , ticks to next edge),
+ *                the timer ISR replays the list with one BSRR write per edge group.
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SWPWM_INTERFACE_H
+#define _SWPWM_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/TIM/TIM_interface.h"
+#include "../../MCAL/RCC/RCC_interface.h"
+
+#include "SWPWM_config.h"
+#include "SWPWM_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidInit(void)
+* \Description     : configure channel pins as push-pull outputs, all duties 0 and prepare the schedule timer.
+*                    periods and duties keep their length over a run time clock change (the running period is cut ,
+*                    the last committed duties restart from a new period)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidStart(void)
+* \Description     : apply first edge group and start the schedule timer
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidStart(void);
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidStop(void)
+* \Description     : stop the schedule timer and drive all channels low
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidStop(void);
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidSetDuty(uint8 Copy_uint8Channel , uint16 Copy_uint16DutyTicks)
+* \Description     : stage new duty of channel, output does not change until HSWPWM_Std_ReturnTypeCommit
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Channel : channel index , uint16 Copy_uint16DutyTicks : high time 0..SWPWM_PERIOD_TICKS
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidSetDuty(uint8 Copy_uint8Channel , uint16 Copy_uint16DutyTicks);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSWPWM_Std_ReturnTypeCommit(void)
+* \Description     : build the edge schedule of staged duties in the inactive buffer and hand it to the ISR,
+*                    it is swapped in at the next period boundary so outputs never glitch
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK if previous commit is not applied yet (retry later)
+*******************************************************************************/
+Std_ReturnType HSWPWM_Std_ReturnTypeCommit(void);
+
+/******************************************************************************
+* \Syntax          : uint8 HSWPWM_uint8GetEdgeCount(void)
+* \Description     : number of edge groups in the running schedule = timer interrupts per PWM period
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint8 ISR count per period
+*******************************************************************************/
+uint8 HSWPWM_uint8GetEdgeCount(void);
+
+/******************************************************************************
+* \Syntax          : uint16 HSWPWM_uint16GetMinEdgeGap(void)
+* \Description     : minimum ticks between two edge interrupts at the live HCLK (SWPWM_ISR_CYCLES rounded up to ticks):
+*                    falling edges closer than it share one BSRR write , duties closer to 0% / 100% snap to them
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint16 gap in timer ticks
+*******************************************************************************/
+uint16 HSWPWM_uint16GetMinEdgeGap(void);
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidBuildSchedule(const uint16 Copy_uint16Duty[] , SWPWM_Schedule_t* Copy_pSchedule)
+* \Description     : compute edge list of one period from channel duties with the gap of the live HCLK (no hardware access)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : const uint16 Copy_uint16Duty[] : SWPWM_NUM_CHANNELS duties in ticks
+* \Parameters (out): SWPWM_Schedule_t* Copy_pSchedule : sorted edge groups
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidBuildSchedule(const uint16 Copy_uint16Duty[] , SWPWM_Schedule_t* Copy_pSchedule);
+
+#endif
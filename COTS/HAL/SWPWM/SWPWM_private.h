@@ -0,0 +1,48 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SWPWM_private.h
+ *       Module:  SWPWM Module
+ *  Description:  Private header file for software PWM engine
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SWPWM_PRIVATE_H
+#define _SWPWM_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/* one precomputed PWM period: edge k writes BsrrMask[k] then waits Delta[k] ticks for edge k+1 */
+typedef struct
+{
+    uint32 BsrrMask[SWPWM_NUM_CHANNELS + 1];
+    uint16 Delta[SWPWM_NUM_CHANNELS + 1];
+    uint8  EdgeCount;
+}SWPWM_Schedule_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*minimum ticks between two edge interrupts at a given HCLK: the ISR cost rounded up to whole timer ticks*/
+#define SWPWM_EDGE_GAP(HCLK_HZ)     ((((uint64)SWPWM_ISR_CYCLES * SWPWM_TICK_HZ) + (HCLK_HZ) - 1UL) / (HCLK_HZ))
+
+/*widest gap: at the 8 MHZ HSI , the slowest HCLK of the default RCC_CLOCK_MODES and the clock of a failed switch*/
+#define SWPWM_MAX_EDGE_GAP          (((SWPWM_ISR_CYCLES * SWPWM_TICK_HZ) + RCC_HSI_FREQUENCY_HZ - 1UL) / RCC_HSI_FREQUENCY_HZ)
+
+#if (SWPWM_NUM_CHANNELS > 16) || (SWPWM_NUM_CHANNELS < 1)
+#error "SWPWM: number of channels must be 1..16 (one port)"
+#endif
+
+#if (SWPWM_PERIOD_TICKS > 65535) || (SWPWM_PERIOD_TICKS <= (2 * SWPWM_MAX_EDGE_GAP))
+#error "SWPWM: period must fit 16-bit timer and be larger than two edge gaps"
+#endif
+
+#if (SWPWM_TICK_HZ == 0) || (SWPWM_TICK_HZ > RCC_HSI_FREQUENCY_HZ)
+#error "SWPWM: the tick must be at most the 8 MHZ HSI clock"
+#endif
+
+#endif
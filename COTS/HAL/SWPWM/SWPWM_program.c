@@ -0,0 +1,339 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SWPWM_program.c
+ *       Module:  SWPWM Module
+ *  Description:  implementaion C file for software PWM engine
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "SWPWM_interface.h"
+#include "../../LIB/Compiler.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static const GPIO_PinNum SWPWM_ChannelPins[SWPWM_NUM_CHANNELS] = SWPWM_CHANNEL_PINS;
+
+/*staged duties and duties of the last commit (thread context only)*/
+static uint16 SWPWM_uint16Duty[SWPWM_NUM_CHANNELS];
+static uint16 SWPWM_uint16Committed[SWPWM_NUM_CHANNELS];
+/*edge gap at the live HCLK , the widest one until the init reads the clock*/
+static uint16 SWPWM_uint16MinEdgeGap = SWPWM_MAX_EDGE_GAP;
+static uint8 SWPWM_uint8Running = 0;
+
+/*double buffered schedules: ISR replays the active one, commit builds the other one*/
+static SWPWM_Schedule_t SWPWM_Schedules[2];
+static const SWPWM_Schedule_t* volatile SWPWM_pActive = &SWPWM_Schedules[0];
+static const SWPWM_Schedule_t* volatile SWPWM_pPending = NULL;
+/*index of the edge group applied at the next timer update*/
+static volatile uint8 SWPWM_uint8Index = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*timer update ISR: one BSRR write then program the interval after the next edge (ARR is buffered,
+  the interval that starts now was loaded from the value written in the previous ISR)*/
+static RAMFUNC void HSWPWM_VoidEdgeISR(void)
+{
+    const SWPWM_Schedule_t* Local_pSchedule = SWPWM_pActive;
+    uint8 Local_uint8Index = SWPWM_uint8Index;
+
+    GPIO_PORT_ADDRESS(SWPWM_PORT)->BSRR = Local_pSchedule->BsrrMask[Local_uint8Index];
+
+    Local_uint8Index++;
+    if(Local_uint8Index >= Local_pSchedule->EdgeCount)
+    {
+        /*period boundary: the only point where a new schedule may be swapped in*/
+        Local_uint8Index = 0;
+        if(SWPWM_pPending != NULL)
+        {
+            Local_pSchedule = SWPWM_pPending;
+            SWPWM_pActive = Local_pSchedule;
+            SWPWM_pPending = NULL;
+        }
+    }
+    SWPWM_uint8Index = Local_uint8Index;
+    /*direct ARR write instead of MTIM_VoidSetPeriod to keep the ISR short*/
+    TIM_ADDRESS(SWPWM_TIMER)->ARR = (uint32)Local_pSchedule->Delta[Local_uint8Index] - 1U;
+}
+
+/*clock change: the timer stops before the switch (outputs hold their level) , after it the TIM driver has the
+  prescaler of the new APB1 clock , the gap follows the new HCLK and the last committed duties restart from a new
+  period built with that gap (a schedule of the old gap may hold edges too close for a slower core)*/
+static void HSWPWM_VoidClockChanged(uint8 Copy_uint8Event)
+{
+    if(Copy_uint8Event == RCC_CLOCK_PRE_CHANGE)
+    {
+        if(SWPWM_uint8Running != 0)
+        {
+            MTIM_VoidStop(SWPWM_TIMER);
+        }
+    }
+    else
+    {
+        SWPWM_uint16MinEdgeGap = (uint16)SWPWM_EDGE_GAP(MRCC_u32GetHclk());
+        HSWPWM_VoidBuildSchedule(SWPWM_uint16Committed,&SWPWM_Schedules[0]);
+        SWPWM_pActive = &SWPWM_Schedules[0];
+        SWPWM_pPending = NULL;
+        if(SWPWM_uint8Running != 0)
+        {
+            HSWPWM_VoidStart();
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidBuildSchedule(const uint16 Copy_uint16Duty[] , SWPWM_Schedule_t* Copy_pSchedule)
+* \Description     : compute edge list of one period from channel duties with the gap of the live HCLK (no hardware access)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : const uint16 Copy_uint16Duty[] : SWPWM_NUM_CHANNELS duties in ticks
+* \Parameters (out): SWPWM_Schedule_t* Copy_pSchedule : sorted edge groups
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidBuildSchedule(const uint16 Copy_uint16Duty[] , SWPWM_Schedule_t* Copy_pSchedule)
+{
+    uint16 Local_uint16Duty[SWPWM_NUM_CHANNELS];
+    uint8  Local_uint8Order[SWPWM_NUM_CHANNELS];
+    uint16 Local_uint16Time[SWPWM_NUM_CHANNELS + 1];
+    uint8  Local_uint8Sorted = 0;
+    uint8  Local_uint8Edge = 0;
+    uint8  Local_uint8Itr;
+    uint8  Local_uint8Channel;
+    uint16 Local_uint16Ticks;
+    uint16 Local_uint16Gap = SWPWM_uint16MinEdgeGap;
+    sint32 Local_sint32Pos;
+
+    /*edge 0 at t=0: set every channel that has high time, reset the ones that stay low*/
+    Copy_pSchedule->BsrrMask[0] = 0;
+    Local_uint16Time[0] = 0;
+    for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+    {
+        Local_uint16Ticks = Copy_uint16Duty[Local_uint8Itr];
+        /*edges closer than the minimum gap to period start/end collapse to 0% / 100%*/
+        if(Local_uint16Ticks < Local_uint16Gap)
+        {
+            Local_uint16Ticks = 0;
+        }
+        else if(Local_uint16Ticks > (SWPWM_PERIOD_TICKS - Local_uint16Gap))
+        {
+            Local_uint16Ticks = SWPWM_PERIOD_TICKS;
+        }
+        else{}
+        Local_uint16Duty[Local_uint8Itr] = Local_uint16Ticks;
+
+        if(Local_uint16Ticks == 0)
+        {
+            Copy_pSchedule->BsrrMask[0] |= (1UL << (SWPWM_ChannelPins[Local_uint8Itr] + 16));
+        }
+        else
+        {
+            Copy_pSchedule->BsrrMask[0] |= (1UL << SWPWM_ChannelPins[Local_uint8Itr]);
+            if(Local_uint16Ticks < SWPWM_PERIOD_TICKS)
+            {
+                /*insertion sort of channels that need a falling edge by duty*/
+                Local_sint32Pos = (sint32)Local_uint8Sorted - 1;
+                while((Local_sint32Pos >= 0) && (Local_uint16Duty[Local_uint8Order[Local_sint32Pos]] > Local_uint16Ticks))
+                {
+                    Local_uint8Order[Local_sint32Pos + 1] = Local_uint8Order[Local_sint32Pos];
+                    Local_sint32Pos--;
+                }
+                Local_uint8Order[Local_sint32Pos + 1] = Local_uint8Itr;
+                Local_uint8Sorted++;
+            }
+        }
+    }
+
+    /*falling edges: channels within the minimum gap of the current group share its BSRR write*/
+    for(Local_uint8Itr = 0; Local_uint8Itr < Local_uint8Sorted; Local_uint8Itr++)
+    {
+        Local_uint8Channel = Local_uint8Order[Local_uint8Itr];
+        Local_uint16Ticks = Local_uint16Duty[Local_uint8Channel];
+        if((uint16)(Local_uint16Ticks - Local_uint16Time[Local_uint8Edge]) >= Local_uint16Gap)
+        {
+            Local_uint8Edge++;
+            Local_uint16Time[Local_uint8Edge] = Local_uint16Ticks;
+            Copy_pSchedule->BsrrMask[Local_uint8Edge] = 0;
+        }
+        Copy_pSchedule->BsrrMask[Local_uint8Edge] |= (1UL << (SWPWM_ChannelPins[Local_uint8Channel] + 16));
+    }
+
+    /*interval from each edge to the next one, last one wraps to the period end*/
+    for(Local_uint8Itr = 0; Local_uint8Itr < Local_uint8Edge; Local_uint8Itr++)
+    {
+        Copy_pSchedule->Delta[Local_uint8Itr] = Local_uint16Time[Local_uint8Itr + 1] - Local_uint16Time[Local_uint8Itr];
+    }
+    Copy_pSchedule->Delta[Local_uint8Edge] = SWPWM_PERIOD_TICKS - Local_uint16Time[Local_uint8Edge];
+    Copy_pSchedule->EdgeCount = Local_uint8Edge + 1;
+}
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidInit(void)
+* \Description     : configure channel pins as push-pull outputs, all duties 0 and prepare the schedule timer.
+*                    periods and duties keep their length over a run time clock change (the running period is cut ,
+*                    the last committed duties restart from a new period)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidInit(void)
+{
+    uint8 Local_uint8Itr;
+    /*IOPA..IOPE enable bits follow port order*/
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_IOPA + SWPWM_PORT,RCC_CLIENT_SWPWM);
+    for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+    {
+        SWPWM_uint16Duty[Local_uint8Itr] = 0;
+        SWPWM_uint16Committed[Local_uint8Itr] = 0;
+        MGPIO_VoidSetPinValue(SWPWM_PORT,SWPWM_ChannelPins[Local_uint8Itr],PIN_LOW);
+        MGPIO_VoidSetPinMode_TYPE(SWPWM_PORT,SWPWM_ChannelPins[Local_uint8Itr],OUTPUT_SPEED_50MHZ_PUSHPULL);
+    }
+    SWPWM_uint16MinEdgeGap = (uint16)SWPWM_EDGE_GAP(MRCC_u32GetHclk());
+    HSWPWM_VoidBuildSchedule(SWPWM_uint16Duty,&SWPWM_Schedules[0]);
+    SWPWM_pActive = &SWPWM_Schedules[0];
+    SWPWM_pPending = NULL;
+    SWPWM_uint8Running = 0;
+
+    MTIM_VoidInit(SWPWM_TIMER,0);
+    (void)MTIM_Std_ReturnTypeSetTickHz(SWPWM_TIMER,SWPWM_TICK_HZ);
+    MTIM_VoidSetUpdateCallback(SWPWM_TIMER,HSWPWM_VoidEdgeISR);
+    /*after the TIM driver: its prescaler is set again before this callback rebuilds the schedule*/
+    (void)MRCC_Std_ReturnTypeRegisterClockCallback(HSWPWM_VoidClockChanged);
+}
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidStart(void)
+* \Description     : apply first edge group and start the schedule timer
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidStart(void)
+{
+    const SWPWM_Schedule_t* Local_pSchedule = SWPWM_pActive;
+    /*interval 0 runs now, edge 0 is applied here instead of the ISR*/
+    MTIM_VoidLoadPeriod(SWPWM_TIMER,Local_pSchedule->Delta[0]);
+    GPIO_PORT_ADDRESS(SWPWM_PORT)->BSRR = Local_pSchedule->BsrrMask[0];
+    SWPWM_uint8Index = (Local_pSchedule->EdgeCount > 1) ? 1 : 0;
+    /*preload interval after the first update*/
+    MTIM_VoidSetPeriod(SWPWM_TIMER,Local_pSchedule->Delta[SWPWM_uint8Index]);
+    MTIM_VoidStart(SWPWM_TIMER);
+    SWPWM_uint8Running = 1;
+}
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidStop(void)
+* \Description     : stop the schedule timer and drive all channels low
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidStop(void)
+{
+    uint8 Local_uint8Itr;
+    uint32 Local_uint32ResetMask = 0;
+    MTIM_VoidStop(SWPWM_TIMER);
+    SWPWM_uint8Running = 0;
+    for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+    {
+        Local_uint32ResetMask |= (1UL << (SWPWM_ChannelPins[Local_uint8Itr] + 16));
+    }
+    GPIO_PORT_ADDRESS(SWPWM_PORT)->BSRR = Local_uint32ResetMask;
+}
+
+/******************************************************************************
+* \Syntax          : void HSWPWM_VoidSetDuty(uint8 Copy_uint8Channel , uint16 Copy_uint16DutyTicks)
+* \Description     : stage new duty of channel, output does not change until HSWPWM_Std_ReturnTypeCommit
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Channel : channel index , uint16 Copy_uint16DutyTicks : high time 0..SWPWM_PERIOD_TICKS
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void HSWPWM_VoidSetDuty(uint8 Copy_uint8Channel , uint16 Copy_uint16DutyTicks)
+{
+    if(Copy_uint8Channel < SWPWM_NUM_CHANNELS)
+    {
+        if(Copy_uint16DutyTicks > SWPWM_PERIOD_TICKS)
+        {
+            Copy_uint16DutyTicks = SWPWM_PERIOD_TICKS;
+        }
+        SWPWM_uint16Duty[Copy_uint8Channel] = Copy_uint16DutyTicks;
+    }
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType HSWPWM_Std_ReturnTypeCommit(void)
+* \Description     : build the edge schedule of staged duties in the inactive buffer and hand it to the ISR,
+*                    it is swapped in at the next period boundary so outputs never glitch
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK if previous commit is not applied yet (retry later)
+*******************************************************************************/
+Std_ReturnType HSWPWM_Std_ReturnTypeCommit(void)
+{
+    SWPWM_Schedule_t* Local_pInactive;
+    uint8 Local_uint8Itr;
+    if(SWPWM_pPending != NULL)
+    {
+        return N_OK;
+    }
+    /*active cannot change while nothing is pending*/
+    Local_pInactive = (SWPWM_pActive == &SWPWM_Schedules[0]) ? &SWPWM_Schedules[1] : &SWPWM_Schedules[0];
+    HSWPWM_VoidBuildSchedule(SWPWM_uint16Duty,Local_pInactive);
+    for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+    {
+        SWPWM_uint16Committed[Local_uint8Itr] = SWPWM_uint16Duty[Local_uint8Itr];
+    }
+    /*publish last, ISR only reads the buffer after it sees it pending*/
+    SWPWM_pPending = Local_pInactive;
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : uint8 HSWPWM_uint8GetEdgeCount(void)
+* \Description     : number of edge groups in the running schedule = timer interrupts per PWM period
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint8 ISR count per period
+*******************************************************************************/
+uint8 HSWPWM_uint8GetEdgeCount(void)
+{
+    return SWPWM_pActive->EdgeCount;
+}
+
+/******************************************************************************
+* \Syntax          : uint16 HSWPWM_uint16GetMinEdgeGap(void)
+* \Description     : minimum ticks between two edge interrupts at the live HCLK (SWPWM_ISR_CYCLES rounded up to ticks):
+*                    falling edges closer than it share one BSRR write , duties closer to 0% / 100% snap to them
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint16 gap in timer ticks
+*******************************************************************************/
+uint16 HSWPWM_uint16GetMinEdgeGap(void)
+{
+    return SWPWM_uint16MinEdgeGap;
+}
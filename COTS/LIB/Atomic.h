@@ -0,0 +1,277 @@
+/*---------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------
+ *         File:  Atomic.h
+ *       Module:  Atomic
+ *  Description:  lock-free primitives and priority threshold critical sections.
+ *                Cortex-M3: LDREX/STREX loops and BASEPRI , host builds: C11 memory model builtins
+ *                so code using them (ring buffers , counters) also runs under threads on a PC
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef ATOMIC_H
+#define ATOMIC_H
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "Std_Types.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define ATOMIC_TARGET_CORTEX_M      1
+#else
+#define ATOMIC_TARGET_CORTEX_M      0
+#endif
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+/*single core: a DMB orders the stores seen by DMA and by the other side of a queue*/
+#define ATOMIC_FENCE()              __asm__ volatile ("dmb" ::: "memory")
+#else
+#define ATOMIC_FENCE()              __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+#if ATOMIC_TARGET_CORTEX_M == 1
+
+/*exclusive monitor access, STREX returns 0 when the store succeeded. an exception entry/return clears
+  the monitor so an ISR that touched the word makes the interrupted loop retry*/
+static inline uint32 Atomic_uint32LoadExclusive(volatile uint32* Copy_pAddress)
+{
+    uint32 Local_uint32Value;
+    __asm__ volatile ("ldrex %0, [%1]" : "=r" (Local_uint32Value) : "r" (Copy_pAddress) : "memory");
+    return Local_uint32Value;
+}
+
+static inline uint32 Atomic_uint32StoreExclusive(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+{
+    uint32 Local_uint32Failed;
+    __asm__ volatile ("strex %0, %2, [%1]" : "=&r" (Local_uint32Failed) : "r" (Copy_pAddress) , "r" (Copy_uint32Value) : "memory");
+    return Local_uint32Failed;
+}
+
+static inline void Atomic_VoidClearExclusive(void)
+{
+    __asm__ volatile ("clrex" ::: "memory");
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Atomic_uint32FetchAdd(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+* \Description     : *Copy_pAddress += Copy_uint32Value as one indivisible step
+* \Reentrancy      : Reentrant
+* \Return value:   : uint32 value before the add
+*******************************************************************************/
+static inline uint32 Atomic_uint32FetchAdd(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+{
+    uint32 Local_uint32Old;
+    do
+    {
+        Local_uint32Old = Atomic_uint32LoadExclusive(Copy_pAddress);
+    }while(Atomic_uint32StoreExclusive(Copy_pAddress,Local_uint32Old + Copy_uint32Value) != 0);
+    return Local_uint32Old;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Atomic_uint32Exchange(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+* \Description     : store Copy_uint32Value and return the replaced value as one indivisible step
+* \Reentrancy      : Reentrant
+* \Return value:   : uint32 previous value
+*******************************************************************************/
+static inline uint32 Atomic_uint32Exchange(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+{
+    uint32 Local_uint32Old;
+    do
+    {
+        Local_uint32Old = Atomic_uint32LoadExclusive(Copy_pAddress);
+    }while(Atomic_uint32StoreExclusive(Copy_pAddress,Copy_uint32Value) != 0);
+    return Local_uint32Old;
+}
+
+/******************************************************************************
+* \Syntax          : uint8 Atomic_uint8CompareAndSwap(volatile uint32* Copy_pAddress , uint32 Copy_uint32Expected , uint32 Copy_uint32Desired)
+* \Description     : store Copy_uint32Desired only if the word still holds Copy_uint32Expected
+* \Reentrancy      : Reentrant
+* \Return value:   : 1 swapped , 0 the word changed meanwhile
+*******************************************************************************/
+static inline uint8 Atomic_uint8CompareAndSwap(volatile uint32* Copy_pAddress , uint32 Copy_uint32Expected , uint32 Copy_uint32Desired)
+{
+    do
+    {
+        if(Atomic_uint32LoadExclusive(Copy_pAddress) != Copy_uint32Expected)
+        {
+            Atomic_VoidClearExclusive();
+            return 0;
+        }
+    }while(Atomic_uint32StoreExclusive(Copy_pAddress,Copy_uint32Desired) != 0);
+    return 1;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Atomic_uint32FetchOr(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+* \Description     : set the bits of Copy_uint32Mask without disturbing bits changed concurrently
+* \Reentrancy      : Reentrant
+* \Return value:   : uint32 value before the set
+*******************************************************************************/
+static inline uint32 Atomic_uint32FetchOr(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+{
+    uint32 Local_uint32Old;
+    do
+    {
+        Local_uint32Old = Atomic_uint32LoadExclusive(Copy_pAddress);
+    }while(Atomic_uint32StoreExclusive(Copy_pAddress,Local_uint32Old | Copy_uint32Mask) != 0);
+    return Local_uint32Old;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Atomic_uint32FetchAnd(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+* \Description     : keep only the bits of Copy_uint32Mask without disturbing bits changed concurrently
+* \Reentrancy      : Reentrant
+* \Return value:   : uint32 value before the clear
+*******************************************************************************/
+static inline uint32 Atomic_uint32FetchAnd(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+{
+    uint32 Local_uint32Old;
+    do
+    {
+        Local_uint32Old = Atomic_uint32LoadExclusive(Copy_pAddress);
+    }while(Atomic_uint32StoreExclusive(Copy_pAddress,Local_uint32Old & Copy_uint32Mask) != 0);
+    return Local_uint32Old;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Critical_uint32EnterBasepri(uint8 Copy_uint8Threshold)
+* \Description     : mask every interrupt whose encoded priority (NVIC_ENCODE_PRIORITY) is numerically
+*                    >= Copy_uint8Threshold , more urgent ones keep running. BASEPRI_MAX only ever raises the
+*                    masking level so nested sections with a lower threshold do not unmask anything.
+*                    0 means "no masking" to the core , use Critical_uint32EnterAll for a full lock
+* \Reentrancy      : Reentrant (nestable)
+* \Return value:   : uint32 previous BASEPRI for Critical_VoidExitBasepri
+*******************************************************************************/
+static inline uint32 Critical_uint32EnterBasepri(uint8 Copy_uint8Threshold)
+{
+    uint32 Local_uint32Old;
+    __asm__ volatile ("mrs %0, basepri" : "=r" (Local_uint32Old));
+    __asm__ volatile ("msr basepri_max, %0" : : "r" ((uint32)Copy_uint8Threshold) : "memory");
+    return Local_uint32Old;
+}
+
+static inline void Critical_VoidExitBasepri(uint32 Copy_uint32Saved)
+{
+    __asm__ volatile ("msr basepri, %0" : : "r" (Copy_uint32Saved) : "memory");
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Critical_uint32EnterAll(void)
+* \Description     : PRIMASK lock of every configurable interrupt, only for sections shared with priority 0 handlers
+* \Reentrancy      : Reentrant (nestable)
+* \Return value:   : uint32 previous PRIMASK for Critical_VoidExitAll
+*******************************************************************************/
+static inline uint32 Critical_uint32EnterAll(void)
+{
+    uint32 Local_uint32Old;
+    __asm__ volatile ("mrs %0, primask" : "=r" (Local_uint32Old));
+    __asm__ volatile ("cpsid i" ::: "memory");
+    return Local_uint32Old;
+}
+
+static inline void Critical_VoidExitAll(uint32 Copy_uint32Saved)
+{
+    __asm__ volatile ("msr primask, %0" : : "r" (Copy_uint32Saved) : "memory");
+}
+
+#else /*host*/
+
+static inline uint32 Atomic_uint32FetchAdd(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+{
+    return __atomic_fetch_add(Copy_pAddress,Copy_uint32Value,__ATOMIC_SEQ_CST);
+}
+
+static inline uint32 Atomic_uint32Exchange(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+{
+    return __atomic_exchange_n(Copy_pAddress,Copy_uint32Value,__ATOMIC_SEQ_CST);
+}
+
+static inline uint8 Atomic_uint8CompareAndSwap(volatile uint32* Copy_pAddress , uint32 Copy_uint32Expected , uint32 Copy_uint32Desired)
+{
+    return (uint8)__atomic_compare_exchange_n(Copy_pAddress,&Copy_uint32Expected,Copy_uint32Desired,
+                                              0,__ATOMIC_SEQ_CST,__ATOMIC_SEQ_CST);
+}
+
+static inline uint32 Atomic_uint32FetchOr(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+{
+    return __atomic_fetch_or(Copy_pAddress,Copy_uint32Mask,__ATOMIC_SEQ_CST);
+}
+
+static inline uint32 Atomic_uint32FetchAnd(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+{
+    return __atomic_fetch_and(Copy_pAddress,Copy_uint32Mask,__ATOMIC_SEQ_CST);
+}
+
+/*no interrupts on the host: sections only act as compiler/CPU barriers*/
+static inline uint32 Critical_uint32EnterBasepri(uint8 Copy_uint8Threshold)
+{
+    (void)Copy_uint8Threshold;
+    ATOMIC_FENCE();
+    return 0;
+}
+
+static inline void Critical_VoidExitBasepri(uint32 Copy_uint32Saved)
+{
+    (void)Copy_uint32Saved;
+    ATOMIC_FENCE();
+}
+
+static inline uint32 Critical_uint32EnterAll(void)
+{
+    ATOMIC_FENCE();
+    return 0;
+}
+
+static inline void Critical_VoidExitAll(uint32 Copy_uint32Saved)
+{
+    (void)Copy_uint32Saved;
+    ATOMIC_FENCE();
+}
+
+#endif
+
+/*bit set/clear helpers for flag words shared between ISRs and thread code*/
+static inline void Atomic_VoidSetBits(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+{
+    (void)Atomic_uint32FetchOr(Copy_pAddress,Copy_uint32Mask);
+}
+
+static inline void Atomic_VoidClearBits(volatile uint32* Copy_pAddress , uint32 Copy_uint32Mask)
+{
+    (void)Atomic_uint32FetchAnd(Copy_pAddress,~Copy_uint32Mask);
+}
+
+/*ordered load/store pairs: whatever was written before a Release store is visible after the
+  Acquire load that reads it (queue index publication)*/
+static inline uint32 Atomic_uint32LoadAcquire(const volatile uint32* Copy_pAddress)
+{
+    uint32 Local_uint32Value = *Copy_pAddress;
+    ATOMIC_FENCE();
+    return Local_uint32Value;
+}
+
+static inline void Atomic_VoidStoreRelease(volatile uint32* Copy_pAddress , uint32 Copy_uint32Value)
+{
+    ATOMIC_FENCE();
+    *Copy_pAddress = Copy_uint32Value;
+}
+
+/*pointer forms (32-bit pointers on target) for lock-free lists*/
+static inline void* Atomic_pExchangePointer(void* volatile* Copy_pAddress , void* Copy_pValue)
+{
+    return __atomic_exchange_n(Copy_pAddress,Copy_pValue,__ATOMIC_ACQ_REL);
+}
+
+static inline uint8 Atomic_uint8CompareAndSwapPointer(void* volatile* Copy_pAddress , void* Copy_pExpected , void* Copy_pDesired)
+{
+    return (uint8)__atomic_compare_exchange_n(Copy_pAddress,&Copy_pExpected,Copy_pDesired,
+                                              0,__ATOMIC_ACQ_REL,__ATOMIC_RELAXED);
+}
+
+#endif
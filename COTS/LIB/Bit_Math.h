@@ -19,4 +19,7 @@
 // #define CLEAR_BIT(REG,BIT_NUM)      (REG) &= ~(1<<(BIT_NUM))
 #define READ_BIT(REG,BIT_NUM)       (((REG)>>(BIT_NUM))&0x1)
 
+/*index of the highest set bit (REG must not be 0), single CLZ instruction on Cortex-M3*/
+#define GET_MSB_INDEX(REG)          (31 - __builtin_clz(REG))
+
 #endif
@@ -0,0 +1,48 @@
+/*---------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------
+ *         File:  Bus_Types.h
+ *       Module:  Bus Types
+ *  Description:  transport independent SPI/I2C master driver tables, bit-banged (HAL) and hardware (MCAL)
+ *                masters export the same table so application code switches transport by pointer only
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef BUS_TYPES_H
+#define BUS_TYPES_H
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "Std_Types.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*SPI clock polarity/phase*/
+typedef enum
+{
+    SPI_MODE0,      /*CPOL=0 CPHA=0*/
+    SPI_MODE1,      /*CPOL=0 CPHA=1*/
+    SPI_MODE2,      /*CPOL=1 CPHA=0*/
+    SPI_MODE3       /*CPOL=1 CPHA=1*/
+}SPI_Mode_t;
+
+typedef struct
+{
+    void  (*Init)(SPI_Mode_t Copy_Mode);
+    void  (*Select)(void);
+    void  (*Deselect)(void);
+    uint8 (*Transfer)(uint8 Copy_uint8Data);
+    /*Copy_pTx or Copy_pRx may be NULL for receive/transmit only*/
+    void  (*TransferBlock)(const uint8* Copy_pTx , uint8* Copy_pRx , uint16 Copy_uint16Length);
+}SPI_Driver_t;
+
+typedef struct
+{
+    void           (*Init)(void);
+    /*7-bit slave address, return N_OK on NACK or bus timeout*/
+    Std_ReturnType (*Write)(uint8 Copy_uint8Address , const uint8* Copy_pData , uint16 Copy_uint16Length);
+    Std_ReturnType (*Read)(uint8 Copy_uint8Address , uint8* Copy_pData , uint16 Copy_uint16Length);
+    Std_ReturnType (*WriteRead)(uint8 Copy_uint8Address , const uint8* Copy_pTx , uint16 Copy_uint16TxLength ,
+                                uint8* Copy_pRx , uint16 Copy_uint16RxLength);
+}I2C_Driver_t;
+
+#endif
@@ -0,0 +1,37 @@
+/*---------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------
+ *         File:  Compiler.h
+ *       Module:  Compiler
+ *  Description:  code placement attributes
+ *                RAMFUNC : the function is linked in .ramfunc , copied from flash to SRAM by Rest_Handler through
+ *                          the startup init table and executed there without flash wait states.
+ *                          build with RAMFUNC_ENABLE=0 (make RAMFUNC=0) to keep every function in flash , e.g. to
+ *                          compare the cycles of a handler in both places with the PROFILER service
+ *                NOINIT  : the variable is linked in .noinit , neither loaded nor zeroed by Rest_Handler , so it
+ *                          keeps its value across a reset (not across power loss: validate it before use)
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef COMPILER_H
+#define COMPILER_H
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef RAMFUNC_ENABLE
+#define RAMFUNC_ENABLE              1
+#endif
+
+#if RAMFUNC_ENABLE == 1
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+/*SRAM (0x20000000) is out of BL range from flash (0x08000000): callers load the address and use BLX ,
+  calls from SRAM back to flash go through veneers inserted by the linker*/
+#define RAMFUNC                     __attribute__((section(".ramfunc") , long_call))
+#else
+#define RAMFUNC                     __attribute__((section(".ramfunc")))
+#endif
+#else
+#define RAMFUNC
+#endif
+
+#define NOINIT                      __attribute__((section(".noinit")))
+
+#endif
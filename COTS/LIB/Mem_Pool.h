@@ -0,0 +1,381 @@
+/*---------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------
+ *         File:  Mem_Pool.h
+ *       Module:  Memory Pool
+ *  Description:  static memory allocators on top of Atomic.h , no general purpose heap and no fragmentation
+ *                Arena : bump region that hands out memory at init time and never frees it , the linker script
+ *                        reserves one for the whole application (.heap , Mem_VoidArenaInitHeap)
+ *                Pool  : fixed size blocks carved from an arena , O(1) alloc/free through a two level free bitmap
+ *                        (one summary bit per map word , CLZ on both levels) , up to 1024 blocks
+ *                Bump  : scratch region carved from an arena , allocations are released together by going back
+ *                        to a mark (per message / per frame scratch space)
+ *                every call may be made from thread and ISR code , the bookkeeping runs with interrupts masked
+ *                for a few instructions. each allocator keeps its usage statistics (Mem_Stats_t)
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "Std_Types.h"
+#include "Bit_Math.h"
+#include "Atomic.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*every block and allocation is aligned for the widest type (uint64 , AAPCS 8 bytes)*/
+#define MEM_ALIGNMENT               8UL
+#define MEM_ALIGN_UP(SIZE)          (((uint32)(SIZE) + (MEM_ALIGNMENT - 1)) & ~(MEM_ALIGNMENT - 1))
+
+/*two level bitmap: 32 map words of 32 blocks*/
+#define MEM_POOL_MAX_BLOCKS         1024
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint8*              Base;
+    uint8*              Next;           /*first free byte*/
+    uint8*              End;
+}Mem_Arena_t;
+
+typedef struct
+{
+    uint8*              Base;
+    uint32              BlockSize;      /*rounded up to MEM_ALIGNMENT*/
+    uint32              Blocks;
+    uint32*             FreeMap;        /*bit b of word w set: block w * 32 + b is free*/
+    uint32              Summary;        /*bit w set: FreeMap[w] has a free block*/
+    uint32              InUse;
+    uint32              Peak;
+    uint32              Failures;
+}Mem_Pool_t;
+
+typedef struct
+{
+    uint8*              Base;
+    uint32              Size;
+    uint32              Used;
+    uint32              Peak;
+    uint32              Failures;
+}Mem_Bump_t;
+
+/*pools count blocks , arenas and bumps count bytes*/
+typedef struct
+{
+    uint32              Capacity;
+    uint32              InUse;
+    uint32              Peak;
+    uint32              Failures;       /*requests that could not be served*/
+}Mem_Stats_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*heap region of the linker script*/
+extern uint32 _S_heap;
+extern uint32 _E_heap;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void Mem_VoidArenaInit(Mem_Arena_t* Copy_pArena , void* Copy_pStorage , uint32 Copy_uint32Size)
+* \Description     : bind an arena to a RAM region (the first MEM_ALIGNMENT boundary inside it)
+* \Reentrancy      : Non Reentrant
+*******************************************************************************/
+static inline void Mem_VoidArenaInit(Mem_Arena_t* Copy_pArena , void* Copy_pStorage , uint32 Copy_uint32Size)
+{
+    uint32 Local_uint32Start = MEM_ALIGN_UP(Copy_pStorage);
+    uint32 Local_uint32End = (uint32)Copy_pStorage + Copy_uint32Size;
+
+    if(Local_uint32Start > Local_uint32End)
+    {
+        Local_uint32Start = Local_uint32End;
+    }
+    Copy_pArena->Base = (uint8*)Local_uint32Start;
+    Copy_pArena->Next = (uint8*)Local_uint32Start;
+    Copy_pArena->End = (uint8*)Local_uint32End;
+}
+
+/******************************************************************************
+* \Syntax          : void Mem_VoidArenaInitHeap(Mem_Arena_t* Copy_pArena)
+* \Description     : bind an arena to the .heap region of the linker script (size: --defsym=_heap_size=...)
+* \Reentrancy      : Non Reentrant
+*******************************************************************************/
+static inline void Mem_VoidArenaInitHeap(Mem_Arena_t* Copy_pArena)
+{
+    Mem_VoidArenaInit(Copy_pArena,&_S_heap,(uint32)((uint8*)&_E_heap - (uint8*)&_S_heap));
+}
+
+/******************************************************************************
+* \Syntax          : void* Mem_pArenaAlloc(Mem_Arena_t* Copy_pArena , uint32 Copy_uint32Size)
+* \Description     : take MEM_ALIGNMENT aligned memory for the rest of the run (buffers , pools , scratch regions)
+* \Reentrancy      : Reentrant
+* \Return value:   : address , NULL arena exhausted
+*******************************************************************************/
+static inline void* Mem_pArenaAlloc(Mem_Arena_t* Copy_pArena , uint32 Copy_uint32Size)
+{
+    uint8* Local_pBlock = NULL;
+    uint32 Local_uint32Saved;
+
+    Copy_uint32Size = MEM_ALIGN_UP(Copy_uint32Size);
+    Local_uint32Saved = Critical_uint32EnterAll();
+    if((Copy_uint32Size != 0) && (Copy_uint32Size <= (uint32)(Copy_pArena->End - Copy_pArena->Next)))
+    {
+        Local_pBlock = Copy_pArena->Next;
+        Copy_pArena->Next += Copy_uint32Size;
+    }
+    Critical_VoidExitAll(Local_uint32Saved);
+    return Local_pBlock;
+}
+
+/******************************************************************************
+* \Syntax          : Mem_Stats_t Mem_ArenaGetStats(const Mem_Arena_t* Copy_pArena)
+* \Description     : bytes of the arena handed out (Peak = InUse , an arena never frees)
+* \Reentrancy      : Reentrant
+*******************************************************************************/
+static inline Mem_Stats_t Mem_ArenaGetStats(const Mem_Arena_t* Copy_pArena)
+{
+    Mem_Stats_t Local_Stats;
+
+    Local_Stats.Capacity = (uint32)(Copy_pArena->End - Copy_pArena->Base);
+    Local_Stats.InUse = (uint32)(Copy_pArena->Next - Copy_pArena->Base);
+    Local_Stats.Peak = Local_Stats.InUse;
+    Local_Stats.Failures = 0;
+    return Local_Stats;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Mem_Std_ReturnTypePoolInit(Mem_Pool_t* Copy_pPool , Mem_Arena_t* Copy_pArena ,
+*                                                              uint32 Copy_uint32BlockSize , uint32 Copy_uint32Blocks)
+* \Description     : carve the blocks and the free map of a pool from an arena , every block free
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_uint32Blocks : 1 .. MEM_POOL_MAX_BLOCKS
+* \Return value:   : OK , N_OK invalid size or arena exhausted
+*******************************************************************************/
+static inline Std_ReturnType Mem_Std_ReturnTypePoolInit(Mem_Pool_t* Copy_pPool , Mem_Arena_t* Copy_pArena ,
+                                                        uint32 Copy_uint32BlockSize , uint32 Copy_uint32Blocks)
+{
+    uint32 Local_uint32Words = (Copy_uint32Blocks + 31) / 32;
+    uint32 Local_uint32Itr;
+
+    Copy_pPool->Blocks = 0;
+    Copy_pPool->Summary = 0;
+    if((Copy_uint32BlockSize == 0) || (Copy_uint32Blocks == 0) || (Copy_uint32Blocks > MEM_POOL_MAX_BLOCKS))
+    {
+        return N_OK;
+    }
+    Copy_pPool->BlockSize = MEM_ALIGN_UP(Copy_uint32BlockSize);
+    Copy_pPool->FreeMap = (uint32*)Mem_pArenaAlloc(Copy_pArena,Local_uint32Words * sizeof(uint32));
+    Copy_pPool->Base = (uint8*)Mem_pArenaAlloc(Copy_pArena,Copy_pPool->BlockSize * Copy_uint32Blocks);
+    if((Copy_pPool->FreeMap == NULL) || (Copy_pPool->Base == NULL))
+    {
+        return N_OK;
+    }
+    for(Local_uint32Itr = 0; Local_uint32Itr < Local_uint32Words; Local_uint32Itr++)
+    {
+        Copy_pPool->FreeMap[Local_uint32Itr] = 0xFFFFFFFFUL;
+    }
+    if((Copy_uint32Blocks % 32) != 0)
+    {
+        /*bits past the last block never become free*/
+        Copy_pPool->FreeMap[Local_uint32Words - 1] = (1UL << (Copy_uint32Blocks % 32)) - 1;
+    }
+    Copy_pPool->Summary = (Local_uint32Words == 32) ? 0xFFFFFFFFUL : ((1UL << Local_uint32Words) - 1);
+    Copy_pPool->Blocks = Copy_uint32Blocks;
+    Copy_pPool->InUse = 0;
+    Copy_pPool->Peak = 0;
+    Copy_pPool->Failures = 0;
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void* Mem_pPoolAlloc(Mem_Pool_t* Copy_pPool)
+* \Description     : take one block , O(1): CLZ of the summary picks a map word , CLZ of that word a block
+* \Reentrancy      : Reentrant
+* \Return value:   : block address , NULL pool empty
+*******************************************************************************/
+static inline void* Mem_pPoolAlloc(Mem_Pool_t* Copy_pPool)
+{
+    uint8* Local_pBlock = NULL;
+    uint32 Local_uint32Saved;
+    uint32 Local_uint32Word;
+    uint32 Local_uint32Bit;
+
+    Local_uint32Saved = Critical_uint32EnterAll();
+    if(Copy_pPool->Summary == 0)
+    {
+        Copy_pPool->Failures++;
+    }
+    else
+    {
+        Local_uint32Word = GET_MSB_INDEX(Copy_pPool->Summary);
+        Local_uint32Bit = GET_MSB_INDEX(Copy_pPool->FreeMap[Local_uint32Word]);
+        Copy_pPool->FreeMap[Local_uint32Word] &= ~(1UL << Local_uint32Bit);
+        if(Copy_pPool->FreeMap[Local_uint32Word] == 0)
+        {
+            Copy_pPool->Summary &= ~(1UL << Local_uint32Word);
+        }
+        Local_pBlock = Copy_pPool->Base + (((Local_uint32Word * 32) + Local_uint32Bit) * Copy_pPool->BlockSize);
+        Copy_pPool->InUse++;
+        if(Copy_pPool->InUse > Copy_pPool->Peak)
+        {
+            Copy_pPool->Peak = Copy_pPool->InUse;
+        }
+    }
+    Critical_VoidExitAll(Local_uint32Saved);
+    return Local_pBlock;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Mem_Std_ReturnTypePoolFree(Mem_Pool_t* Copy_pPool , void* Copy_pBlock)
+* \Description     : give a block back , O(1)
+* \Reentrancy      : Reentrant
+* \Return value:   : OK , N_OK not a block of this pool or already free
+*******************************************************************************/
+static inline Std_ReturnType Mem_Std_ReturnTypePoolFree(Mem_Pool_t* Copy_pPool , void* Copy_pBlock)
+{
+    Std_ReturnType Local_Std_ReturnTypeState = N_OK;
+    uint32 Local_uint32Offset = (uint32)((uint8*)Copy_pBlock - Copy_pPool->Base);
+    uint32 Local_uint32Index;
+    uint32 Local_uint32Mask;
+    uint32 Local_uint32Saved;
+
+    if(((uint8*)Copy_pBlock < Copy_pPool->Base) || ((Local_uint32Offset % Copy_pPool->BlockSize) != 0))
+    {
+        return N_OK;
+    }
+    Local_uint32Index = Local_uint32Offset / Copy_pPool->BlockSize;
+    if(Local_uint32Index >= Copy_pPool->Blocks)
+    {
+        return N_OK;
+    }
+    Local_uint32Mask = 1UL << (Local_uint32Index % 32);
+    Local_uint32Saved = Critical_uint32EnterAll();
+    if((Copy_pPool->FreeMap[Local_uint32Index / 32] & Local_uint32Mask) == 0)
+    {
+        Copy_pPool->FreeMap[Local_uint32Index / 32] |= Local_uint32Mask;
+        Copy_pPool->Summary |= (1UL << (Local_uint32Index / 32));
+        Copy_pPool->InUse--;
+        Local_Std_ReturnTypeState = OK;
+    }
+    Critical_VoidExitAll(Local_uint32Saved);
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : Mem_Stats_t Mem_PoolGetStats(const Mem_Pool_t* Copy_pPool)
+* \Description     : blocks in use , most blocks ever in use and failed allocations (a snapshot)
+* \Reentrancy      : Reentrant
+*******************************************************************************/
+static inline Mem_Stats_t Mem_PoolGetStats(const Mem_Pool_t* Copy_pPool)
+{
+    Mem_Stats_t Local_Stats;
+
+    Local_Stats.Capacity = Copy_pPool->Blocks;
+    Local_Stats.InUse = Copy_pPool->InUse;
+    Local_Stats.Peak = Copy_pPool->Peak;
+    Local_Stats.Failures = Copy_pPool->Failures;
+    return Local_Stats;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Mem_Std_ReturnTypeBumpInit(Mem_Bump_t* Copy_pBump , Mem_Arena_t* Copy_pArena ,
+*                                                              uint32 Copy_uint32Size)
+* \Description     : carve a scratch region from an arena
+* \Reentrancy      : Non Reentrant
+* \Return value:   : OK , N_OK arena exhausted
+*******************************************************************************/
+static inline Std_ReturnType Mem_Std_ReturnTypeBumpInit(Mem_Bump_t* Copy_pBump , Mem_Arena_t* Copy_pArena , uint32 Copy_uint32Size)
+{
+    Copy_pBump->Size = MEM_ALIGN_UP(Copy_uint32Size);
+    Copy_pBump->Base = (uint8*)Mem_pArenaAlloc(Copy_pArena,Copy_pBump->Size);
+    Copy_pBump->Used = 0;
+    Copy_pBump->Peak = 0;
+    Copy_pBump->Failures = 0;
+    if(Copy_pBump->Base == NULL)
+    {
+        Copy_pBump->Size = 0;
+        return N_OK;
+    }
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void* Mem_pBumpAlloc(Mem_Bump_t* Copy_pBump , uint32 Copy_uint32Size)
+* \Description     : take MEM_ALIGNMENT aligned scratch memory , released by Mem_VoidBumpReset
+* \Reentrancy      : Reentrant
+* \Return value:   : address , NULL region full
+*******************************************************************************/
+static inline void* Mem_pBumpAlloc(Mem_Bump_t* Copy_pBump , uint32 Copy_uint32Size)
+{
+    uint8* Local_pBlock = NULL;
+    uint32 Local_uint32Saved;
+
+    Copy_uint32Size = MEM_ALIGN_UP(Copy_uint32Size);
+    Local_uint32Saved = Critical_uint32EnterAll();
+    if((Copy_uint32Size != 0) && (Copy_uint32Size <= (Copy_pBump->Size - Copy_pBump->Used)))
+    {
+        Local_pBlock = Copy_pBump->Base + Copy_pBump->Used;
+        Copy_pBump->Used += Copy_uint32Size;
+        if(Copy_pBump->Used > Copy_pBump->Peak)
+        {
+            Copy_pBump->Peak = Copy_pBump->Used;
+        }
+    }
+    else
+    {
+        Copy_pBump->Failures++;
+    }
+    Critical_VoidExitAll(Local_uint32Saved);
+    return Local_pBlock;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Mem_uint32BumpMark(const Mem_Bump_t* Copy_pBump)
+* \Description     : current fill level , pass it to Mem_VoidBumpReset to release what is allocated after it
+* \Reentrancy      : Reentrant
+*******************************************************************************/
+static inline uint32 Mem_uint32BumpMark(const Mem_Bump_t* Copy_pBump)
+{
+    return Copy_pBump->Used;
+}
+
+/******************************************************************************
+* \Syntax          : void Mem_VoidBumpReset(Mem_Bump_t* Copy_pBump , uint32 Copy_uint32Mark)
+* \Description     : release every allocation made after the mark (0: the whole region). a mark above the
+*                    current level is ignored. the owner of the scratch space calls it once its user is done
+* \Reentrancy      : Reentrant
+*******************************************************************************/
+static inline void Mem_VoidBumpReset(Mem_Bump_t* Copy_pBump , uint32 Copy_uint32Mark)
+{
+    uint32 Local_uint32Saved = Critical_uint32EnterAll();
+
+    if(Copy_uint32Mark <= Copy_pBump->Used)
+    {
+        Copy_pBump->Used = Copy_uint32Mark;
+    }
+    Critical_VoidExitAll(Local_uint32Saved);
+}
+
+/******************************************************************************
+* \Syntax          : Mem_Stats_t Mem_BumpGetStats(const Mem_Bump_t* Copy_pBump)
+* \Description     : bytes in use , highest fill level and failed allocations (a snapshot)
+* \Reentrancy      : Reentrant
+*******************************************************************************/
+static inline Mem_Stats_t Mem_BumpGetStats(const Mem_Bump_t* Copy_pBump)
+{
+    Mem_Stats_t Local_Stats;
+
+    Local_Stats.Capacity = Copy_pBump->Size;
+    Local_Stats.InUse = Copy_pBump->Used;
+    Local_Stats.Peak = Copy_pBump->Peak;
+    Local_Stats.Failures = Copy_pBump->Failures;
+    return Local_Stats;
+}
+
+#endif
@@ -0,0 +1,183 @@
+/*---------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------
+ *         File:  Ring_Buffer.h
+ *       Module:  Ring Buffer
+ *  Description:  lock-free bounded queues of fixed size elements on top of Atomic.h
+ *                SPSC : one producer and one consumer (ISR -> thread or thread -> ISR) , no read-modify-write at all
+ *                MPSC : any number of producers at any priority , one consumer , per slot sequence numbers
+ *                       (bounded queue of D. Vyukov) so a preempted producer never blocks the others
+ *                capacity is a power of 2 , head and tail are free running counters
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "Std_Types.h"
+#include "Atomic.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint8*              Buffer;         /*Capacity * ElementSize bytes*/
+    uint32              ElementSize;
+    uint32              Mask;           /*Capacity - 1*/
+    volatile uint32     Head;           /*next slot to write*/
+    volatile uint32     Tail;           /*next slot to read*/
+    volatile uint32*    Sequence;       /*MPSC only: Capacity words , NULL for SPSC*/
+}Ring_Buffer_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*no libc on target: element copy byte by byte (elements are a few bytes)*/
+static inline void Ring_VoidCopy(uint8* Copy_pDestination , const uint8* Copy_pSource , uint32 Copy_uint32Size)
+{
+    while(Copy_uint32Size-- != 0)
+    {
+        *Copy_pDestination++ = *Copy_pSource++;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void Ring_VoidInit(Ring_Buffer_t* Copy_pRing , void* Copy_pStorage , uint32 Copy_uint32ElementSize ,
+*                                       uint32 Copy_uint32Capacity , volatile uint32* Copy_pSequence)
+* \Description     : bind a ring to its storage, Copy_pSequence (Capacity words) for MPSC use or NULL for SPSC.
+*                    call before either side touches the ring
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_uint32Capacity : power of 2
+*******************************************************************************/
+static inline void Ring_VoidInit(Ring_Buffer_t* Copy_pRing , void* Copy_pStorage , uint32 Copy_uint32ElementSize ,
+                                 uint32 Copy_uint32Capacity , volatile uint32* Copy_pSequence)
+{
+    uint32 Local_uint32Itr;
+
+    Copy_pRing->Buffer = (uint8*)Copy_pStorage;
+    Copy_pRing->ElementSize = Copy_uint32ElementSize;
+    Copy_pRing->Mask = Copy_uint32Capacity - 1;
+    Copy_pRing->Head = 0;
+    Copy_pRing->Tail = 0;
+    Copy_pRing->Sequence = Copy_pSequence;
+    if(Copy_pSequence != NULL)
+    {
+        /*slot i is free for the producer of position i*/
+        for(Local_uint32Itr = 0; Local_uint32Itr < Copy_uint32Capacity; Local_uint32Itr++)
+        {
+            Copy_pSequence[Local_uint32Itr] = Local_uint32Itr;
+        }
+    }
+    ATOMIC_FENCE();
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Ring_Std_ReturnTypeSpscPush(Ring_Buffer_t* Copy_pRing , const void* Copy_pElement)
+* \Description     : copy one element in, producer side of an SPSC ring
+* \Reentrancy      : Non Reentrant (single producer)
+* \Return value:   : OK , N_OK ring full
+*******************************************************************************/
+static inline Std_ReturnType Ring_Std_ReturnTypeSpscPush(Ring_Buffer_t* Copy_pRing , const void* Copy_pElement)
+{
+    uint32 Local_uint32Head = Copy_pRing->Head;
+
+    if((Local_uint32Head - Atomic_uint32LoadAcquire(&Copy_pRing->Tail)) > Copy_pRing->Mask)
+    {
+        return N_OK;
+    }
+    Ring_VoidCopy(&Copy_pRing->Buffer[(Local_uint32Head & Copy_pRing->Mask) * Copy_pRing->ElementSize],
+                  (const uint8*)Copy_pElement,Copy_pRing->ElementSize);
+    Atomic_VoidStoreRelease(&Copy_pRing->Head,Local_uint32Head + 1);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Ring_Std_ReturnTypeSpscPop(Ring_Buffer_t* Copy_pRing , void* Copy_pElement)
+* \Description     : copy the oldest element out, consumer side of an SPSC ring
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Return value:   : OK , N_OK ring empty
+*******************************************************************************/
+static inline Std_ReturnType Ring_Std_ReturnTypeSpscPop(Ring_Buffer_t* Copy_pRing , void* Copy_pElement)
+{
+    uint32 Local_uint32Tail = Copy_pRing->Tail;
+
+    if(Local_uint32Tail == Atomic_uint32LoadAcquire(&Copy_pRing->Head))
+    {
+        return N_OK;
+    }
+    Ring_VoidCopy((uint8*)Copy_pElement,
+                  &Copy_pRing->Buffer[(Local_uint32Tail & Copy_pRing->Mask) * Copy_pRing->ElementSize],Copy_pRing->ElementSize);
+    Atomic_VoidStoreRelease(&Copy_pRing->Tail,Local_uint32Tail + 1);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Ring_Std_ReturnTypeMpscPush(Ring_Buffer_t* Copy_pRing , const void* Copy_pElement)
+* \Description     : claim a position with CAS on Head, fill the slot then publish it through its sequence word.
+*                    callable from any ISR priority and from thread code concurrently
+* \Reentrancy      : Reentrant
+* \Return value:   : OK , N_OK ring full
+*******************************************************************************/
+static inline Std_ReturnType Ring_Std_ReturnTypeMpscPush(Ring_Buffer_t* Copy_pRing , const void* Copy_pElement)
+{
+    uint32 Local_uint32Position;
+    uint32 Local_uint32Index;
+    sint32 Local_sint32Distance;
+
+    do
+    {
+        Local_uint32Position = Copy_pRing->Head;
+        Local_uint32Index = Local_uint32Position & Copy_pRing->Mask;
+        Local_sint32Distance = (sint32)(Atomic_uint32LoadAcquire(&Copy_pRing->Sequence[Local_uint32Index]) - Local_uint32Position);
+        if(Local_sint32Distance < 0)
+        {
+            /*slot still holds the element of the previous lap*/
+            return N_OK;
+        }
+    }while((Local_sint32Distance != 0) ||
+           (Atomic_uint8CompareAndSwap(&Copy_pRing->Head,Local_uint32Position,Local_uint32Position + 1) == 0));
+
+    Ring_VoidCopy(&Copy_pRing->Buffer[Local_uint32Index * Copy_pRing->ElementSize],
+                  (const uint8*)Copy_pElement,Copy_pRing->ElementSize);
+    Atomic_VoidStoreRelease(&Copy_pRing->Sequence[Local_uint32Index],Local_uint32Position + 1);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType Ring_Std_ReturnTypeMpscPop(Ring_Buffer_t* Copy_pRing , void* Copy_pElement)
+* \Description     : copy the oldest published element out and hand its slot to the next lap.
+*                    N_OK is also returned while the oldest slot is claimed but not yet published
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Return value:   : OK , N_OK nothing published
+*******************************************************************************/
+static inline Std_ReturnType Ring_Std_ReturnTypeMpscPop(Ring_Buffer_t* Copy_pRing , void* Copy_pElement)
+{
+    uint32 Local_uint32Tail = Copy_pRing->Tail;
+    uint32 Local_uint32Index = Local_uint32Tail & Copy_pRing->Mask;
+
+    if(Atomic_uint32LoadAcquire(&Copy_pRing->Sequence[Local_uint32Index]) != (Local_uint32Tail + 1))
+    {
+        return N_OK;
+    }
+    Ring_VoidCopy((uint8*)Copy_pElement,
+                  &Copy_pRing->Buffer[Local_uint32Index * Copy_pRing->ElementSize],Copy_pRing->ElementSize);
+    Copy_pRing->Tail = Local_uint32Tail + 1;
+    Atomic_VoidStoreRelease(&Copy_pRing->Sequence[Local_uint32Index],Local_uint32Tail + Copy_pRing->Mask + 1);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 Ring_uint32Count(const Ring_Buffer_t* Copy_pRing)
+* \Description     : elements claimed and not yet taken (a snapshot, may change right after)
+* \Reentrancy      : Reentrant
+*******************************************************************************/
+static inline uint32 Ring_uint32Count(const Ring_Buffer_t* Copy_pRing)
+{
+    return Copy_pRing->Head - Copy_pRing->Tail;
+}
+
+#endif
@@ -23,7 +23,7 @@
 #include "AFIO_private.h"
 #include "AFIO_interface.h"
 
-#include "GPIO_interface.h"
+#include "../GPIO/GPIO_interface.h"
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTION Implemention
@@ -45,6 +45,12 @@
  * 					 CAN_1MBPS
  	 	 	 	 	 	 	 	 	 	 	 	 *************************/
 #define BAUDRATE		CAN_500Kbps
+
+/*frames buffered between the FIFO0 interrupt and MCAN_Std_ReturnTypeReadMessage (power of 2)*/
+#define CAN_RX_QUEUE_SIZE       16
+
+/*longest wait for a mode change acknowledge (SLAK/INAK) in microseconds, init is abandoned after it*/
+#define CAN_MODE_TIMEOUT_US     10000UL
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
 ---------------------------------------------------------------------------------------------------------------------*/
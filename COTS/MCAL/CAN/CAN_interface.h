@@ -18,6 +18,7 @@
 ---------------------------------------------------------------------------------------------------------------------*/
 #include "../../LIB//Std_Types.h"
 #include "../../LIB//Bit_Math.h"
+#include "../../LIB/Compiler.h"
 
 #include "CAN_private.h"
 #include "CAN_config.h"
@@ -113,6 +114,13 @@ typedef struct
 
 }CAN_RX_Frame_t;
 
+/*received frame with its payload, element of the interrupt driven receive queue*/
+typedef struct
+{
+  CAN_RX_Frame_t Frame;
+  uint8 Data[8];
+}CAN_RX_Message_t;
+
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTIONS
 ---------------------------------------------------------------------------------------------------------------------*/
@@ -158,5 +166,39 @@ void MCAN_VoidTransmission(CAN_TX_Frame_t * TXframe,uint8 Data[]);
 * \Parameters (out): CAN_RX_Frame * RXframe , Data array represent the data bytes                                                      
 * \Return value:   : None
 *******************************************************************************/
-void MCAN_VoidReception(uint8 RX_FIFO,CAN_RX_Frame_t * RXframe,uint8 Data[]);
+RAMFUNC void MCAN_VoidReception(uint8 RX_FIFO,CAN_RX_Frame_t * RXframe,uint8 Data[]);
+
+/******************************************************************************
+* \Syntax          : void MCAN_VoidEnableRxInterrupt(void)
+* \Description     : empty the receive queue and enable the FIFO0 message pending interrupt, the ISR moves
+*                    every frame into a lock-free queue (USB_LP_CAN_RX0 must be enabled in the NVIC by the application)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MCAN_VoidEnableRxInterrupt(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MCAN_Std_ReturnTypeReadMessage(CAN_RX_Message_t* Copy_pMessage)
+* \Description     : take the oldest frame received by the FIFO0 interrupt, no interrupt masking needed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): CAN_RX_Message_t* Copy_pMessage
+* \Return value:   : OK frame returned , N_OK queue empty
+*******************************************************************************/
+Std_ReturnType MCAN_Std_ReturnTypeReadMessage(CAN_RX_Message_t* Copy_pMessage);
+
+/******************************************************************************
+* \Syntax          : uint32 MCAN_uint32GetRxOverruns(void)
+* \Description     : number of frames dropped because the receive queue was full
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 dropped frames
+*******************************************************************************/
+uint32 MCAN_uint32GetRxOverruns(void);
 #endif
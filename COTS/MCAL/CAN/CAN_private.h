@@ -27,18 +27,21 @@
 /*Bit rate*/
 enum BITRATE{CAN_50Kbps, CAN_100Kbps, CAN_125Kbps, CAN_250Kbps, CAN_500Kbps, CAN_800Kbps, CAN_1Mbps};
 
-typedef const struct
-{
-	uint8 TS2;
-	uint8 TS1;
-	uint8 BRP;
-} CAN_BitTimingConfig;
-
-/******** BoudRate value rating to table at web site {http://www.bittiming.can-wiki.info/}
- * 1. select ST Microelectronics bxCAN
- * 2. put freq with 8Mhz (APB1 freq)
- * 3. click Request Table						        ***********************************/
-CAN_BitTimingConfig CAN_bitRateConfig[7] = {{2, 13, 10}, {2, 13, 5}, {2, 13, 4}, {2, 13, 2}, {2, 13, 1},{1, 8, 1}, {1, 6, 1}};
+/*bit rates of the enum above in bits per second*/
+#define CAN_BIT_RATES_BPS       {50000UL, 100000UL, 125000UL, 250000UL, 500000UL, 800000UL, 1000000UL}
+
+/******** bit timing derived from the live APB1 clock (MRCC_u32GetPclk1):
+ * bit = 1 (sync) + TS1 + TS2 time quanta , tq = BRP / PCLK1 , sample point after 1 + TS1 quanta
+ * bxCAN limits: TS1 1..16 , TS2 1..8 , BRP 1..1024                    ***********************************/
+#define CAN_MIN_QUANTA          8UL
+#define CAN_MAX_QUANTA          25UL
+#define CAN_MAX_TS1             16UL
+#define CAN_MAX_TS2             8UL
+#define CAN_MAX_BRP             1024UL
+/*BTR fields written by the timing: TS2 , TS1 , BRP (mode and SJW bits are kept)*/
+#define CAN_BTR_TIMING_MASK     0x007F03FFUL
+/*target sample point in 1/1000 of the bit (CiA recommendation)*/
+#define CAN_SAMPLE_POINT_PERMILLE   875UL
 
 
 /*CAN registers definitions*/
@@ -26,6 +26,129 @@
 #include "../GPIO/GPIO_interface.h"
 #include "../RCC/RCC_interface.h"
 #include "../AFIO/AFIO_interface.h"
+#include "../SYSTick/SYSTick_interface.h"
+#include "../../LIB/Ring_Buffer.h"
+
+#if (CAN_RX_QUEUE_SIZE & (CAN_RX_QUEUE_SIZE - 1)) != 0
+#error "CAN_RX_QUEUE_SIZE must be a power of 2"
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*FIFO0 ISR produces , application consumes: single producer single consumer queue*/
+static CAN_RX_Message_t can_rx_messages[CAN_RX_QUEUE_SIZE];
+static Ring_Buffer_t can_rx_ring;
+static volatile uint32 can_rx_overruns = 0;
+
+static const uint32 can_bit_rates[] = CAN_BIT_RATES_BPS;
+/*the node left initialization mode before a clock change and goes back to it after*/
+static uint8 can_clock_hold = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*BTR timing fields for a bit rate: among the quanta counts that divide the APB1 clock exactly the one with the sample
+  point closest to CAN_SAMPLE_POINT_PERMILLE (more quanta on a tie) , N_OK when the clock has no exact divisor*/
+static Std_ReturnType MCAN_Std_ReturnTypeBitTiming(uint32 Copy_uint32Pclk , uint32 Copy_uint32BitRate , uint32* Copy_pBtr)
+{
+    uint32 Local_uint32Quanta;
+    uint32 Local_uint32Brp;
+    uint32 Local_uint32Sample;
+    uint32 Local_uint32Error;
+    uint32 Local_uint32BestError = 0xFFFFFFFFUL;
+
+    for(Local_uint32Quanta = CAN_MAX_QUANTA; Local_uint32Quanta >= CAN_MIN_QUANTA; Local_uint32Quanta--)
+    {
+        if((Copy_uint32Pclk % (Copy_uint32BitRate * Local_uint32Quanta)) != 0)
+        {
+            continue;
+        }
+        Local_uint32Brp = Copy_uint32Pclk / (Copy_uint32BitRate * Local_uint32Quanta);
+        if(Local_uint32Brp > CAN_MAX_BRP)
+        {
+            continue;
+        }
+        /*quanta up to the sample point (sync + TS1) , rounded then kept inside the TS1 / TS2 ranges*/
+        Local_uint32Sample = ((Local_uint32Quanta * CAN_SAMPLE_POINT_PERMILLE) + 500UL) / 1000UL;
+        if(Local_uint32Sample > (1UL + CAN_MAX_TS1))
+        {
+            Local_uint32Sample = 1UL + CAN_MAX_TS1;
+        }
+        if((Local_uint32Quanta - Local_uint32Sample) > CAN_MAX_TS2)
+        {
+            Local_uint32Sample = Local_uint32Quanta - CAN_MAX_TS2;
+        }
+        /*distance from the target in 1/10000 of the bit*/
+        Local_uint32Error = (Local_uint32Sample * 10000UL) / Local_uint32Quanta;
+        Local_uint32Error = (Local_uint32Error > (CAN_SAMPLE_POINT_PERMILLE * 10UL)) ?
+                            (Local_uint32Error - (CAN_SAMPLE_POINT_PERMILLE * 10UL)) : ((CAN_SAMPLE_POINT_PERMILLE * 10UL) - Local_uint32Error);
+        if(Local_uint32Error < Local_uint32BestError)
+        {
+            Local_uint32BestError = Local_uint32Error;
+            *Copy_pBtr = ((Local_uint32Quanta - Local_uint32Sample - 1UL) << 20) | ((Local_uint32Sample - 2UL) << 16) |
+                         (Local_uint32Brp - 1UL);
+        }
+    }
+    return (Local_uint32BestError == 0xFFFFFFFFUL) ? N_OK : OK;
+}
+
+/*set INRQ (1) or clear it (0) and wait for INAK to follow , N_OK after CAN_MODE_TIMEOUT_US*/
+static Std_ReturnType MCAN_Std_ReturnTypeRequestInit(uint8 Copy_uint8Init)
+{
+    uint64 Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+
+    if(Copy_uint8Init == 1)
+    {
+        SET_BIT(CAN_Control->MCR,0);
+    }
+    else
+    {
+        CLEAR_BIT(CAN_Control->MCR,0);
+    }
+    while(READ_BIT(CAN_Control->MSR,0) != Copy_uint8Init)
+    {
+        if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,CAN_MODE_TIMEOUT_US))
+        {
+            return N_OK;
+        }
+    }
+    return OK;
+}
+
+/*clock change: the node goes to initialization mode before the switch (the frame on the bus completes first) ,
+  the bit timing follows the new APB1 clock and the node rejoins the bus. no exact timing: it stays off the bus*/
+static void MCAN_VoidClockChanged(uint8 Copy_uint8Event)
+{
+    uint32 Local_uint32Timing;
+
+    if(Copy_uint8Event == RCC_CLOCK_PRE_CHANGE)
+    {
+        can_clock_hold = 0;
+        if((READ_BIT(CAN_Control->MSR,0) == 0) && (MCAN_Std_ReturnTypeRequestInit(1) == OK))
+        {
+            can_clock_hold = 1;
+        }
+    }
+    else if(READ_BIT(CAN_Control->MSR,0) == 1)
+    {
+        /*BTR is writable in initialization mode only*/
+        if(MCAN_Std_ReturnTypeBitTiming(MRCC_u32GetPclk1(),can_bit_rates[BAUDRATE],&Local_uint32Timing) == N_OK)
+        {
+            return;
+        }
+        CAN_Control->BTR = (CAN_Control->BTR & ~CAN_BTR_TIMING_MASK) | Local_uint32Timing;
+        if(can_clock_hold == 1)
+        {
+            (void)MCAN_Std_ReturnTypeRequestInit(0);
+        }
+    }
+    else
+    {
+        /*could not stop before the switch: nothing safe to do*/
+    }
+}
+
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTIONS
 ---------------------------------------------------------------------------------------------------------------------*/
@@ -40,10 +163,15 @@
 *******************************************************************************/
 void MCAN_VoidInit()
 {
+    uint64 Local_uint64Start;
+    uint32 Local_uint32Timing;
+
     /*Enable CAN clock and setup the AFIO configuarions*/
-    MRCC_voidEnableClock(RCC_APB1,PERIPHERAL_EN_CAN1);
-    MRCC_voidEnableClock(RCC_APB2,PERIPHERAL_EN_AFIO);
-    MRCC_voidEnableClock(RCC_APB2,PERIPHERAL_EN_IOPB);
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB1,PERIPHERAL_EN_CAN1,RCC_CLIENT_CAN);
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_AFIO,RCC_CLIENT_CAN);
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_IOPB,RCC_CLIENT_CAN);
+    /*bit timing follows run time clock changes*/
+    (void)MRCC_Std_ReturnTypeRegisterClockCallback(MCAN_VoidClockChanged);
 
     /*set AFIO pins*/
     MAFIO_voidRemapPeripheralPins(CAN_REMAP);//Rx pinB8, TX pinB9
@@ -56,13 +184,27 @@ void MCAN_VoidInit()
     //clear SLEEP bit
     CLEAR_BIT(CAN_Control->MCR,1);
 		
-    /* wait to exit sleep mode SLAK bit ack of sleep  */
-    while (!(READ_BIT(CAN_Control->MSR,1) == 0));
+    /* wait to exit sleep mode SLAK bit ack of sleep (no transceiver / no clock: give up) */
+    Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+    while (!(READ_BIT(CAN_Control->MSR,1) == 0))
+    {
+        if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,CAN_MODE_TIMEOUT_US))
+        {
+            return;
+        }
+    }
     /*Switch to initialization mode for init*/
     /*set INRQ bit */
     SET_BIT(CAN_Control->MCR,0);
     /*wait until hardware set the INAK bit ack of init*/
-    while ((READ_BIT(CAN_Control->MSR,0)==0));
+    Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+    while ((READ_BIT(CAN_Control->MSR,0)==0))
+    {
+        if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,CAN_MODE_TIMEOUT_US))
+        {
+            return;
+        }
+    }
     
     /*from bits of control register*/
 
@@ -128,7 +270,7 @@ void MCAN_VoidInit()
     #if AutomaticBus_off == Enabled
     SET_BIT(CAN_Control->MCR,6);
     #else
-    CLEAR_BIT(CAN_Control->>MCR,6);
+    CLEAR_BIT(CAN_Control->MCR,6);
     #endif
 
     /*Time stamp in TX and RX mailbox*/
@@ -138,11 +280,12 @@ void MCAN_VoidInit()
     CLEAR_BIT(CAN_Control->MCR,7);
     #endif
     
-    /** Set the bit timing register **/
-    CAN_Control->BTR= (uint32) (MODE |
-		  ((CAN_bitRateConfig[BAUDRATE].TS2-1) << 20) |
-		  ((CAN_bitRateConfig[BAUDRATE].TS1-1) << 16) |
-		  (CAN_bitRateConfig[BAUDRATE].BRP-1));
+    /** Set the bit timing register from the live APB1 clock (no exact timing: stay in initialization mode) **/
+    if(MCAN_Std_ReturnTypeBitTiming(MRCC_u32GetPclk1(),can_bit_rates[BAUDRATE],&Local_uint32Timing) == N_OK)
+    {
+        return;
+    }
+    CAN_Control->BTR= (uint32) (MODE | Local_uint32Timing);
 }
 
 /******************************************************************************
@@ -291,7 +434,7 @@ void MCAN_VoidTransmission(CAN_TX_Frame_t * TXframe,uint8 Data[])
 * \Parameters (out): CAN_RX_Frame * RXframe , Data array represent the data bytes                                                      
 * \Return value:   : None
 *******************************************************************************/
-void MCAN_VoidReception(uint8 RX_FIFO,CAN_RX_Frame_t * RXframe,uint8 Data[])
+RAMFUNC void MCAN_VoidReception(uint8 RX_FIFO,CAN_RX_Frame_t * RXframe,uint8 Data[])
 {
     /*we enter this function after RX interrupt and the callback of specific FIFO call this function
     * so the Frame is ready in the FIFO mailbox*/
@@ -318,9 +461,69 @@ void MCAN_VoidReception(uint8 RX_FIFO,CAN_RX_Frame_t * RXframe,uint8 Data[])
         if(Local_u8Itr<=3)
             Data[Local_u8Itr] = CAN_Mailbox->RXFIFO[RX_FIFO].RDLR.DATA[Local_u8Itr];
         else
-            Data[Local_u8Itr] = CAN_Mailbox->RXFIFO[RX_FIFO].RDHR.DATA[Local_u8Itr];
+            Data[Local_u8Itr] = CAN_Mailbox->RXFIFO[RX_FIFO].RDHR.DATA[Local_u8Itr - 4];
     }
     
     /*After reading the frame ,Release the FIFO to reduce the msgs count and receive another one*/
     CAN_Control->RFR[RX_FIFO].RFOM=1;   
+}
+
+/******************************************************************************
+* \Syntax          : void MCAN_VoidEnableRxInterrupt(void)
+* \Description     : empty the receive queue and enable the FIFO0 message pending interrupt, the ISR moves
+*                    every frame into a lock-free queue (USB_LP_CAN_RX0 must be enabled in the NVIC by the application)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MCAN_VoidEnableRxInterrupt(void)
+{
+    Ring_VoidInit(&can_rx_ring,can_rx_messages,sizeof(CAN_RX_Message_t),CAN_RX_QUEUE_SIZE,NULL);
+    /*FMPIE0: FIFO0 message pending interrupt enable*/
+    SET_BIT(CAN_Control->IER,1);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MCAN_Std_ReturnTypeReadMessage(CAN_RX_Message_t* Copy_pMessage)
+* \Description     : take the oldest frame received by the FIFO0 interrupt, no interrupt masking needed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): CAN_RX_Message_t* Copy_pMessage
+* \Return value:   : OK frame returned , N_OK queue empty
+*******************************************************************************/
+Std_ReturnType MCAN_Std_ReturnTypeReadMessage(CAN_RX_Message_t* Copy_pMessage)
+{
+    return Ring_Std_ReturnTypeSpscPop(&can_rx_ring,Copy_pMessage);
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MCAN_uint32GetRxOverruns(void)
+* \Description     : number of frames dropped because the receive queue was full
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 dropped frames
+*******************************************************************************/
+uint32 MCAN_uint32GetRxOverruns(void)
+{
+    return can_rx_overruns;
+}
+
+/*FIFO0 holds up to 3 frames: move all of them, releasing each mailbox clears FMP0 and with it the request*/
+RAMFUNC void USB_LP_CAN_RX0_IRQHandler(void)
+{
+    CAN_RX_Message_t Local_Message;
+
+    while(CAN_Control->RFR[CAN_RX_FIFO0].FMP != 0)
+    {
+        MCAN_VoidReception(CAN_RX_FIFO0,&Local_Message.Frame,Local_Message.Data);
+        if(Ring_Std_ReturnTypeSpscPush(&can_rx_ring,&Local_Message) != OK)
+        {
+            can_rx_overruns++;
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,20 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DWT_config.h
+ *       Module:  DWT Module
+ *  Description:  Configuration header file for DWT Driver
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _DWT_CONFIG_H
+#define _DWT_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+
+#endif
@@ -0,0 +1,68 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DWT_interface.h
+ *       Module:  DWT Module
+ *  Description:  Interface header file for DWT free running core cycle counter
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _DWT_INTERFACE_H
+#define _DWT_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+
+#include "DWT_config.h"
+#include "DWT_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*single load for ISRs where a function call is too expensive*/
+#define MDWT_CYCLE_COUNT()      (DWT->CYCCNT)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void MDWT_VoidEnableCycleCounter(void)
+* \Description     : power the trace block and start the core clock cycle counter (safe to call again)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MDWT_VoidEnableCycleCounter(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MDWT_uint32GetCycleCount(void)
+* \Description     : current core cycle count (wraps every 2^32 cycles)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 cycle count
+*******************************************************************************/
+uint32 MDWT_uint32GetCycleCount(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MDWT_uint32GetRate(uint32 Copy_uint32Events , uint32 Copy_uint32Cycles , uint32 Copy_uint32ClockHz)
+* \Description     : events per second of a span timed with the cycle counter: events * clock / cycles , without a
+*                    64-bit division (cycles per event in 1/16 steps , clock * 16 fits 32 bits up to 268MHZ)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Events , uint32 Copy_uint32Cycles : cycles of the span , uint32 Copy_uint32ClockHz : HCLK
+* \Parameters (out): None
+* \Return value:   : uint32 events per second , 0 when nothing was timed
+*******************************************************************************/
+uint32 MDWT_uint32GetRate(uint32 Copy_uint32Events , uint32 Copy_uint32Cycles , uint32 Copy_uint32ClockHz);
+
+#endif
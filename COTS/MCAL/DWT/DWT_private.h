@@ -0,0 +1,43 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DWT_private.h
+ *       Module:  DWT Module
+ *  Description:  Private header file for DWT (Data Watchpoint and Trace) cycle counter
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _DWT_PRIVATE_H
+#define _DWT_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/* Register Map for DWT */
+typedef struct{
+    volatile uint32 CTRL;
+    volatile uint32 CYCCNT;
+    volatile uint32 CPICNT;
+    volatile uint32 EXCCNT;
+    volatile uint32 SLEEPCNT;
+    volatile uint32 LSUCNT;
+    volatile uint32 FOLDCNT;
+    volatile uint32 PCSR;
+}DWT_MemoryMap_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define     DWT_Base_Address        0xE0001000
+#define     DWT                     ((volatile DWT_MemoryMap_t *) DWT_Base_Address)
+
+/*Debug Exception and Monitor Control Register: TRCENA powers the DWT*/
+#define     DWT_DEMCR               (*((volatile uint32*)0xE000EDFC))
+#define     DWT_DEMCR_TRCENA        24
+
+#define     DWT_CTRL_CYCCNTENA      0
+
+#endif
@@ -0,0 +1,76 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DWT_program.c
+ *       Module:  DWT Module
+ *  Description:  implementaion C file for DWT Driver
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "DWT_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void MDWT_VoidEnableCycleCounter(void)
+* \Description     : power the trace block and start the core clock cycle counter (safe to call again)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MDWT_VoidEnableCycleCounter(void)
+{
+    SET_BIT(DWT_DEMCR,DWT_DEMCR_TRCENA);
+    SET_BIT(DWT->CTRL,DWT_CTRL_CYCCNTENA);
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MDWT_uint32GetCycleCount(void)
+* \Description     : current core cycle count (wraps every 2^32 cycles)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 cycle count
+*******************************************************************************/
+uint32 MDWT_uint32GetCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MDWT_uint32GetRate(uint32 Copy_uint32Events , uint32 Copy_uint32Cycles , uint32 Copy_uint32ClockHz)
+* \Description     : events per second of a span timed with the cycle counter: events * clock / cycles , without a
+*                    64-bit division (cycles per event in 1/16 steps , clock * 16 fits 32 bits up to 268MHZ)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Events , uint32 Copy_uint32Cycles : cycles of the span , uint32 Copy_uint32ClockHz : HCLK
+* \Parameters (out): None
+* \Return value:   : uint32 events per second , 0 when nothing was timed
+*******************************************************************************/
+uint32 MDWT_uint32GetRate(uint32 Copy_uint32Events , uint32 Copy_uint32Cycles , uint32 Copy_uint32ClockHz)
+{
+    uint32 Local_uint32CyclesPerEvent;
+
+    if((Copy_uint32Cycles == 0) || (Copy_uint32Events == 0))
+    {
+        return 0;
+    }
+    Local_uint32CyclesPerEvent = ((Copy_uint32Cycles / Copy_uint32Events) << 4) +
+                                 (((Copy_uint32Cycles % Copy_uint32Events) << 4) / Copy_uint32Events);
+    if(Local_uint32CyclesPerEvent == 0)
+    {
+        return 0;
+    }
+    return (Copy_uint32ClockHz << 4) / Local_uint32CyclesPerEvent;
+}
@@ -20,6 +20,9 @@
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL MACROS
 ---------------------------------------------------------------------------------------------------------------------*/
+/*number of captured edges buffered between the EXTI ISRs and MEXTERNAL_INTERRUPT_VoidProcessEvents
+  (power of 2)*/
+#define EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE     32
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
@@ -19,8 +19,8 @@
 #include "../../LIB//Std_Types.h"
 #include "../../LIB//Bit_Math.h"
 
-#include "EXTERNAL_INTERRUPT_private.h"
-#include "EXTERNAL_INTERRUPT_config.h"
+#include "External_Interrupt_private.h"
+#include "External_Interrupt_Config.h"
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA TYPES AND STRUCTURES
@@ -68,6 +68,13 @@ typedef enum{
     
 }EXTERNAL_INTERRUPT_PORTS_t;
 
+/*edge recorded by the ISR of a line in event capture mode*/
+typedef struct{
+    uint32 Timestamp;   /*DWT core cycle count in the ISR , right after the pending bit is cleared*/
+    uint8  Line;        /*EXTI line = pin number*/
+    uint8  Level;       /*pin level read in the ISR (1 after a rising edge unless the pulse was shorter than the ISR latency)*/
+}EXTERNAL_INTERRUPT_Event_t;
+
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTIONS
 ---------------------------------------------------------------------------------------------------------------------*/
@@ -131,6 +138,17 @@ void MEXTERNAL_INTERRUPT_VoidDisableInterrupt(EXTERNAL_InterruptNumber_t Copy_ui
 *******************************************************************************/
 void MEXTERNAL_INTERRUPT_VoidEnableSoftwareInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber);
 
+/******************************************************************************
+* \Syntax          : void MEXTERNAL_INTERRUPT_VoidTriggerSoftwareInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber)
+* \Description     : raise an already enabled line from software with a single store (safe from any ISR)
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MEXTERNAL_INTERRUPT_VoidTriggerSoftwareInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber);
+
 
 /******************************************************************************
 * \Syntax          : void MEXTERNAL_INTERRUPT_VoidInterruptCallback(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,void (*callback)(void))
@@ -143,5 +161,54 @@ void MEXTERNAL_INTERRUPT_VoidEnableSoftwareInterrupt(EXTERNAL_InterruptNumber_t
 *******************************************************************************/
 void MEXTERNAL_INTERRUPT_VoidInterruptCallback(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,void (*callback)(void));
 
+/******************************************************************************
+* \Syntax          : void MEXTERNAL_INTERRUPT_VoidSetEventHandler(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,
+*                                                                  void (*handler)(const EXTERNAL_INTERRUPT_Event_t* Copy_pEvent))
+* \Description     : switch a line to event capture mode: the ISR only queues (line , cycle timestamp , level) and the
+*                    handler runs later from MEXTERNAL_INTERRUPT_VoidProcessEvents. NULL returns the line to callback mode.
+*                    EXTI vectors with lines in capture mode may have any NVIC priority (lock-free multi producer queue)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber , handler : bottom half of the line
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MEXTERNAL_INTERRUPT_VoidSetEventHandler(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,
+                                             void (*handler)(const EXTERNAL_INTERRUPT_Event_t* Copy_pEvent));
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MEXTERNAL_INTERRUPT_Std_ReturnTypeGetEvent(EXTERNAL_INTERRUPT_Event_t* Copy_pEvent)
+* \Description     : take the oldest captured event from the queue
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): EXTERNAL_INTERRUPT_Event_t* Copy_pEvent
+* \Return value:   : OK event returned , N_OK queue empty
+*******************************************************************************/
+Std_ReturnType MEXTERNAL_INTERRUPT_Std_ReturnTypeGetEvent(EXTERNAL_INTERRUPT_Event_t* Copy_pEvent);
+
+/******************************************************************************
+* \Syntax          : void MEXTERNAL_INTERRUPT_VoidProcessEvents(void)
+* \Description     : bottom half: drain the event queue and call the event handler of every line,
+*                    call from the main loop or a low priority handler
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MEXTERNAL_INTERRUPT_VoidProcessEvents(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MEXTERNAL_INTERRUPT_uint32GetEventOverruns(void)
+* \Description     : number of edges dropped because the event queue was full
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 dropped events
+*******************************************************************************/
+uint32 MEXTERNAL_INTERRUPT_uint32GetEventOverruns(void);
+
 
 #endif
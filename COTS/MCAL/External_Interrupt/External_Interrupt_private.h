@@ -38,5 +38,11 @@ typedef struct{
 
 #define     AFIO_EXTICR      ((volatile uint32*)AFIO_EXTICR_Base_Address) 
 
+/*EXTI lines sharing one NVIC vector*/
+#define     EXTERNAL_INTERRUPT_LINES_9_5_MASK      0x000003E0UL
+#define     EXTERNAL_INTERRUPT_LINES_15_10_MASK    0x0000FC00UL
+
+#define     EXTERNAL_INTERRUPT_GPIO_LINES          16
+
 
 #endif
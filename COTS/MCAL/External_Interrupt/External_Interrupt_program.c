@@ -21,11 +21,39 @@
 #include "External_Interrupt_Config.h"
 #include "External_Interrupt_private.h"
 #include "External_Interrupt_interface.h"
+#include "../GPIO/GPIO_interface.h"
+#include "../DWT/DWT_interface.h"
+#include "../../LIB/Ring_Buffer.h"
+#include "../../LIB/Compiler.h"
+
+#if (EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE & (EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE - 1)) != 0
+#error "EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE must be a power of 2"
+#endif
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
 ---------------------------------------------------------------------------------------------------------------------*/
-static void (*external_interrupt_callback[16])(void) = {};
+static void MEXTERNAL_INTERRUPT_VoidDefaultHandler(void);
+
+/*every line starts on the default handler so a stray edge never calls through NULL*/
+static void (*external_interrupt_callback[EXTERNAL_INTERRUPT_GPIO_LINES])(void) =
+{
+    [0 ... (EXTERNAL_INTERRUPT_GPIO_LINES - 1)] = MEXTERNAL_INTERRUPT_VoidDefaultHandler
+};
+
+/*port routed to each line (AFIO_EXTICR copy) to sample the pin level in capture mode*/
+static uint8 external_interrupt_port[EXTERNAL_INTERRUPT_GPIO_LINES];
+
+/*event capture mode: lines set in the mask are queued by the ISR instead of calling back*/
+static volatile uint32 external_interrupt_capture_mask = 0;
+static void (*external_interrupt_event_handler[EXTERNAL_INTERRUPT_GPIO_LINES])(const EXTERNAL_INTERRUPT_Event_t* Copy_pEvent);
+
+/*multi producer (EXTI vectors may have different priorities and preempt each other) single consumer ring,
+  bound to its storage by the first MEXTERNAL_INTERRUPT_VoidSetEventHandler*/
+static EXTERNAL_INTERRUPT_Event_t external_interrupt_events[EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE];
+static volatile uint32 external_interrupt_event_sequence[EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE];
+static Ring_Buffer_t external_interrupt_event_ring;
+static volatile uint32 external_interrupt_event_overruns = 0;
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTIONS
 ---------------------------------------------------------------------------------------------------------------------*/
@@ -65,6 +93,7 @@ void MEXTERNAL_INTERRUPT_VoidSetPort(EXTERNAL_InterruptNumber_t Copy_uint8Interr
     AFIO_EXTICR[Local_uint8RegIndex] &= ~((0b1111) << (Copy_uint8InterruptNumber * 4));
     /*set*/
     AFIO_EXTICR[Local_uint8RegIndex]  |= ((Copy_uint8InterruptPort) << (Copy_uint8InterruptNumber * 4));
+    external_interrupt_port[(Local_uint8RegIndex * 4) + Copy_uint8InterruptNumber] = Copy_uint8InterruptPort;
 }
 
 /******************************************************************************
@@ -138,8 +167,22 @@ void MEXTERNAL_INTERRUPT_VoidDisableInterrupt(EXTERNAL_InterruptNumber_t Copy_ui
 void MEXTERNAL_INTERRUPT_VoidEnableSoftwareInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber)
 {
     SET_BIT(EXTI->EXTI_IMR,Copy_uint8InterruptNumber);
-    CLEAR_BIT(EXTI->EXTI_PR,Copy_uint8InterruptNumber);/*set pending bit of this interrupt*/
-    SET_BIT(EXTI->EXTI_SWIER,Copy_uint8InterruptNumber);
+    /*SWIER write sets the pending bit of this interrupt (PR is write 1 to clear, never read-modify-write it)*/
+    EXTI->EXTI_SWIER = (1UL << Copy_uint8InterruptNumber);
+}
+
+/******************************************************************************
+* \Syntax          : void MEXTERNAL_INTERRUPT_VoidTriggerSoftwareInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber)
+* \Description     : raise an already enabled line from software with a single store (safe from any ISR)
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MEXTERNAL_INTERRUPT_VoidTriggerSoftwareInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber)
+{
+    EXTI->EXTI_SWIER = (1UL << Copy_uint8InterruptNumber);
 }
 
 /******************************************************************************
@@ -148,136 +191,216 @@ void MEXTERNAL_INTERRUPT_VoidEnableSoftwareInterrupt(EXTERNAL_InterruptNumber_t
 * \Sync\Async      : Synchronous                                               
 * \Reentrancy      : Non Reentrant                                             
 * \Parameters (in) : EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber ,void (*callback)(void) callback function to be called in interrupt handler
+*                    (NULL restores the default handler)
 * \Parameters (out): None                                                      
 * \Return value:   : None
 *******************************************************************************/
 void MEXTERNAL_INTERRUPT_VoidInterruptCallback(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,void (*callback)(void))
 {
-    external_interrupt_callback[Copy_uint8InterruptNumber] = callback;
+    if(Copy_uint8InterruptNumber < EXTERNAL_INTERRUPT_GPIO_LINES)
+    {
+        external_interrupt_callback[Copy_uint8InterruptNumber] = (callback != NULL) ? callback : MEXTERNAL_INTERRUPT_VoidDefaultHandler;
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void MEXTERNAL_INTERRUPT_VoidSetEventHandler(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,
+*                                                                  void (*handler)(const EXTERNAL_INTERRUPT_Event_t* Copy_pEvent))
+* \Description     : switch a line to event capture mode: the ISR only queues (line , cycle timestamp , level) and the
+*                    handler runs later from MEXTERNAL_INTERRUPT_VoidProcessEvents. NULL returns the line to callback mode.
+*                    EXTI vectors with lines in capture mode may have any NVIC priority (lock-free multi producer queue)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber , handler : bottom half of the line
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MEXTERNAL_INTERRUPT_VoidSetEventHandler(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,
+                                             void (*handler)(const EXTERNAL_INTERRUPT_Event_t* Copy_pEvent))
+{
+    if(Copy_uint8InterruptNumber < EXTERNAL_INTERRUPT_GPIO_LINES)
+    {
+        if(handler != NULL)
+        {
+            MDWT_VoidEnableCycleCounter();
+            if(external_interrupt_event_ring.Buffer == NULL)
+            {
+                /*no line captures yet, so no ISR can be using the ring*/
+                Ring_VoidInit(&external_interrupt_event_ring,external_interrupt_events,sizeof(EXTERNAL_INTERRUPT_Event_t),
+                              EXTERNAL_INTERRUPT_EVENT_QUEUE_SIZE,external_interrupt_event_sequence);
+            }
+            external_interrupt_event_handler[Copy_uint8InterruptNumber] = handler;
+            Atomic_VoidSetBits(&external_interrupt_capture_mask,1UL << Copy_uint8InterruptNumber);
+        }
+        else
+        {
+            /*events already queued for the line are dropped by the bottom half*/
+            Atomic_VoidClearBits(&external_interrupt_capture_mask,1UL << Copy_uint8InterruptNumber);
+            external_interrupt_event_handler[Copy_uint8InterruptNumber] = NULL;
+        }
+    }
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MEXTERNAL_INTERRUPT_Std_ReturnTypeGetEvent(EXTERNAL_INTERRUPT_Event_t* Copy_pEvent)
+* \Description     : take the oldest captured event from the queue
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): EXTERNAL_INTERRUPT_Event_t* Copy_pEvent
+* \Return value:   : OK event returned , N_OK queue empty
+*******************************************************************************/
+Std_ReturnType MEXTERNAL_INTERRUPT_Std_ReturnTypeGetEvent(EXTERNAL_INTERRUPT_Event_t* Copy_pEvent)
+{
+    if(external_interrupt_event_ring.Buffer == NULL)
+    {
+        return N_OK;
+    }
+    return Ring_Std_ReturnTypeMpscPop(&external_interrupt_event_ring,Copy_pEvent);
+}
+
+/******************************************************************************
+* \Syntax          : void MEXTERNAL_INTERRUPT_VoidProcessEvents(void)
+* \Description     : bottom half: drain the event queue and call the event handler of every line,
+*                    call from the main loop or a low priority handler
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MEXTERNAL_INTERRUPT_VoidProcessEvents(void)
+{
+    EXTERNAL_INTERRUPT_Event_t Local_Event;
+    void (*Local_pHandler)(const EXTERNAL_INTERRUPT_Event_t* Copy_pEvent);
+
+    while(MEXTERNAL_INTERRUPT_Std_ReturnTypeGetEvent(&Local_Event) == OK)
+    {
+        Local_pHandler = external_interrupt_event_handler[Local_Event.Line];
+        if(Local_pHandler != NULL)
+        {
+            Local_pHandler(&Local_Event);
+        }
+    }
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MEXTERNAL_INTERRUPT_uint32GetEventOverruns(void)
+* \Description     : number of edges dropped because the event queue was full
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 dropped events
+*******************************************************************************/
+uint32 MEXTERNAL_INTERRUPT_uint32GetEventOverruns(void)
+{
+    return external_interrupt_event_overruns;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*line enabled with no callback attached: pending bit is already cleared by the dispatcher, nothing else to do*/
+static void MEXTERNAL_INTERRUPT_VoidDefaultHandler(void)
+{
 }
 
-void EXTI0_IRQHandler(void)
+/*top half of a line in capture mode: queue (line , timestamp , level) only*/
+static inline RAMFUNC void MEXTERNAL_INTERRUPT_VoidCaptureLine(uint32 Copy_uint32Line , uint32 Copy_uint32Timestamp)
 {
-	external_interrupt_callback[0]();
-	/*clear pending bit*/
-	SET_BIT(EXTI->EXTI_PR , 0);
+    EXTERNAL_INTERRUPT_Event_t Local_Event;
+
+    Local_Event.Timestamp = Copy_uint32Timestamp;
+    Local_Event.Line = (uint8)Copy_uint32Line;
+    Local_Event.Level = (uint8)((GPIO_PORT_ADDRESS(external_interrupt_port[Copy_uint32Line])->IDR >> Copy_uint32Line) & 1U);
+    if(Ring_Std_ReturnTypeMpscPush(&external_interrupt_event_ring,&Local_Event) != OK)
+    {
+        /*a higher priority EXTI vector may count at the same time*/
+        (void)Atomic_uint32FetchAdd(&external_interrupt_event_overruns,1);
+    }
 }
 
+/*top half of a line: the callback runs here , the cycle counter is only read for a line in capture mode*/
+static inline RAMFUNC void MEXTERNAL_INTERRUPT_VoidServeLine(uint32 Copy_uint32Line)
+{
+    if((external_interrupt_capture_mask & (1UL << Copy_uint32Line)) == 0)
+    {
+        external_interrupt_callback[Copy_uint32Line]();
+    }
+    else
+    {
+        MEXTERNAL_INTERRUPT_VoidCaptureLine(Copy_uint32Line,MDWT_CYCLE_COUNT());
+    }
+}
 
-void EXTI1_IRQHandler(void)
+/*read PR once, keep only enabled lines of the vector group, clear them with one write
+  (PR is write 1 to clear, so no read-modify-write) then visit the set bits with CLZ.
+  capture lines of the group share one timestamp , read only when one of them is pending*/
+static inline RAMFUNC void MEXTERNAL_INTERRUPT_VoidDispatch(uint32 Copy_uint32GroupMask)
 {
-	external_interrupt_callback[1]();
-	/*clear pending bit*/
-	SET_BIT(EXTI->EXTI_PR , 1);
+    uint32 Local_uint32Pending = EXTI->EXTI_PR & EXTI->EXTI_IMR & Copy_uint32GroupMask;
+    uint32 Local_uint32Capture = Local_uint32Pending & external_interrupt_capture_mask;
+    uint32 Local_uint32Timestamp = 0;
+    uint32 Local_uint32Line;
+
+    if(Local_uint32Capture != 0)
+    {
+        Local_uint32Timestamp = MDWT_CYCLE_COUNT();
+    }
+    EXTI->EXTI_PR = Local_uint32Pending;
+    while(Local_uint32Pending != 0)
+    {
+        Local_uint32Line = GET_MSB_INDEX(Local_uint32Pending);
+        Local_uint32Pending ^= (1UL << Local_uint32Line);
+        if((Local_uint32Capture & (1UL << Local_uint32Line)) != 0)
+        {
+            MEXTERNAL_INTERRUPT_VoidCaptureLine(Local_uint32Line,Local_uint32Timestamp);
+        }
+        else
+        {
+            external_interrupt_callback[Local_uint32Line]();
+        }
+    }
 }
 
-void EXTI2_IRQHandler(void)
+RAMFUNC void EXTI0_IRQHandler(void)
 {
-	external_interrupt_callback[2]();
-	/*clear pending bit*/
-	SET_BIT(EXTI->EXTI_PR , 2);
+	/*clear pending bit before the callback so an edge during it is not lost*/
+	EXTI->EXTI_PR = (1UL << 0);
+	MEXTERNAL_INTERRUPT_VoidServeLine(0);
 }
 
-void EXTI3_IRQHandler(void)
+RAMFUNC void EXTI1_IRQHandler(void)
 {
-	external_interrupt_callback[3]();
-	/*clear pending bit*/
-	SET_BIT(EXTI->EXTI_PR , 3);
+	EXTI->EXTI_PR = (1UL << 1);
+	MEXTERNAL_INTERRUPT_VoidServeLine(1);
 }
 
-void EXTI4_IRQHandler(void)
+RAMFUNC void EXTI2_IRQHandler(void)
 {
-	external_interrupt_callback[4]();
-	/*clear pending bit*/
-	SET_BIT(EXTI->EXTI_PR , 4);
+	EXTI->EXTI_PR = (1UL << 2);
+	MEXTERNAL_INTERRUPT_VoidServeLine(2);
 }
 
-void EXTI9_5_IRQHandler(void)
+RAMFUNC void EXTI3_IRQHandler(void)
 {
-	uint8 PinValue_5 , PinValue_6 , PinValue_7 , PinValue_8 , PinValue_9;
-
-	PinValue_6 = READ_BIT(EXTI->EXTI_PR,6);
-	PinValue_7 = READ_BIT(EXTI->EXTI_PR,7);
-	PinValue_8 = READ_BIT(EXTI->EXTI_PR,8);
-	PinValue_9 = READ_BIT(EXTI->EXTI_PR,9);
-
-	if (PinValue_5 == 1)
-	{
-		external_interrupt_callback[5]();
-		SET_BIT(EXTI->EXTI_PR , 5);
-	}
-
-	if (PinValue_6 == 1)
-	{
-		external_interrupt_callback[6]();
-		SET_BIT(EXTI->EXTI_PR , 6);
-	}
-
-	if (PinValue_7 == 1)
-	{
-		external_interrupt_callback[7]();
-		SET_BIT(EXTI->EXTI_PR , 7);
-	}
-
-	if (PinValue_8 == 1)
-	{
-		external_interrupt_callback[8]();
-		SET_BIT(EXTI->EXTI_PR , 8);
-	}
-
-	if (PinValue_9 == 1)
-	{
-		external_interrupt_callback[9]();
-		SET_BIT(EXTI->EXTI_PR , 9);
-	}
+	EXTI->EXTI_PR = (1UL << 3);
+	MEXTERNAL_INTERRUPT_VoidServeLine(3);
+}
 
+RAMFUNC void EXTI4_IRQHandler(void)
+{
+	EXTI->EXTI_PR = (1UL << 4);
+	MEXTERNAL_INTERRUPT_VoidServeLine(4);
 }
 
-void EXTI15_10_IRQHandler(void)
+RAMFUNC void EXTI9_5_IRQHandler(void)
 {
-	uint8 PinValue_10 , PinValue_11 , PinValue_12 , PinValue_13 , PinValue_14 , PinValue_15;
-
-	PinValue_10 = READ_BIT(EXTI->EXTI_PR,10);
-	PinValue_11 = READ_BIT(EXTI->EXTI_PR,11);
-	PinValue_12 = READ_BIT(EXTI->EXTI_PR,12);
-	PinValue_13 = READ_BIT(EXTI->EXTI_PR,13);
-	PinValue_14 = READ_BIT(EXTI->EXTI_PR,14);
-	PinValue_15 = READ_BIT(EXTI->EXTI_PR,14);
-
-	if (PinValue_10 == 1)
-	{
-		external_interrupt_callback[10]();
-		SET_BIT(EXTI->EXTI_PR , 10);
-	}
-
-	if (PinValue_11 == 1)
-	{
-		external_interrupt_callback[11]();
-		SET_BIT(EXTI->EXTI_PR , 11);
-	}
-
-	if (PinValue_12 == 1)
-	{
-		external_interrupt_callback[12]();
-		SET_BIT(EXTI->EXTI_PR , 12);
-	}
-
-	if (PinValue_13 == 1)
-	{
-		external_interrupt_callback[13]();
-		SET_BIT(EXTI->EXTI_PR , 13);
-	}
-
-	if (PinValue_14 == 1)
-	{
-		external_interrupt_callback[14]();
-		SET_BIT(EXTI->EXTI_PR , 14);
-	}
-
-	if (PinValue_15 == 1)
-	{
-		external_interrupt_callback[15]();
-		SET_BIT(EXTI->EXTI_PR , 15);
-	}
+	MEXTERNAL_INTERRUPT_VoidDispatch(EXTERNAL_INTERRUPT_LINES_9_5_MASK);
+}
 
+RAMFUNC void EXTI15_10_IRQHandler(void)
+{
+	MEXTERNAL_INTERRUPT_VoidDispatch(EXTERNAL_INTERRUPT_LINES_15_10_MASK);
 }
@@ -67,6 +67,9 @@ typedef struct{
 #define 	GPIOF 		((GPIO_t *) GPIOF_Base_Address)
 #define 	GPIOG 		((GPIO_t *) GPIOG_Base_Address)
 
+/*ports are 0x400 apart so port registers can be reached directly from GPIO_Num*/
+#define 	GPIO_PORT_ADDRESS(PORT)		((GPIO_t *) (GPIOA_Base_Address + ((PORT) * 0x400)))
+
 
 
 /*lock key bit*/
@@ -20,6 +20,26 @@
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL MACROS
 ---------------------------------------------------------------------------------------------------------------------*/
+/*copy the flash vector table to SRAM and point VTOR at it so MNVIC_VoidAttachHandler can patch entries at runtime
+  (costs NVIC_RAM_VECTOR_ALIGN bytes of SRAM)
+  Options: 1 enabled , 0 disabled*/
+#define NVIC_RAM_VECTOR_TABLE       1
+
+/*priority grouping programmed by MNVIC_VoidInitPriorities
+  Options: Group16Sub0 , Group8Sub2 , Group4Sub4 , Group2Sub8 , Group0Sub16*/
+#define NVIC_PRIORITY_GROUPING      Group16Sub0
+
+/*boot priorities of peripheral IRQs: NVIC_PRIORITY(IRQ , group priority , sub priority), lower number = more urgent,
+  IRQs not listed keep their current priority (0 after reset)*/
+#define NVIC_IRQ_PRIORITIES         { NVIC_PRIORITY(EXTI0,     1, 0), \
+                                      NVIC_PRIORITY(EXTI9_5,   1, 0), \
+                                      NVIC_PRIORITY(EXTI15_10, 1, 0), \
+                                      NVIC_PRIORITY(USART1,    4, 0) }
+
+/*boot priorities of system handlers: NVIC_PRIORITY(NVIC_EXC_x , group priority , sub priority)*/
+#define NVIC_SYSTEM_PRIORITIES      { NVIC_PRIORITY(NVIC_EXC_SYSTICK, 0,  0), \
+                                      NVIC_PRIORITY(NVIC_EXC_SVCALL,  14, 0), \
+                                      NVIC_PRIORITY(NVIC_EXC_PENDSV,  15, 0) }
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
@@ -28,9 +28,9 @@
 typedef enum
 {
     WWDG=0,
-    EXTI16,
-    EXTI21,
-    EXTI22,
+    EXTI16,             /*PVD through EXTI line 16*/
+    EXTI21,             /*TAMPER*/
+    EXTI22,             /*RTC global*/
     FLASH=4,
 	RCC_INT=5,
     EXTI0=6,
@@ -38,15 +38,56 @@ typedef enum
     EXTI2,
     EXTI3,
     EXTI4,
-    ADC=18,
+    DMA1_CHANNEL1=11,
+    DMA1_CHANNEL2,
+    DMA1_CHANNEL3,
+    DMA1_CHANNEL4,
+    DMA1_CHANNEL5,
+    DMA1_CHANNEL6,
+    DMA1_CHANNEL7,
+    ADC=18,             /*ADC1 and ADC2*/
+    USB_HP_CAN_TX=19,
+    USB_LP_CAN_RX0=20,
     CAN_RX1=21,
     CAN_SCE=22,
     EXTI9_5=23,
+    TIM1_BRK=24,
+    TIM1_UP,
+    TIM1_TRG_COM,
+    TIM1_CC,
+    TIM2=28,
+    TIM3=29,
+    TIM4=30,
     I2C1_EV=31,
     I2C1_ER=32,
+    I2C2_EV=33,
+    I2C2_ER=34,
     SPI1=35,
+    SPI2=36,
     USART1=37,
-    EXTI15_10=40
+    USART2=38,
+    USART3=39,
+    EXTI15_10=40,
+    RTC_ALARM=41,       /*RTC alarm through EXTI line 17*/
+    USB_WAKEUP=42,      /*USB wakeup through EXTI line 18*/
+    TIM8_BRK=43,
+    TIM8_UP,
+    TIM8_TRG_COM,
+    TIM8_CC,
+    ADC3=47,
+    FSMC=48,
+    SDIO=49,
+    TIM5=50,
+    SPI3=51,
+    UART4=52,
+    UART5=53,
+    TIM6=54,
+    TIM7=55,
+    DMA2_CHANNEL1=56,
+    DMA2_CHANNEL2,
+    DMA2_CHANNEL3,
+    DMA2_CHANNEL4_5,
+    NVIC_IRQ_COUNT      /*number of F103 (high/XL density) interrupt positions, must stay last*/
 }NVIC_InterruptType_t;
 
 
@@ -60,6 +101,23 @@ typedef enum{
 	Group2Sub8,
 	Group0Sub16
 }NVIC_GROUP_t;
+
+/*system exceptions (vector table position) that have a configurable handler/priority*/
+typedef enum{
+    NVIC_EXC_MEMMANAGE=4,
+    NVIC_EXC_BUSFAULT=5,
+    NVIC_EXC_USAGEFAULT=6,
+    NVIC_EXC_SVCALL=11,
+    NVIC_EXC_DEBUGMON=12,
+    NVIC_EXC_PENDSV=14,
+    NVIC_EXC_SYSTICK=15
+}NVIC_SystemException_t;
+
+/*one entry of a priority table: IRQ (or system exception) number and its encoded priority byte*/
+typedef struct{
+    uint8 Number;
+    uint8 Encoded;
+}NVIC_PriorityCfg_t;
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTIONS
 ---------------------------------------------------------------------------------------------------------------------*/
@@ -85,6 +143,65 @@ void MNVIC_VoidSetPriorityPolicy(NVIC_GROUP_t Copy_uint8PriorityPolicy );
 * \Return value:   : None
 *******************************************************************************/
 void MNVIC_VoidSetPriority(NVIC_InterruptType_t Copy_uint8InterruptType , uint8 Copy_uint8Priority,uint8 Copy_uint8SubPriority);
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidSetSystemPriority(NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Priority,uint8 Copy_uint8SubPriority)
+* \Description     : Set priority and sub_priority of a system handler through SHPR
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Priority number of group ,uint8 Copy_uint8SubPriority number of sub priority
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidSetSystemPriority(NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Priority,uint8 Copy_uint8SubPriority);
+
+/******************************************************************************
+* \Syntax          : uint8 MNVIC_uint8EncodePriority(uint8 Copy_uint8Priority , uint8 Copy_uint8SubPriority)
+* \Description     : priority register byte of (group , sub) priority under the current grouping
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Priority number of group ,uint8 Copy_uint8SubPriority number of sub priority
+* \Parameters (out): None
+* \Return value:   : uint8 encoded priority (upper 4 bits used)
+*******************************************************************************/
+uint8 MNVIC_uint8EncodePriority(uint8 Copy_uint8Priority , uint8 Copy_uint8SubPriority);
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidApplyPriorityTable(const NVIC_PriorityCfg_t* Copy_pIrqTable , uint8 Copy_uint8IrqCount ,
+*                                                       const NVIC_PriorityCfg_t* Copy_pSystemTable , uint8 Copy_uint8SystemCount)
+* \Description     : program pre-encoded priorities of many IRQs and system handlers, every IPR/SHPR word is written once
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pIrqTable , Copy_uint8IrqCount : IRQ entries , Copy_pSystemTable , Copy_uint8SystemCount : system handler entries
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidApplyPriorityTable(const NVIC_PriorityCfg_t* Copy_pIrqTable , uint8 Copy_uint8IrqCount ,
+                                  const NVIC_PriorityCfg_t* Copy_pSystemTable , uint8 Copy_uint8SystemCount);
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidInitPriorities(void)
+* \Description     : boot time: select NVIC_PRIORITY_GROUPING and apply NVIC_IRQ_PRIORITIES and NVIC_SYSTEM_PRIORITIES
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidInitPriorities(void);
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidApplySystemPriority(NVIC_SystemException_t Copy_Exception)
+* \Description     : program one system handler with its NVIC_SYSTEM_PRIORITIES entry , for drivers that start their
+*                    exception after boot. an exception missing from the table keeps its current priority
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_SystemException_t Copy_Exception
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidApplySystemPriority(NVIC_SystemException_t Copy_Exception);
+
 /******************************************************************************
 * \Syntax          : void MNVIC_VoidEnableInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)                                      
 * \Description     : Enable  specific interrupt by enabling its mask bit                                                                             
@@ -129,5 +246,55 @@ void MNVIC_VoidSetPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 *******************************************************************************/
 void MNVIC_VoidClearPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType);
 
+#if NVIC_RAM_VECTOR_TABLE == 1
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidRelocateVectorTable(void)
+* \Description     : copy the flash vector table to aligned SRAM and switch VTOR to it (done once, later calls do nothing)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidRelocateVectorTable(void);
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidAttachHandler(NVIC_InterruptType_t Copy_uint8InterruptType , void (*Copy_pHandler)(void))
+* \Description     : write a handler straight into the SRAM vector table (relocates it on first use), the handler is
+*                    entered by the hardware with no driver dispatch in between so it must clear its own flags.
+*                    NULL restores the handler linked in the flash table
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_InterruptType_t Copy_uint8InterruptType Interrupt name , void (*Copy_pHandler)(void) ISR
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidAttachHandler(NVIC_InterruptType_t Copy_uint8InterruptType , void (*Copy_pHandler)(void));
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidAttachSystemHandler(NVIC_SystemException_t Copy_Exception , void (*Copy_pHandler)(void))
+* \Description     : same as MNVIC_VoidAttachHandler for a system exception (SysTick , PendSV , SVCall , faults)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_SystemException_t Copy_Exception : 2..15 (0 and 1 are the initial SP and reset , not
+*                    handlers , anything else is ignored) , void (*Copy_pHandler)(void) handler
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidAttachSystemHandler(NVIC_SystemException_t Copy_Exception , void (*Copy_pHandler)(void));
+
+/******************************************************************************
+* \Syntax          : void (*MNVIC_pGetVectorHandler(uint8 Copy_uint8Vector))(void)
+* \Description     : handler currently installed in the SRAM vector table (relocates it on first use), lets a
+*                    wrapper chain to the handler it replaces. vector = exception number (IRQ + 16)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : 1..NVIC_VECTOR_COUNT-1
+* \Parameters (out): None
+* \Return value:   : handler , NULL for an invalid vector
+*******************************************************************************/
+void (*MNVIC_pGetVectorHandler(uint8 Copy_uint8Vector))(void);
+#endif
+
 
 #endif
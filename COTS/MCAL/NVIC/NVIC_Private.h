@@ -46,8 +46,39 @@ typedef struct{
 #define 	NVIC 		((NVIC_MemoryMap_t *) NVIC_Base_Address)
 #define     NVIC_STIR   ((volatile uint32*)0xE000EF00)            
 
+#define SCB_VTOR  *((volatile uint32*)(0xE000ED08))
 #define SCB_AIRCR *((volatile uint32*)(0xE000ED0C))
-#define NVIC_VECTKEY   0x05FA000
+#define NVIC_VECTKEY   0x05FA0000
+#define SCB_AIRCR_PRIGROUP_MASK    0x00000700UL
+#define SCB_AIRCR_KEEP_MASK        0x0000F8FFUL   /*bits written back with the key (VECTKEY field and PRIGROUP replaced)*/
+
+/*word views of the priority bytes: 4 IRQs per IPR word , system handlers 4..15 in SHPR1..SHPR3*/
+#define NVIC_IPR_WORD   ((volatile uint32*)0xE000E400)
+#define SCB_SHPR_WORD   ((volatile uint32*)0xE000ED18)
+#define SCB_SHPR_BYTE   ((volatile uint8*)0xE000ED18)
+
+/*STM32F103 implements the upper 4 bits of every priority byte*/
+#define NVIC_PRIO_BITS             4
+#define NVIC_PRIO_SHIFT            (8 - NVIC_PRIO_BITS)
+
+/*PRIGROUP 3..7 (Group16Sub0..Group0Sub16) leaves PRIGROUP-3 of the 4 bits to the sub priority*/
+#define NVIC_SUB_BITS(GROUPING)    ((GROUPING) - 3)
+#define NVIC_GROUP_BITS(GROUPING)  (NVIC_PRIO_BITS - NVIC_SUB_BITS(GROUPING))
+
+/*priority byte of (group priority , sub priority) under a grouping, constant when the arguments are constants*/
+#define NVIC_ENCODE_PRIORITY(GROUPING,PRIO,SUB) \
+    ((uint8)((((((PRIO) & ((1U << NVIC_GROUP_BITS(GROUPING)) - 1U)) << NVIC_SUB_BITS(GROUPING)) | \
+               ((SUB) & ((1U << NVIC_SUB_BITS(GROUPING)) - 1U))) << NVIC_PRIO_SHIFT)))
+
+/*entry of NVIC_IRQ_PRIORITIES / NVIC_SYSTEM_PRIORITIES, encoded at compile time with NVIC_PRIORITY_GROUPING*/
+#define NVIC_PRIORITY(NUMBER,PRIO,SUB)  {(NUMBER), NVIC_ENCODE_PRIORITY(NVIC_PRIORITY_GROUPING,PRIO,SUB)}
+
+/*16 system exceptions + peripheral IRQs*/
+#define NVIC_VECTOR_COUNT          (16 + NVIC_IRQ_COUNT)
+/*VTOR needs the table aligned to its size rounded up to a power of 2: 76 words -> 512 bytes*/
+#define NVIC_RAM_VECTOR_ALIGN      512
+
+#define NVIC_DSB_ISB()             __asm__ volatile ("dsb\n\tisb" ::: "memory")
 
 
 #endif
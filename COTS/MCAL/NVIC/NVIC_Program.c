@@ -24,7 +24,20 @@
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
 ---------------------------------------------------------------------------------------------------------------------*/
-NVIC_GROUP_t global_grouping;
+/*PRIGROUP 0..3 all mean 4 group bits on a 4 bit part, reset state behaves as Group16Sub0*/
+NVIC_GROUP_t global_grouping = Group16Sub0;
+
+static const NVIC_PriorityCfg_t NVIC_IrqPriorities[] = NVIC_IRQ_PRIORITIES;
+static const NVIC_PriorityCfg_t NVIC_SystemPriorities[] = NVIC_SYSTEM_PRIORITIES;
+
+#if NVIC_RAM_VECTOR_TABLE == 1
+/*flash table linked by startup.c*/
+extern void (* const vectors[])(void);
+
+static void (*NVIC_RamVectors[NVIC_VECTOR_COUNT])(void) __attribute__((aligned(NVIC_RAM_VECTOR_ALIGN)));
+
+_Static_assert((NVIC_VECTOR_COUNT * 4) <= NVIC_RAM_VECTOR_ALIGN, "NVIC_RAM_VECTOR_ALIGN must cover the vector table");
+#endif
 
 
 
@@ -44,10 +57,9 @@ NVIC_GROUP_t global_grouping;
 void MNVIC_VoidSetPriorityPolicy(NVIC_GROUP_t Copy_uint8PriorityPolicy )
 {
     global_grouping = Copy_uint8PriorityPolicy;
-    /*write the AIRCR Key*/
-    SCB_AIRCR = NVIC_VECTKEY;
-    /*set priority Policy*/
-    SCB_AIRCR |= (Copy_uint8PriorityPolicy<<8);
+    /*single write: key , old PRIGROUP replaced (an OR kept the bits of the previous grouping)*/
+    SCB_AIRCR = NVIC_VECTKEY | (SCB_AIRCR & SCB_AIRCR_KEEP_MASK & ~SCB_AIRCR_PRIGROUP_MASK) |
+                (((uint32)Copy_uint8PriorityPolicy << 8) & SCB_AIRCR_PRIGROUP_MASK);
 }
 
 /******************************************************************************
@@ -61,26 +73,135 @@ void MNVIC_VoidSetPriorityPolicy(NVIC_GROUP_t Copy_uint8PriorityPolicy )
 *******************************************************************************/
 void MNVIC_VoidSetPriority(NVIC_InterruptType_t Copy_uint8InterruptType , uint8 Copy_uint8Priority,uint8 Copy_uint8SubPriority)
 {
-    switch(global_grouping){
-	case(Group16Sub0):
-        NVIC -> NVIC_IPR[Copy_uint8InterruptType] = Copy_uint8Priority<<4;
-        break;
-	case(Group8Sub2):
-        NVIC -> NVIC_IPR[Copy_uint8InterruptType] = Copy_uint8Priority<<5 | Copy_uint8SubPriority<<4 ;
-        break;
-	case(Group4Sub4):
-		NVIC -> NVIC_IPR[Copy_uint8InterruptType] = Copy_uint8Priority<<6 | Copy_uint8SubPriority<<4 ;
-		break;
-	case(Group2Sub8):
-		NVIC -> NVIC_IPR[Copy_uint8InterruptType] = Copy_uint8Priority<<7 | Copy_uint8SubPriority<<4 ;
-		break;
-	case(Group0Sub16):
-		NVIC -> NVIC_IPR[Copy_uint8InterruptType] = Copy_uint8Priority<<8 | Copy_uint8SubPriority<<4 ;
-		break;
-	default:
-		break;
-
-	}
+    NVIC -> NVIC_IPR[Copy_uint8InterruptType] = MNVIC_uint8EncodePriority(Copy_uint8Priority,Copy_uint8SubPriority);
+}
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidSetSystemPriority(NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Priority,uint8 Copy_uint8SubPriority)
+* \Description     : Set priority and sub_priority of a system handler through SHPR
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Priority number of group ,uint8 Copy_uint8SubPriority number of sub priority
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidSetSystemPriority(NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Priority,uint8 Copy_uint8SubPriority)
+{
+    /*SHPR1 byte 0 is exception 4 (MemManage)*/
+    SCB_SHPR_BYTE[Copy_Exception - 4] = MNVIC_uint8EncodePriority(Copy_uint8Priority,Copy_uint8SubPriority);
+}
+
+/******************************************************************************
+* \Syntax          : uint8 MNVIC_uint8EncodePriority(uint8 Copy_uint8Priority , uint8 Copy_uint8SubPriority)
+* \Description     : priority register byte of (group , sub) priority under the current grouping
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Priority number of group ,uint8 Copy_uint8SubPriority number of sub priority
+* \Parameters (out): None
+* \Return value:   : uint8 encoded priority (upper 4 bits used)
+*******************************************************************************/
+uint8 MNVIC_uint8EncodePriority(uint8 Copy_uint8Priority , uint8 Copy_uint8SubPriority)
+{
+    uint32 Local_uint32Grouping = (global_grouping < Group16Sub0) ? Group16Sub0 : global_grouping;
+    return NVIC_ENCODE_PRIORITY(Local_uint32Grouping,Copy_uint8Priority,Copy_uint8SubPriority);
+}
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidApplyPriorityTable(const NVIC_PriorityCfg_t* Copy_pIrqTable , uint8 Copy_uint8IrqCount ,
+*                                                       const NVIC_PriorityCfg_t* Copy_pSystemTable , uint8 Copy_uint8SystemCount)
+* \Description     : program pre-encoded priorities of many IRQs and system handlers, every IPR/SHPR word is written once
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pIrqTable , Copy_uint8IrqCount : IRQ entries , Copy_pSystemTable , Copy_uint8SystemCount : system handler entries
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidApplyPriorityTable(const NVIC_PriorityCfg_t* Copy_pIrqTable , uint8 Copy_uint8IrqCount ,
+                                  const NVIC_PriorityCfg_t* Copy_pSystemTable , uint8 Copy_uint8SystemCount)
+{
+    uint32 Local_uint32Ipr[(NVIC_IRQ_COUNT + 3) / 4];
+    uint32 Local_uint32Shpr[3];
+    uint8 Local_uint8Itr;
+    uint8 Local_uint8Shift;
+
+    /*shadow the registers, patch the listed bytes, write back word by word*/
+    for(Local_uint8Itr = 0; Local_uint8Itr < ((NVIC_IRQ_COUNT + 3) / 4); Local_uint8Itr++)
+    {
+        Local_uint32Ipr[Local_uint8Itr] = NVIC_IPR_WORD[Local_uint8Itr];
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < Copy_uint8IrqCount; Local_uint8Itr++)
+    {
+        if(Copy_pIrqTable[Local_uint8Itr].Number < NVIC_IRQ_COUNT)
+        {
+            Local_uint8Shift = (Copy_pIrqTable[Local_uint8Itr].Number % 4) * 8;
+            Local_uint32Ipr[Copy_pIrqTable[Local_uint8Itr].Number / 4] =
+                (Local_uint32Ipr[Copy_pIrqTable[Local_uint8Itr].Number / 4] & ~(0xFFUL << Local_uint8Shift)) |
+                ((uint32)Copy_pIrqTable[Local_uint8Itr].Encoded << Local_uint8Shift);
+        }
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < ((NVIC_IRQ_COUNT + 3) / 4); Local_uint8Itr++)
+    {
+        NVIC_IPR_WORD[Local_uint8Itr] = Local_uint32Ipr[Local_uint8Itr];
+    }
+
+    for(Local_uint8Itr = 0; Local_uint8Itr < 3; Local_uint8Itr++)
+    {
+        Local_uint32Shpr[Local_uint8Itr] = SCB_SHPR_WORD[Local_uint8Itr];
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < Copy_uint8SystemCount; Local_uint8Itr++)
+    {
+        if((Copy_pSystemTable[Local_uint8Itr].Number >= 4) && (Copy_pSystemTable[Local_uint8Itr].Number <= 15))
+        {
+            Local_uint8Shift = ((Copy_pSystemTable[Local_uint8Itr].Number - 4) % 4) * 8;
+            Local_uint32Shpr[(Copy_pSystemTable[Local_uint8Itr].Number - 4) / 4] =
+                (Local_uint32Shpr[(Copy_pSystemTable[Local_uint8Itr].Number - 4) / 4] & ~(0xFFUL << Local_uint8Shift)) |
+                ((uint32)Copy_pSystemTable[Local_uint8Itr].Encoded << Local_uint8Shift);
+        }
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < 3; Local_uint8Itr++)
+    {
+        SCB_SHPR_WORD[Local_uint8Itr] = Local_uint32Shpr[Local_uint8Itr];
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidInitPriorities(void)
+* \Description     : boot time: select NVIC_PRIORITY_GROUPING and apply NVIC_IRQ_PRIORITIES and NVIC_SYSTEM_PRIORITIES
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidInitPriorities(void)
+{
+    MNVIC_VoidSetPriorityPolicy(NVIC_PRIORITY_GROUPING);
+    MNVIC_VoidApplyPriorityTable(NVIC_IrqPriorities,sizeof(NVIC_IrqPriorities) / sizeof(NVIC_IrqPriorities[0]),
+                                 NVIC_SystemPriorities,sizeof(NVIC_SystemPriorities) / sizeof(NVIC_SystemPriorities[0]));
+}
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidApplySystemPriority(NVIC_SystemException_t Copy_Exception)
+* \Description     : program one system handler with its NVIC_SYSTEM_PRIORITIES entry , for drivers that start their
+*                    exception after boot. an exception missing from the table keeps its current priority
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_SystemException_t Copy_Exception
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidApplySystemPriority(NVIC_SystemException_t Copy_Exception)
+{
+    uint8 Local_uint8Itr;
+
+    for(Local_uint8Itr = 0; Local_uint8Itr < (sizeof(NVIC_SystemPriorities) / sizeof(NVIC_SystemPriorities[0])); Local_uint8Itr++)
+    {
+        if((NVIC_SystemPriorities[Local_uint8Itr].Number == Copy_Exception) && (Copy_Exception >= 4) && (Copy_Exception <= 15))
+        {
+            SCB_SHPR_BYTE[Copy_Exception - 4] = NVIC_SystemPriorities[Local_uint8Itr].Encoded;
+            return;
+        }
+    }
 }
 
 /******************************************************************************
@@ -94,7 +215,7 @@ void MNVIC_VoidSetPriority(NVIC_InterruptType_t Copy_uint8InterruptType , uint8
 *******************************************************************************/
 void MNVIC_VoidEnableInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 {
-    SET_BIT(NVIC->NVIC_ISER[Copy_uint8InterruptType/reg_div],Copy_uint8InterruptType%reg_div); 
+    NVIC->NVIC_ISER[Copy_uint8InterruptType/reg_div] = (1UL << (Copy_uint8InterruptType%reg_div)); 
 }
 /******************************************************************************
 * \Syntax          : void MNVIC_VoidDisableInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)                                      
@@ -107,7 +228,8 @@ void MNVIC_VoidEnableInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 *******************************************************************************/
 void MNVIC_VoidDisableInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 {
-    SET_BIT(NVIC->NVIC_ICER[Copy_uint8InterruptType/reg_div],Copy_uint8InterruptType%reg_div);
+    /*set/clear registers ignore zeros: a read-modify-write here would write back every enabled line as 1*/
+    NVIC->NVIC_ICER[Copy_uint8InterruptType/reg_div] = (1UL << (Copy_uint8InterruptType%reg_div));
 }
 /******************************************************************************
 * \Syntax          : void MNVIC_VoidSetPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)                                      
@@ -120,7 +242,7 @@ void MNVIC_VoidDisableInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 *******************************************************************************/
 void MNVIC_VoidSetPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 {
-    SET_BIT(NVIC->NVIC_ISPR[Copy_uint8InterruptType/reg_div],Copy_uint8InterruptType%reg_div);
+    NVIC->NVIC_ISPR[Copy_uint8InterruptType/reg_div] = (1UL << (Copy_uint8InterruptType%reg_div));
 }
 /******************************************************************************
 * \Syntax          : void MNVIC_VoidClearPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)                                      
@@ -133,5 +255,98 @@ void MNVIC_VoidSetPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 *******************************************************************************/
 void MNVIC_VoidClearPendingInterrupt(NVIC_InterruptType_t Copy_uint8InterruptType)
 {
-    SET_BIT(NVIC->NVIC_ICPR[Copy_uint8InterruptType/reg_div],Copy_uint8InterruptType%reg_div);
+    NVIC->NVIC_ICPR[Copy_uint8InterruptType/reg_div] = (1UL << (Copy_uint8InterruptType%reg_div));
+}
+
+#if NVIC_RAM_VECTOR_TABLE == 1
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidRelocateVectorTable(void)
+* \Description     : copy the flash vector table to aligned SRAM and switch VTOR to it (done once, later calls do nothing)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidRelocateVectorTable(void)
+{
+    uint8 Local_uint8Itr;
+    if(SCB_VTOR == (uint32)NVIC_RamVectors)
+    {
+        return;
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < NVIC_VECTOR_COUNT; Local_uint8Itr++)
+    {
+        NVIC_RamVectors[Local_uint8Itr] = vectors[Local_uint8Itr];
+    }
+    /*table complete in memory before the core fetches vectors from it*/
+    NVIC_DSB_ISB();
+    SCB_VTOR = (uint32)NVIC_RamVectors;
+    NVIC_DSB_ISB();
+}
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidAttachHandler(NVIC_InterruptType_t Copy_uint8InterruptType , void (*Copy_pHandler)(void))
+* \Description     : write a handler straight into the SRAM vector table (relocates it on first use), the handler is
+*                    entered by the hardware with no driver dispatch in between so it must clear its own flags.
+*                    NULL restores the handler linked in the flash table
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_InterruptType_t Copy_uint8InterruptType Interrupt name , void (*Copy_pHandler)(void) ISR
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidAttachHandler(NVIC_InterruptType_t Copy_uint8InterruptType , void (*Copy_pHandler)(void))
+{
+    uint8 Local_uint8Vector = 16 + Copy_uint8InterruptType;
+    if(Copy_uint8InterruptType >= NVIC_IRQ_COUNT)
+    {
+        return;
+    }
+    MNVIC_VoidRelocateVectorTable();
+    NVIC_RamVectors[Local_uint8Vector] = (Copy_pHandler != NULL) ? Copy_pHandler : vectors[Local_uint8Vector];
+    /*an interrupt taken right after this call must see the new entry*/
+    NVIC_DSB_ISB();
+}
+
+/******************************************************************************
+* \Syntax          : void MNVIC_VoidAttachSystemHandler(NVIC_SystemException_t Copy_Exception , void (*Copy_pHandler)(void))
+* \Description     : same as MNVIC_VoidAttachHandler for a system exception (SysTick , PendSV , SVCall , faults)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : NVIC_SystemException_t Copy_Exception : 2..15 (0 and 1 are the initial SP and reset , not
+*                    handlers , anything else is ignored) , void (*Copy_pHandler)(void) handler
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MNVIC_VoidAttachSystemHandler(NVIC_SystemException_t Copy_Exception , void (*Copy_pHandler)(void))
+{
+    if(((uint32)Copy_Exception < 2) || ((uint32)Copy_Exception >= 16))
+    {
+        return;
+    }
+    MNVIC_VoidRelocateVectorTable();
+    NVIC_RamVectors[Copy_Exception] = (Copy_pHandler != NULL) ? Copy_pHandler : vectors[Copy_Exception];
+    NVIC_DSB_ISB();
+}
+
+/******************************************************************************
+* \Syntax          : void (*MNVIC_pGetVectorHandler(uint8 Copy_uint8Vector))(void)
+* \Description     : handler currently installed in the SRAM vector table (relocates it on first use), lets a
+*                    wrapper chain to the handler it replaces. vector = exception number (IRQ + 16)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : 1..NVIC_VECTOR_COUNT-1
+* \Parameters (out): None
+* \Return value:   : handler , NULL for an invalid vector
+*******************************************************************************/
+void (*MNVIC_pGetVectorHandler(uint8 Copy_uint8Vector))(void)
+{
+    if((Copy_uint8Vector == 0) || (Copy_uint8Vector >= NVIC_VECTOR_COUNT))
+    {
+        return NULL;
+    }
+    MNVIC_VoidRelocateVectorTable();
+    return NVIC_RamVectors[Copy_uint8Vector];
 }
+#endif
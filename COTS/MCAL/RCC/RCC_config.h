@@ -25,28 +25,75 @@
 //#define RCC_CLOCK_TYPE    RCC_HSE_CRYSTAL
 #define RCC_CLOCK_TYPE    RCC_HSI
 
+/* frequency of the crystal or of the external clock on OSC_IN (4 - 16 MHZ) */
+#define RCC_HSE_FREQUENCY_HZ        8000000UL
 
-/* Options:    0    NO_DIV
-               0x8  /2
-               0x9  /4
-               0xA  /8
-               0xB  /16
-               0xC  /32
-               0xD  /64
-               0xE  /128
-               0xF  /512
-               			   */
-#define RCC_CLOCK_APB_PRESC_VALUE   0      
+/*__________________________________________________________________________*/
+/* bus prescalers (divisor values)
+   AHB  : 1 , 2 , 4 , 8 , 16 , 64 , 128 , 256 , 512
+   APB1 : 1 , 2 , 4 , 8 , 16   (PCLK1 at most 36 MHZ)
+   APB2 : 1 , 2 , 4 , 8 , 16   (PCLK2 at most 72 MHZ) */
+#define RCC_AHB_PRESCALER           1
+#define RCC_APB1_PRESCALER          2
+#define RCC_APB2_PRESCALER          1
+
+/* flash prefetch buffer: 1 enabled (needed for zero wait fetch above 24 MHZ) , 0 disabled */
+#define RCC_FLASH_PREFETCH          1
+
+/* polling iterations before a wait on HSERDY , PLLRDY or SWS is abandoned (about 5 cycles each) */
+#define RCC_READY_TIMEOUT           50000UL
 /*__________________________________________________________________________*/
 /* Note: Select value only if you have PLL as input clock source */
 #if RCC_CLOCK_TYPE == RCC_PLL
 
-/* Options:  	RCC_PLL_IN_HSI
-				RCC_PLL_IN_HSE      */
-#define 	RCC_PLL_INPUT     RCC_PLL_IN_HSI
+/* Options:  	RCC_PLL_IN_HSI          HSI / 2 (4 MHZ)
+				RCC_PLL_IN_HSE
+				RCC_PLL_IN_HSE_DIV2      */
+#define 	RCC_PLL_INPUT     RCC_PLL_IN_HSE
 
-/* Options:  */ 
-#define 	PLL_MUL_VALUE     	0x00033F03 	//support clk of 84MHZ --> (PLLN = 252, PLLM = 3, PLLP = 8)
+/* HSE feeding the PLL: 0 crystal , 1 external clock (bypass) */
+#define     RCC_PLL_HSE_BYPASS  0
+
+/* Options: 2 .. 16 , PLL output at most 72 MHZ: 8 MHZ HSE x 9 = 72 MHZ */
+#define 	RCC_PLL_MUL       	9
 #endif 
 
+/*__________________________________________________________________________*/
+/* run modes for MRCC_Std_ReturnTypeSetClockMode , the index in the list is the mode number
+   RCC_CLOCK_MODE(SOURCE , PLL_INPUT , PLL_MUL , AHB , APB1 , APB2 , RUN_CURRENT_UA)
+   SOURCE    : RCC_HSI , RCC_HSE_CRYSTAL , RCC_HSE_RC or RCC_PLL (PLL_INPUT and PLL_MUL only used by RCC_PLL)
+   RUN_CURRENT_UA : estimated run current , datasheet typical (code in flash , peripherals clocks off)
+   a mode over 72 MHZ SYSCLK or 36 MHZ PCLK1 or with an invalid prescaler does not compile */
+#define RCC_CLOCK_MODES     {                                                                   \
+    RCC_CLOCK_MODE(RCC_HSI , RCC_PLL_IN_HSI , 2 , 1 , 1 , 1 , 4200UL) ,       /*  8 MHZ */     \
+    RCC_CLOCK_MODE(RCC_PLL , RCC_PLL_IN_HSE , 3 , 1 , 1 , 1 , 9300UL) ,       /* 24 MHZ */     \
+    RCC_CLOCK_MODE(RCC_PLL , RCC_PLL_IN_HSE , 9 , 1 , 2 , 1 , 27000UL)        /* 72 MHZ */     \
+}
+#define RCC_MODE_8MHZ       0
+#define RCC_MODE_24MHZ      1
+#define RCC_MODE_72MHZ      2
+
+/* HSE of the run modes: 0 crystal , 1 external clock (bypass) */
+#define RCC_MODES_HSE_BYPASS        0
+
+/* drivers notified around a clock change (UART , CAN , SysTick ...) */
+#define RCC_MAX_CLOCK_CALLBACKS     8
+
+/*__________________________________________________________________________*/
+/* clock holders: bit number in the holder mask of every peripheral clock (0 .. 31) */
+#define RCC_CLIENT_APP              0
+#define RCC_CLIENT_UART1            1
+#define RCC_CLIENT_CAN              2
+#define RCC_CLIENT_TIM              3
+#define RCC_CLIENT_SOFT_I2C         4
+#define RCC_CLIENT_SOFT_SPI         5
+#define RCC_CLIENT_SWPWM            6
+#define RCC_CLIENT_ENCODER          7
+
+/* clocks switched on by MRCC_VoidInitClocks with one write per enable register , drivers taking the same clock
+   later only add themselves as holders: RCC_CLOCK(BUS , PERIPHERAL , CLIENT) */
+#define RCC_BOOT_CLOCKS     {                                                   \
+    RCC_CLOCK(RCC_APB2 , PERIPHERAL_EN_IOPA , RCC_CLIENT_APP)                   \
+}
+
 #endif
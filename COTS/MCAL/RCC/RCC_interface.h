@@ -21,8 +21,8 @@
 #include "../../LIB//Std_Types.h"
 #include "../../LIB//Bit_Math.h"
 
-#include "RCC_private.h"
 #include "RCC_config.h"
+#include "RCC_private.h"
 
 
 
@@ -89,20 +89,214 @@
 
 /*****************************************************************************************/
 
+/*events passed to the clock change callbacks*/
+#define RCC_CLOCK_PRE_CHANGE        0
+#define RCC_CLOCK_POST_CHANGE       1
+
+/*MRCC_uint8GetClockMode: configuration tree of MRCC_Std_ReturnTypeInitSysClock , HSI after a failed change*/
+#define RCC_BOOT_MODE               0xFE
+#define RCC_FALLBACK_MODE           0xFF
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+	uint32 SwitchUs;        /*rebuilding the tree: HSE start up , PLL lock , SYSCLK switch*/
+	uint32 RetimeUs;        /*driver callbacks after the change*/
+}RCC_SwitchStats_t;
+
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTION PROTOTYPES
 ---------------------------------------------------------------------------------------------------------------------*/ 
 /******************************************************************************
-* \Syntax          : void MRCC_voidInitSysClock(void)                                      
-* \Description     : initialize RCC using configuration by parsing all 
-*       its configurations to the RCC registers                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : Non Reentrant                                             
-* \Parameters (in) : None                   
-* \Parameters (out): None                                                      
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeInitSysClock(void)
+* \Description     : build the clock tree of the configuration: flash wait states and prefetch , bus prescalers ,
+*                    HSE and PLL , then switch SYSCLK. the tree is rebuilt from HSI so it may be called again.
+*                    the frequencies returned by the MRCC_u32Get functions follow the new tree
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK HSE or PLL did not become ready (SYSCLK stays on HSI)
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeInitSysClock(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeSetClockMode(uint8 Copy_uint8Mode)
+* \Description     : switch at run time to a mode of RCC_CLOCK_MODES. the registered drivers are called with
+*                    RCC_CLOCK_PRE_CHANGE (finish or hold traffic) , the tree is rebuilt through HSI with the flash
+*                    wait states raised before the faster clock runs , then RCC_CLOCK_POST_CHANGE lets them derive
+*                    their divisors from the new frequencies. thread context only , timestamps drift by the switch time
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Mode : index in RCC_CLOCK_MODES
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid mode or HSE / PLL not ready (SYSCLK on HSI , drivers retimed for it)
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeSetClockMode(uint8 Copy_uint8Mode);
+
+/******************************************************************************
+* \Syntax          : uint8 MRCC_uint8GetClockMode(void)
+* \Description     : mode in use
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint8 index in RCC_CLOCK_MODES , RCC_BOOT_MODE (configuration tree) or RCC_FALLBACK_MODE (HSI
+*                    after a failed switch)
+*******************************************************************************/
+uint8 MRCC_uint8GetClockMode(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeRegisterClockCallback(void (*Copy_pCallback)(uint8 Copy_uint8Event))
+* \Description     : called before (RCC_CLOCK_PRE_CHANGE) and after (RCC_CLOCK_POST_CHANGE) every clock change , in
+*                    registration order. drivers register once from their init
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : void (*Copy_pCallback)(uint8 Copy_uint8Event)
+* \Parameters (out): None
+* \Return value:   : OK , N_OK NULL , already registered or RCC_MAX_CLOCK_CALLBACKS reached
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeRegisterClockCallback(void (*Copy_pCallback)(uint8 Copy_uint8Event));
+
+/******************************************************************************
+* \Syntax          : void MRCC_VoidGetSwitchStats(RCC_SwitchStats_t* Copy_pStats)
+* \Description     : duration of the last successful clock change: tree switch (HSE start , PLL lock) and driver
+*                    re-timing , measured with the DWT cycle counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): RCC_SwitchStats_t* Copy_pStats
+* \Return value:   : None
+*******************************************************************************/
+void MRCC_VoidGetSwitchStats(RCC_SwitchStats_t* Copy_pStats);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_uint32GetRunCurrentUa(uint8 Copy_uint8Mode)
+* \Description     : estimated run current of a mode (RCC_CLOCK_MODES table , datasheet typical values)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Mode
+* \Parameters (out): None
+* \Return value:   : uint32 microamperes , 0 unknown mode
+*******************************************************************************/
+uint32 MRCC_uint32GetRunCurrentUa(uint8 Copy_uint8Mode);
+
+/******************************************************************************
+* \Syntax          : void MRCC_VoidInvalidateClocks(void)
+* \Description     : drop the cached bus frequencies , call after writing CFGR outside this driver
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
 * \Return value:   : None
 *******************************************************************************/
-void MRCC_voidInitSysClock(void);
+void MRCC_VoidInvalidateClocks(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetSysClk(void)
+* \Description     : SYSCLK frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetSysClk(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetHclk(void)
+* \Description     : AHB clock (HCLK , core and SysTick) frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetHclk(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetPclk1(void)
+* \Description     : APB1 clock (PCLK1 , CAN , USART2/3 , I2C) frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetPclk1(void);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetPclk2(void)
+* \Description     : APB2 clock (PCLK2 , USART1 , SPI1 , GPIO) frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetPclk2(void);
+
+/******************************************************************************
+* \Syntax          : void MRCC_VoidInitClocks(void)
+* \Description     : switch on the clocks of RCC_BOOT_CLOCKS with one read-modify-write per enable register and
+*                    record their holders. call once after MRCC_Std_ReturnTypeInitSysClock , before the drivers
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MRCC_VoidInitClocks(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeGetClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+* \Description     : take a peripheral clock for a client , the enable bit is written only by the first holder.
+*                    taking a clock already held by the same client changes nothing
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier , Copy_uint8PeripheralId Peripherral identifier ,
+*                    Copy_uint8Client RCC_CLIENT_xxx
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid bus , peripheral or client
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeGetClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypePutClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+* \Description     : release a peripheral clock , it is gated off when its last holder releases it
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier , Copy_uint8PeripheralId Peripherral identifier ,
+*                    Copy_uint8Client RCC_CLIENT_xxx
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid arguments or the client does not hold the clock
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypePutClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_uint32GetClockHolders(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId)
+* \Description     : clients holding a peripheral clock
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier , Copy_uint8PeripheralId Peripherral identifier
+* \Parameters (out): None
+* \Return value:   : uint32 mask of RCC_CLIENT_xxx bits , 0 clock not held (or invalid arguments)
+*******************************************************************************/
+uint32 MRCC_uint32GetClockHolders(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId);
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_uint32GetEnabledClocks(uint8 Copy_uint8BusId)
+* \Description     : enable register of a bus as the hardware has it (includes clocks enabled outside the manager
+*                    and the SRAM / FLITF clocks enabled at reset)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier
+* \Parameters (out): None
+* \Return value:   : uint32 enable bits , 0 invalid bus
+*******************************************************************************/
+uint32 MRCC_uint32GetEnabledClocks(uint8 Copy_uint8BusId);
 
 /******************************************************************************
 * \Syntax          : void MRCC_voidEnableClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId)                                      
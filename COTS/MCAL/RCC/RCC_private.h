@@ -50,15 +50,194 @@ typedef struct{
 /* PLL Options */
 #define RCC_PLL_IN_HSI       0
 #define RCC_PLL_IN_HSE       1
+#define RCC_PLL_IN_HSE_DIV2  2
 
 /*RCC_CFGR Register Bits*/
 #define SW0        			 0
 #define SW1        			 1
-#define PLLSRC     			 22
+#define SWS0       			 2
+#define HPRE0      			 4
+#define PPRE10     			 8
+#define PPRE20     			 11
+#define PLLSRC     			 16
+#define PLLXTPRE   			 17
+#define PLLMUL0    			 18
+
+#define RCC_CFGR_SW_MASK     (0x3UL << SW0)
+#define RCC_CFGR_SWS_MASK    (0x3UL << SWS0)
+#define RCC_CFGR_BUS_MASK    ((0xFUL << HPRE0) | (0x7UL << PPRE10) | (0x7UL << PPRE20))
+#define RCC_CFGR_PLL_MASK    ((0x1UL << PLLSRC) | (0x1UL << PLLXTPRE) | (0xFUL << PLLMUL0))
+
+/*SW / SWS values*/
+#define RCC_SW_HSI           0UL
+#define RCC_SW_HSE           1UL
+#define RCC_SW_PLL           2UL
 
 /*RCC_CR Register Bits*/
+#define HSI_ON     			 0
+#define HSI_RDY    			 1
+#define HSE_ON     			 16
+#define HSE_RDY    			 17
+#define HSE_BYP    			 18
 #define PLL_ON     			 24
+#define PLL_RDY    			 25
+
+/*FLASH access control register: wait states and prefetch buffer*/
+#define FLASH_ACR            (*((volatile uint32*)0x40022000))
+#define FLASH_ACR_LATENCY_MASK  0x7UL
+#define FLASH_ACR_PRFTBE     4
+
+#define RCC_HSI_FREQUENCY_HZ 8000000UL
+
+/*CFGR fields read back by the clock queries*/
+#define RCC_CFGR_HPRE(CFGR)     (((CFGR) >> HPRE0) & 0xFUL)
+#define RCC_CFGR_PPRE1(CFGR)    (((CFGR) >> PPRE10) & 0x7UL)
+#define RCC_CFGR_PPRE2(CFGR)    (((CFGR) >> PPRE20) & 0x7UL)
+#define RCC_CFGR_PLLMUL(CFGR)   (((CFGR) >> PLLMUL0) & 0xFUL)
+
+/*CFGR prescaler fields from divisor values , 0xFF: no such divisor*/
+#define RCC_AHB_CODE(DIV)    (((DIV) == 1) ? 0x0 : ((DIV) == 2) ? 0x8 : ((DIV) == 4) ? 0x9 : ((DIV) == 8) ? 0xA :       \
+                              ((DIV) == 16) ? 0xB : ((DIV) == 64) ? 0xC : ((DIV) == 128) ? 0xD : ((DIV) == 256) ? 0xE : \
+                              ((DIV) == 512) ? 0xF : 0xFF)
+#define RCC_APB_CODE(DIV)    (((DIV) == 1) ? 0x0 : ((DIV) == 2) ? 0x4 : ((DIV) == 4) ? 0x5 : ((DIV) == 8) ? 0x6 :       \
+                              ((DIV) == 16) ? 0x7 : 0xFF)
+
+/*wait states for a SYSCLK frequency: 0 up to 24 MHZ , 1 up to 48 MHZ , 2 up to 72 MHZ*/
+#define RCC_FLASH_LATENCY(HZ)   (((HZ) <= 24000000UL) ? 0UL : ((HZ) <= 48000000UL) ? 1UL : 2UL)
+
+/*run modes: tree description used by the switch*/
+typedef struct
+{
+	uint32 Cfgr;            /*prescaler and PLL fields*/
+	uint32 SysClkHz;
+	uint32 RunCurrentUa;
+	uint8  Switch;          /*RCC_SW_xxx*/
+	uint8  UseHse;
+	uint8  HseBypass;
+	uint8  Latency;         /*flash wait states*/
+}RCC_ClockMode_t;
+
+#define RCC_MODE_PLL_INPUT_HZ(IN)       (((IN) == RCC_PLL_IN_HSI) ? (RCC_HSI_FREQUENCY_HZ / 2UL) :                   \
+                                         ((IN) == RCC_PLL_IN_HSE) ? RCC_HSE_FREQUENCY_HZ : (RCC_HSE_FREQUENCY_HZ / 2UL))
+#define RCC_MODE_SYSCLK_HZ(SRC,IN,MUL)  (((SRC) == RCC_HSI) ? RCC_HSI_FREQUENCY_HZ :                                \
+                                         ((SRC) == RCC_PLL) ? (RCC_MODE_PLL_INPUT_HZ(IN) * (MUL)) : RCC_HSE_FREQUENCY_HZ)
+#define RCC_MODE_SW(SRC)                (((SRC) == RCC_HSI) ? RCC_SW_HSI : ((SRC) == RCC_PLL) ? RCC_SW_PLL : RCC_SW_HSE)
+#define RCC_MODE_USE_HSE(SRC,IN)        ((((SRC) == RCC_HSE_CRYSTAL) || ((SRC) == RCC_HSE_RC) ||                     \
+                                          (((SRC) == RCC_PLL) && ((IN) != RCC_PLL_IN_HSI))) ? 1 : 0)
+#define RCC_MODE_PLL_CFGR(SRC,IN,MUL)   (((SRC) != RCC_PLL) ? 0UL :                                                  \
+                                         ((((IN) == RCC_PLL_IN_HSI) ? 0UL : (1UL << PLLSRC)) |                        \
+                                          (((IN) == RCC_PLL_IN_HSE_DIV2) ? (1UL << PLLXTPRE) : 0UL) |                 \
+                                          ((uint32)((MUL) - 2) << PLLMUL0)))
+#define RCC_MODE_BUS_CFGR(AHB,APB1,APB2)    (((uint32)RCC_AHB_CODE(AHB) << HPRE0) | ((uint32)RCC_APB_CODE(APB1) << PPRE10) | \
+                                             ((uint32)RCC_APB_CODE(APB2) << PPRE20))
+/*limits of a run mode , a mode breaking one does not compile (negative array size)*/
+#define RCC_MODE_VALID(SRC,IN,MUL,AHB,APB1,APB2)                                                                     \
+                                        ((RCC_AHB_CODE(AHB) != 0xFF) && (RCC_APB_CODE(APB1) != 0xFF) &&              \
+                                         (RCC_APB_CODE(APB2) != 0xFF) &&                                             \
+                                         (((SRC) != RCC_PLL) || (((MUL) >= 2) && ((MUL) <= 16))) &&                  \
+                                         (RCC_MODE_SYSCLK_HZ(SRC,IN,MUL) <= 72000000UL) &&                           \
+                                         ((RCC_MODE_SYSCLK_HZ(SRC,IN,MUL) / (AHB) / (APB1)) <= 36000000UL))
+#define RCC_MODE_CHECK(COND)            (0UL * sizeof(char[(COND) ? 1 : -1]))
+
+#define RCC_CLOCK_MODE(SRC,IN,MUL,AHB,APB1,APB2,CURRENT_UA)                                                          \
+    {                                                                                                                 \
+        RCC_MODE_BUS_CFGR(AHB,APB1,APB2) | RCC_MODE_PLL_CFGR(SRC,IN,MUL) ,                                            \
+        RCC_MODE_SYSCLK_HZ(SRC,IN,MUL) + RCC_MODE_CHECK(RCC_MODE_VALID(SRC,IN,MUL,AHB,APB1,APB2)) ,                  \
+        (CURRENT_UA) , RCC_MODE_SW(SRC) , RCC_MODE_USE_HSE(SRC,IN) , ((SRC) == RCC_HSE_RC) ? 1 : RCC_MODES_HSE_BYPASS ,\
+        RCC_FLASH_LATENCY(RCC_MODE_SYSCLK_HZ(SRC,IN,MUL))                                                             \
+    }
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  CONFIGURATION DERIVED VALUES AND CHECKS
+---------------------------------------------------------------------------------------------------------------------*/
+#if   RCC_CLOCK_TYPE == RCC_HSE_CRYSTAL
+#define RCC_SW_TARGET        RCC_SW_HSE
+#define RCC_USE_HSE          1
+#define RCC_HSE_BYPASS       0
+#define RCC_CFGR_PLL_VALUE   0UL
+#define RCC_SYSCLK_HZ        RCC_HSE_FREQUENCY_HZ
+#elif RCC_CLOCK_TYPE == RCC_HSE_RC
+#define RCC_SW_TARGET        RCC_SW_HSE
+#define RCC_USE_HSE          1
+#define RCC_HSE_BYPASS       1
+#define RCC_CFGR_PLL_VALUE   0UL
+#define RCC_SYSCLK_HZ        RCC_HSE_FREQUENCY_HZ
+#elif RCC_CLOCK_TYPE == RCC_HSI
+#define RCC_SW_TARGET        RCC_SW_HSI
+#define RCC_USE_HSE          0
+#define RCC_HSE_BYPASS       0
+#define RCC_CFGR_PLL_VALUE   0UL
+#define RCC_SYSCLK_HZ        RCC_HSI_FREQUENCY_HZ
+#elif RCC_CLOCK_TYPE == RCC_PLL
+#if   RCC_PLL_INPUT == RCC_PLL_IN_HSI
+#define RCC_USE_HSE          0
+#define RCC_PLL_INPUT_HZ     (RCC_HSI_FREQUENCY_HZ / 2UL)
+#define RCC_CFGR_PLLSRC_VALUE   0UL
+#elif RCC_PLL_INPUT == RCC_PLL_IN_HSE
+#define RCC_USE_HSE          1
+#define RCC_PLL_INPUT_HZ     RCC_HSE_FREQUENCY_HZ
+#define RCC_CFGR_PLLSRC_VALUE   (0x1UL << PLLSRC)
+#elif RCC_PLL_INPUT == RCC_PLL_IN_HSE_DIV2
+#define RCC_USE_HSE          1
+#define RCC_PLL_INPUT_HZ     (RCC_HSE_FREQUENCY_HZ / 2UL)
+#define RCC_CFGR_PLLSRC_VALUE   ((0x1UL << PLLSRC) | (0x1UL << PLLXTPRE))
+#else
+#error "RCC_PLL_INPUT must be RCC_PLL_IN_HSI , RCC_PLL_IN_HSE or RCC_PLL_IN_HSE_DIV2"
+#endif
+#if (RCC_PLL_MUL < 2) || (RCC_PLL_MUL > 16)
+#error "RCC_PLL_MUL must be 2 .. 16"
+#endif
+#define RCC_SW_TARGET        RCC_SW_PLL
+#define RCC_HSE_BYPASS       RCC_PLL_HSE_BYPASS
+#define RCC_CFGR_PLL_VALUE   (RCC_CFGR_PLLSRC_VALUE | ((RCC_PLL_MUL - 2UL) << PLLMUL0))
+#define RCC_SYSCLK_HZ        (RCC_PLL_INPUT_HZ * RCC_PLL_MUL)
+#else
+#error "RCC_CLOCK_TYPE must be RCC_HSE_CRYSTAL , RCC_HSE_RC , RCC_HSI or RCC_PLL"
+#endif
+
+#if RCC_USE_HSE == 1
+#if (RCC_HSE_BYPASS == 0) && ((RCC_HSE_FREQUENCY_HZ < 4000000UL) || (RCC_HSE_FREQUENCY_HZ > 16000000UL))
+#error "HSE crystal must be 4 .. 16 MHZ"
+#endif
+#if (RCC_HSE_BYPASS == 1) && (RCC_HSE_FREQUENCY_HZ > 25000000UL)
+#error "HSE external clock must be at most 25 MHZ"
+#endif
+#endif
+
+#if RCC_AHB_CODE(RCC_AHB_PRESCALER) == 0xFF
+#error "RCC_AHB_PRESCALER must be 1 , 2 , 4 , 8 , 16 , 64 , 128 , 256 or 512"
+#endif
+#if (RCC_APB_CODE(RCC_APB1_PRESCALER) == 0xFF) || (RCC_APB_CODE(RCC_APB2_PRESCALER) == 0xFF)
+#error "RCC_APB1_PRESCALER and RCC_APB2_PRESCALER must be 1 , 2 , 4 , 8 or 16"
+#endif
+
+#define RCC_HCLK_HZ          (RCC_SYSCLK_HZ / RCC_AHB_PRESCALER)
+#define RCC_PCLK1_HZ         (RCC_HCLK_HZ / RCC_APB1_PRESCALER)
+#define RCC_PCLK2_HZ         (RCC_HCLK_HZ / RCC_APB2_PRESCALER)
+
+#if RCC_SYSCLK_HZ > 72000000UL
+#error "SYSCLK above 72 MHZ"
+#endif
+#if RCC_PCLK1_HZ > 36000000UL
+#error "PCLK1 above 36 MHZ: raise RCC_APB1_PRESCALER"
+#endif
+#if RCC_PCLK2_HZ > 72000000UL
+#error "PCLK2 above 72 MHZ"
+#endif
+
+#define RCC_CFGR_BUS_VALUE   (((uint32)RCC_AHB_CODE(RCC_AHB_PRESCALER) << HPRE0) | \
+                              ((uint32)RCC_APB_CODE(RCC_APB1_PRESCALER) << PPRE10) | \
+                              ((uint32)RCC_APB_CODE(RCC_APB2_PRESCALER) << PPRE20))
 
+/*clock gating: one holder mask per enable bit of AHBENR , APB1ENR , APB2ENR*/
+#define RCC_BUS_COUNT        3
+typedef struct
+{
+	uint8 Bus;
+	uint8 Peripheral;
+	uint8 Client;
+}RCC_ClockRequest_t;
+#define RCC_CLOCK(BUS,PERIPHERAL,CLIENT)    {(BUS) , (PERIPHERAL) , (CLIENT)}
 
 /*Bus Id*/
 #define RCC_AHB      0 
@@ -20,74 +20,586 @@
 //#include "RCC_private.h"
 //#include "RCC_config.h"
 #include "RCC_interface.h"
+#include "../DWT/DWT_interface.h"
+#include "../../LIB/Atomic.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*live bus frequencies , decoded on first use after every clock change (SYSCLK 0: not decoded)*/
+static volatile uint32 RCC_uint32SysClk = 0;
+static uint32 RCC_uint32Hclk = 0;
+static uint32 RCC_uint32Pclk1 = 0;
+static uint32 RCC_uint32Pclk2 = 0;
+
+/*tree of the configuration (RCC_CLOCK_TYPE ...) , checked at compile time in RCC_private.h*/
+static const RCC_ClockMode_t RCC_BootMode =
+{
+	RCC_CFGR_BUS_VALUE | RCC_CFGR_PLL_VALUE , RCC_SYSCLK_HZ , 0 , RCC_SW_TARGET , RCC_USE_HSE , RCC_HSE_BYPASS ,
+	RCC_FLASH_LATENCY(RCC_SYSCLK_HZ)
+};
+static const RCC_ClockMode_t RCC_ClockModes[] = RCC_CLOCK_MODES;
+#define RCC_CLOCK_MODE_COUNT    ((uint8)(sizeof(RCC_ClockModes) / sizeof(RCC_ClockModes[0])))
+
+/*mode in use , RCC_BOOT_MODE after MRCC_Std_ReturnTypeInitSysClock*/
+static uint8 RCC_uint8CurrentMode = RCC_BOOT_MODE;
+
+static void (*RCC_ClockCallbacks[RCC_MAX_CLOCK_CALLBACKS])(uint8 Copy_uint8Event);
+static uint8 RCC_uint8CallbackCount = 0;
+
+/*last switch: HSI cycles from 8 MHZ to the new SYSCLK , core cycles of the driver callbacks*/
+static uint32 RCC_uint32SwitchCycles = 0;
+static RCC_SwitchStats_t RCC_SwitchStats = {0 , 0};
+
+/*clients holding each peripheral clock (bit = RCC_CLIENT_xxx) , the enable bit is set while the mask is not 0*/
+static uint32 RCC_ClockHolders[RCC_BUS_COUNT][32];
+static const RCC_ClockRequest_t RCC_BootClocks[] = RCC_BOOT_CLOCKS;
+
+/*right shift of the AHB prescaler codes 8 .. 15 (/2 .. /512 , there is no /32)*/
+static const uint8 RCC_uint8AhbShift[8] = {1, 2, 3, 4, 6, 7, 8, 9};
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*poll until (register & mask) == value , N_OK after RCC_READY_TIMEOUT iterations*/
+static Std_ReturnType MRCC_Std_ReturnTypeWaitFlag(volatile uint32* Copy_pRegister , uint32 Copy_uint32Mask , uint32 Copy_uint32Value)
+{
+    uint32 Local_uint32Count = RCC_READY_TIMEOUT;
+
+    while(((*Copy_pRegister) & Copy_uint32Mask) != Copy_uint32Value)
+    {
+        if(--Local_uint32Count == 0)
+        {
+            return N_OK;
+        }
+    }
+    return OK;
+}
+
+/*switch the clock tree to a mode , through HSI: PLL and HSE can only be reconfigured while unused and the flash
+  wait states of any mode are safe at 8 MHZ , so they are set before the target runs and never lowered too early.
+  a running HSE or PLL that already matches the mode is kept (no restart , no lock time)*/
+static Std_ReturnType MRCC_Std_ReturnTypeBuildTree(const RCC_ClockMode_t* Copy_pMode)
+{
+	uint32 Local_uint32Start;
+	uint8 Local_uint8KeepPll;
+
+	SET_BIT(RCC->CR , HSI_ON);
+	if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CR , (1UL << HSI_RDY) , (1UL << HSI_RDY)) == N_OK)
+	{
+		return N_OK;
+	}
+	RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW_MASK) | (RCC_SW_HSI << SW0);
+	if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CFGR , RCC_CFGR_SWS_MASK , (RCC_SW_HSI << SWS0)) == N_OK)
+	{
+		return N_OK;
+	}
+	/*all buses at 8 MHZ while waiting: the switch time below is counted in HSI cycles*/
+	RCC->CFGR &= ~RCC_CFGR_BUS_MASK;
+	Local_uint32Start = MDWT_CYCLE_COUNT();
+
+	/*prefetch may only change below 24 MHZ without AHB prescaler: true here*/
+	FLASH_ACR = (FLASH_ACR & ~(FLASH_ACR_LATENCY_MASK | (1UL << FLASH_ACR_PRFTBE))) |
+	            Copy_pMode->Latency | ((uint32)RCC_FLASH_PREFETCH << FLASH_ACR_PRFTBE);
+
+	Local_uint8KeepPll = ((Copy_pMode->Switch == RCC_SW_PLL) && (READ_BIT(RCC->CR , PLL_RDY) == 1) &&
+	                      ((RCC->CFGR & RCC_CFGR_PLL_MASK) == (Copy_pMode->Cfgr & RCC_CFGR_PLL_MASK))) ? 1 : 0;
+	if(Local_uint8KeepPll == 0)
+	{
+		CLEAR_BIT(RCC->CR , PLL_ON);
+		if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CR , (1UL << PLL_RDY) , 0) == N_OK)
+		{
+			return N_OK;
+		}
+	}
+
+	if(Copy_pMode->UseHse == 0)
+	{
+		/*unused: stop it (the PLL above is off or fed by HSI)*/
+		CLEAR_BIT(RCC->CR , HSE_ON);
+	}
+	else if((READ_BIT(RCC->CR , HSE_RDY) == 0) || (READ_BIT(RCC->CR , HSE_BYP) != Copy_pMode->HseBypass))
+	{
+		/*HSE off while the bypass is selected*/
+		CLEAR_BIT(RCC->CR , HSE_ON);
+		if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CR , (1UL << HSE_RDY) , 0) == N_OK)
+		{
+			return N_OK;
+		}
+		if(Copy_pMode->HseBypass == 1)
+		{
+			SET_BIT(RCC->CR , HSE_BYP);
+		}
+		else
+		{
+			CLEAR_BIT(RCC->CR , HSE_BYP);
+		}
+		SET_BIT(RCC->CR , HSE_ON);
+		if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CR , (1UL << HSE_RDY) , (1UL << HSE_RDY)) == N_OK)
+		{
+			CLEAR_BIT(RCC->CR , HSE_ON);
+			return N_OK;
+		}
+	}
+	else
+	{
+		/*already running with the right bypass*/
+	}
+
+	if((Copy_pMode->Switch == RCC_SW_PLL) && (Local_uint8KeepPll == 0))
+	{
+		/*source and factor while the PLL is off*/
+		RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_PLL_MASK) | (Copy_pMode->Cfgr & RCC_CFGR_PLL_MASK);
+		SET_BIT(RCC->CR , PLL_ON);
+		if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CR , (1UL << PLL_RDY) , (1UL << PLL_RDY)) == N_OK)
+		{
+			CLEAR_BIT(RCC->CR , PLL_ON);
+			return N_OK;
+		}
+	}
+
+	/*prescalers before the switch: APB1 never runs above 36 MHZ*/
+	RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_BUS_MASK) | (Copy_pMode->Cfgr & RCC_CFGR_BUS_MASK);
+	RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW_MASK) | ((uint32)Copy_pMode->Switch << SW0);
+	if(MRCC_Std_ReturnTypeWaitFlag(&RCC->CFGR , RCC_CFGR_SWS_MASK , ((uint32)Copy_pMode->Switch << SWS0)) == N_OK)
+	{
+		return N_OK;
+	}
+	RCC_uint32SwitchCycles = MDWT_CYCLE_COUNT() - Local_uint32Start;
+	return OK;
+}
+
+/*every registered driver , in registration order*/
+static void MRCC_VoidNotifyClockChange(uint8 Copy_uint8Event)
+{
+	uint8 Local_uint8Itr;
+
+	for(Local_uint8Itr = 0; Local_uint8Itr < RCC_uint8CallbackCount; Local_uint8Itr++)
+	{
+		RCC_ClockCallbacks[Local_uint8Itr](Copy_uint8Event);
+	}
+}
+
+/*decode SWS , the PLL fields and the prescalers into the cached frequencies*/
+static void MRCC_VoidUpdateClocks(void)
+{
+	uint32 Local_uint32Cfgr = RCC->CFGR;
+	uint32 Local_uint32SysClk;
+	uint32 Local_uint32Mul;
+	uint32 Local_uint32Code;
+
+	switch((Local_uint32Cfgr & RCC_CFGR_SWS_MASK) >> SWS0)
+	{
+		case RCC_SW_HSE : Local_uint32SysClk = RCC_HSE_FREQUENCY_HZ;
+		break;
+
+		case RCC_SW_PLL :
+			/*codes 0 .. 14: x2 .. x16 , 15: x16 too*/
+			Local_uint32Mul = RCC_CFGR_PLLMUL(Local_uint32Cfgr) + 2UL;
+			if(Local_uint32Mul > 16UL)
+			{
+				Local_uint32Mul = 16UL;
+			}
+			if(READ_BIT(Local_uint32Cfgr , PLLSRC) == 0)
+			{
+				Local_uint32SysClk = (RCC_HSI_FREQUENCY_HZ / 2UL) * Local_uint32Mul;
+			}
+			else
+			{
+				Local_uint32SysClk = (RCC_HSE_FREQUENCY_HZ >> READ_BIT(Local_uint32Cfgr , PLLXTPRE)) * Local_uint32Mul;
+			}
+		break;
+
+		default : Local_uint32SysClk = RCC_HSI_FREQUENCY_HZ;
+		break;
+	}
+
+	Local_uint32Code = RCC_CFGR_HPRE(Local_uint32Cfgr);
+	RCC_uint32Hclk = (Local_uint32Code < 8UL) ? Local_uint32SysClk : (Local_uint32SysClk >> RCC_uint8AhbShift[Local_uint32Code - 8UL]);
+	/*APB codes 0 .. 3: /1 , 4 .. 7: /2 .. /16*/
+	Local_uint32Code = RCC_CFGR_PPRE1(Local_uint32Cfgr);
+	RCC_uint32Pclk1 = (Local_uint32Code < 4UL) ? RCC_uint32Hclk : (RCC_uint32Hclk >> (Local_uint32Code - 3UL));
+	Local_uint32Code = RCC_CFGR_PPRE2(Local_uint32Cfgr);
+	RCC_uint32Pclk2 = (Local_uint32Code < 4UL) ? RCC_uint32Hclk : (RCC_uint32Hclk >> (Local_uint32Code - 3UL));
+	/*written last: a non zero SYSCLK marks the other three valid*/
+	RCC_uint32SysClk = Local_uint32SysClk;
+}
+
+/*enable register of a bus , NULL for an unknown bus*/
+static volatile uint32* MRCC_pGetEnableRegister(uint8 Copy_uint8BusId)
+{
+	volatile uint32* Local_pRegister = NULL;
+
+	switch(Copy_uint8BusId)
+	{
+		case RCC_AHB : Local_pRegister = &RCC->AHBENR;
+		break;
+
+		case RCC_APB1 : Local_pRegister = &RCC->APB1ENR;
+		break;
+
+		case RCC_APB2 : Local_pRegister = &RCC->APB2ENR;
+		break;
+	}
+	return Local_pRegister;
+}
+
+/*clock change with the driver notifications and the switch statistics*/
+static Std_ReturnType MRCC_Std_ReturnTypeApplyMode(const RCC_ClockMode_t* Copy_pMode , uint8 Copy_uint8Mode)
+{
+	Std_ReturnType Local_Std_ReturnTypeState;
+	uint32 Local_uint32Start;
+
+	MDWT_VoidEnableCycleCounter();
+	MRCC_VoidNotifyClockChange(RCC_CLOCK_PRE_CHANGE);
+	Local_Std_ReturnTypeState = MRCC_Std_ReturnTypeBuildTree(Copy_pMode);
+	MRCC_VoidInvalidateClocks();
+	RCC_uint8CurrentMode = (Local_Std_ReturnTypeState == OK) ? Copy_uint8Mode : RCC_FALLBACK_MODE;
+
+	Local_uint32Start = MDWT_CYCLE_COUNT();
+	MRCC_VoidNotifyClockChange(RCC_CLOCK_POST_CHANGE);
+	if(Local_Std_ReturnTypeState == OK)
+	{
+		RCC_SwitchStats.SwitchUs = RCC_uint32SwitchCycles / (RCC_HSI_FREQUENCY_HZ / 1000000UL);
+		/*below 2^32 for re-timing up to 59 ms at 72 MHZ*/
+		RCC_SwitchStats.RetimeUs = ((MDWT_CYCLE_COUNT() - Local_uint32Start) * 1000UL) / (MRCC_u32GetHclk() / 1000UL);
+	}
+	return Local_Std_ReturnTypeState;
+}
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTION IMPLEMENTION
 ---------------------------------------------------------------------------------------------------------------------*/ 
 /******************************************************************************
-* \Syntax          : void MRCC_voidInitSysClock(void)                                      
-* \Description     : initialize RCC using configuration by parsing all 
-*       its configurations to the RCC registers                                                                             
-* \Sync\Async      : Synchronous                                               
-* \Reentrancy      : Non Reentrant                                             
-* \Parameters (in) : None                   
-* \Parameters (out): None                                                      
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeInitSysClock(void)
+* \Description     : build the clock tree of the configuration: flash wait states and prefetch , bus prescalers ,
+*                    HSE and PLL , then switch SYSCLK. the tree is rebuilt from HSI so it may be called again.
+*                    the frequencies returned by the MRCC_u32Get functions follow the new tree
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK HSE or PLL did not become ready (SYSCLK stays on HSI)
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeInitSysClock(void)
+{
+	return MRCC_Std_ReturnTypeApplyMode(&RCC_BootMode , RCC_BOOT_MODE);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeSetClockMode(uint8 Copy_uint8Mode)
+* \Description     : switch at run time to a mode of RCC_CLOCK_MODES. the registered drivers are called with
+*                    RCC_CLOCK_PRE_CHANGE (finish or hold traffic) , the tree is rebuilt through HSI with the flash
+*                    wait states raised before the faster clock runs , then RCC_CLOCK_POST_CHANGE lets them derive
+*                    their divisors from the new frequencies. thread context only , timestamps drift by the switch time
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Mode : index in RCC_CLOCK_MODES
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid mode or HSE / PLL not ready (SYSCLK on HSI , drivers retimed for it)
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeSetClockMode(uint8 Copy_uint8Mode)
+{
+	if(Copy_uint8Mode >= RCC_CLOCK_MODE_COUNT)
+	{
+		return N_OK;
+	}
+	if(Copy_uint8Mode == RCC_uint8CurrentMode)
+	{
+		return OK;
+	}
+	return MRCC_Std_ReturnTypeApplyMode(&RCC_ClockModes[Copy_uint8Mode] , Copy_uint8Mode);
+}
+
+/******************************************************************************
+* \Syntax          : uint8 MRCC_uint8GetClockMode(void)
+* \Description     : mode in use
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint8 index in RCC_CLOCK_MODES , RCC_BOOT_MODE (configuration tree) or RCC_FALLBACK_MODE (HSI
+*                    after a failed switch)
+*******************************************************************************/
+uint8 MRCC_uint8GetClockMode(void)
+{
+	return RCC_uint8CurrentMode;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeRegisterClockCallback(void (*Copy_pCallback)(uint8 Copy_uint8Event))
+* \Description     : called before (RCC_CLOCK_PRE_CHANGE) and after (RCC_CLOCK_POST_CHANGE) every clock change , in
+*                    registration order. drivers register once from their init
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : void (*Copy_pCallback)(uint8 Copy_uint8Event)
+* \Parameters (out): None
+* \Return value:   : OK , N_OK NULL , already registered or RCC_MAX_CLOCK_CALLBACKS reached
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeRegisterClockCallback(void (*Copy_pCallback)(uint8 Copy_uint8Event))
+{
+	uint8 Local_uint8Itr;
+
+	if((Copy_pCallback == NULL) || (RCC_uint8CallbackCount >= RCC_MAX_CLOCK_CALLBACKS))
+	{
+		return N_OK;
+	}
+	for(Local_uint8Itr = 0; Local_uint8Itr < RCC_uint8CallbackCount; Local_uint8Itr++)
+	{
+		if(RCC_ClockCallbacks[Local_uint8Itr] == Copy_pCallback)
+		{
+			return N_OK;
+		}
+	}
+	RCC_ClockCallbacks[RCC_uint8CallbackCount] = Copy_pCallback;
+	RCC_uint8CallbackCount++;
+	return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void MRCC_VoidGetSwitchStats(RCC_SwitchStats_t* Copy_pStats)
+* \Description     : duration of the last successful clock change: tree switch (HSE start , PLL lock) and driver
+*                    re-timing , measured with the DWT cycle counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): RCC_SwitchStats_t* Copy_pStats
 * \Return value:   : None
 *******************************************************************************/
-void MRCC_voidInitSysClock(void)
-{
-	/*APB prescaler facor 1,2 ... ,512*/
-	
-	#if     RCC_CLOCK_TYPE == RCC_HSE_CRYSTAL /* More accurate 4-16 MHZ OSC*/
-		/* Enable HSE with no bypass  HSE_ON = 1 */
-		SET_BIT(RCC->CR ,16);
-		CLEAR_BIT(RCC->CR,18);
-		/* HSE selected as system clock*/
-		SET_BIT(RCC -> CFGR,0);
-		CLEAR_BIT(RCC->CFGR,1);
-	#elif   RCC_CLOCK_TYPE == RCC_HSE_RC /* External clock source (user clock source)*/
-		/* Enable HSE with bypass HSE_ON = 1 , HSE_BYP = 1  */
-		SET_BIT(RCC->CR ,16);
-		SET_BIT(RCC->CR,18);
-		/* HSE selected as system clock*/
-		SET_BIT(RCC -> CFGR,0);
-		CLEAR_BIT(RCC->CFGR,1);
-
-	#elif   RCC_CLOCK_TYPE == RCC_HSI/*8 MHZ*/
-		/* Enable HSI + Trimming(default) = 0 */
-		SET_BIT(RCC->CR ,0);
-		/* HSI selected as system clock*/
-		CLEAR_BIT(RCC -> CFGR,0);
-		CLEAR_BIT(RCC->CFGR,1);
-	#elif   RCC_CLOCK_TYPE == RCC_PLL
-		
-			RCC -> PLLCFGR = PLL_MUL_VALUE;  
-		
-		#if   RCC_PLL_INPUT == RCC_PLL_IN_HSI
-			/*HSI*/
-			SET_BIT(RCC->CR ,0);
-			/*PLL as system clock + HSI*/
-			CLEAR_BIT(RCC->CFGR , SW0);
-			SET_BIT(RCC->CFGR , SW1);
-			CLEAR_BIT(RCC->PLLCFGR , PLLSRC);
-			/*Enable PLL*/
-			SET_BIT(RCC->CR , PLL_ON);
-		
-		#elif RCC_PLL_INPUT == RCC_PLL_IN_HSE
-			/*HSE*/
-			SET_BIT(RCC->CR ,16);
-			/*PLL as system clock + HSE*/
-			CLEAR_BIT(RCC->CFGR , SW0);
-			SET_BIT(RCC->CFGR , SW1);
-			SET_BIT(RCC->PLLCFGR , PLLSRC);
-			/*Enable PLL*/
-			SET_BIT(RCC->CR , PLL_ON);
-		
-		#endif
-	
-	#else
-		#error("You chosed Wrong Clock type")
-	#endif
+void MRCC_VoidGetSwitchStats(RCC_SwitchStats_t* Copy_pStats)
+{
+	*Copy_pStats = RCC_SwitchStats;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_uint32GetRunCurrentUa(uint8 Copy_uint8Mode)
+* \Description     : estimated run current of a mode (RCC_CLOCK_MODES table , datasheet typical values)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Mode
+* \Parameters (out): None
+* \Return value:   : uint32 microamperes , 0 unknown mode
+*******************************************************************************/
+uint32 MRCC_uint32GetRunCurrentUa(uint8 Copy_uint8Mode)
+{
+	return (Copy_uint8Mode < RCC_CLOCK_MODE_COUNT) ? RCC_ClockModes[Copy_uint8Mode].RunCurrentUa : 0;
+}
+
+/******************************************************************************
+* \Syntax          : void MRCC_VoidInvalidateClocks(void)
+* \Description     : drop the cached bus frequencies , call after writing CFGR outside this driver
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MRCC_VoidInvalidateClocks(void)
+{
+	RCC_uint32SysClk = 0;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetSysClk(void)
+* \Description     : SYSCLK frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetSysClk(void)
+{
+	if(RCC_uint32SysClk == 0)
+	{
+		MRCC_VoidUpdateClocks();
+	}
+	return RCC_uint32SysClk;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetHclk(void)
+* \Description     : AHB clock (HCLK , core and SysTick) frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetHclk(void)
+{
+	if(RCC_uint32SysClk == 0)
+	{
+		MRCC_VoidUpdateClocks();
+	}
+	return RCC_uint32Hclk;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetPclk1(void)
+* \Description     : APB1 clock (PCLK1 , CAN , USART2/3 , I2C) frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetPclk1(void)
+{
+	if(RCC_uint32SysClk == 0)
+	{
+		MRCC_VoidUpdateClocks();
+	}
+	return RCC_uint32Pclk1;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_u32GetPclk2(void)
+* \Description     : APB2 clock (PCLK2 , USART1 , SPI1 , GPIO) frequency in HZ , decoded from the RCC registers after every clock change
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MRCC_u32GetPclk2(void)
+{
+	if(RCC_uint32SysClk == 0)
+	{
+		MRCC_VoidUpdateClocks();
+	}
+	return RCC_uint32Pclk2;
+}
+
+/******************************************************************************
+* \Syntax          : void MRCC_VoidInitClocks(void)
+* \Description     : switch on the clocks of RCC_BOOT_CLOCKS with one read-modify-write per enable register and
+*                    record their holders. call once after MRCC_Std_ReturnTypeInitSysClock , before the drivers
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MRCC_VoidInitClocks(void)
+{
+	uint32 Local_uint32Masks[RCC_BUS_COUNT] = {0 , 0 , 0};
+	const RCC_ClockRequest_t* Local_pRequest;
+	uint8 Local_uint8Itr;
+
+	for(Local_uint8Itr = 0; Local_uint8Itr < (sizeof(RCC_BootClocks) / sizeof(RCC_BootClocks[0])); Local_uint8Itr++)
+	{
+		Local_pRequest = &RCC_BootClocks[Local_uint8Itr];
+		if((Local_pRequest->Bus < RCC_BUS_COUNT) && (Local_pRequest->Peripheral <= 31) && (Local_pRequest->Client <= 31))
+		{
+			RCC_ClockHolders[Local_pRequest->Bus][Local_pRequest->Peripheral] |= (1UL << Local_pRequest->Client);
+			Local_uint32Masks[Local_pRequest->Bus] |= (1UL << Local_pRequest->Peripheral);
+		}
+	}
+	for(Local_uint8Itr = 0; Local_uint8Itr < RCC_BUS_COUNT; Local_uint8Itr++)
+	{
+		if(Local_uint32Masks[Local_uint8Itr] != 0)
+		{
+			*MRCC_pGetEnableRegister(Local_uint8Itr) |= Local_uint32Masks[Local_uint8Itr];
+		}
+	}
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypeGetClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+* \Description     : take a peripheral clock for a client , the enable bit is written only by the first holder.
+*                    taking a clock already held by the same client changes nothing
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier , Copy_uint8PeripheralId Peripherral identifier ,
+*                    Copy_uint8Client RCC_CLIENT_xxx
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid bus , peripheral or client
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypeGetClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+{
+	uint32 Local_uint32Saved;
+
+	if((Copy_uint8BusId >= RCC_BUS_COUNT) || (Copy_uint8PeripheralId > 31) || (Copy_uint8Client > 31))
+	{
+		return N_OK;
+	}
+	Local_uint32Saved = Critical_uint32EnterAll();
+	if(RCC_ClockHolders[Copy_uint8BusId][Copy_uint8PeripheralId] == 0)
+	{
+		*MRCC_pGetEnableRegister(Copy_uint8BusId) |= (1UL << Copy_uint8PeripheralId);
+	}
+	RCC_ClockHolders[Copy_uint8BusId][Copy_uint8PeripheralId] |= (1UL << Copy_uint8Client);
+	Critical_VoidExitAll(Local_uint32Saved);
+	return OK;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MRCC_Std_ReturnTypePutClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+* \Description     : release a peripheral clock , it is gated off when its last holder releases it
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier , Copy_uint8PeripheralId Peripherral identifier ,
+*                    Copy_uint8Client RCC_CLIENT_xxx
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid arguments or the client does not hold the clock
+*******************************************************************************/
+Std_ReturnType MRCC_Std_ReturnTypePutClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+{
+	uint32 Local_uint32Saved;
+	Std_ReturnType Local_Std_ReturnTypeState = N_OK;
+
+	if((Copy_uint8BusId >= RCC_BUS_COUNT) || (Copy_uint8PeripheralId > 31) || (Copy_uint8Client > 31))
+	{
+		return N_OK;
+	}
+	Local_uint32Saved = Critical_uint32EnterAll();
+	if((RCC_ClockHolders[Copy_uint8BusId][Copy_uint8PeripheralId] & (1UL << Copy_uint8Client)) != 0)
+	{
+		RCC_ClockHolders[Copy_uint8BusId][Copy_uint8PeripheralId] &= ~(1UL << Copy_uint8Client);
+		if(RCC_ClockHolders[Copy_uint8BusId][Copy_uint8PeripheralId] == 0)
+		{
+			*MRCC_pGetEnableRegister(Copy_uint8BusId) &= ~(1UL << Copy_uint8PeripheralId);
+		}
+		Local_Std_ReturnTypeState = OK;
+	}
+	Critical_VoidExitAll(Local_uint32Saved);
+	return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_uint32GetClockHolders(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId)
+* \Description     : clients holding a peripheral clock
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier , Copy_uint8PeripheralId Peripherral identifier
+* \Parameters (out): None
+* \Return value:   : uint32 mask of RCC_CLIENT_xxx bits , 0 clock not held (or invalid arguments)
+*******************************************************************************/
+uint32 MRCC_uint32GetClockHolders(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId)
+{
+	if((Copy_uint8BusId >= RCC_BUS_COUNT) || (Copy_uint8PeripheralId > 31))
+	{
+		return 0;
+	}
+	return RCC_ClockHolders[Copy_uint8BusId][Copy_uint8PeripheralId];
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MRCC_uint32GetEnabledClocks(uint8 Copy_uint8BusId)
+* \Description     : enable register of a bus as the hardware has it (includes clocks enabled outside the manager
+*                    and the SRAM / FLITF clocks enabled at reset)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_uint8BusId Bus idenifier
+* \Parameters (out): None
+* \Return value:   : uint32 enable bits , 0 invalid bus
+*******************************************************************************/
+uint32 MRCC_uint32GetEnabledClocks(uint8 Copy_uint8BusId)
+{
+	volatile uint32* Local_pRegister = MRCC_pGetEnableRegister(Copy_uint8BusId);
+
+	return (Local_pRegister == NULL) ? 0 : *Local_pRegister;
 }
 
 /******************************************************************************
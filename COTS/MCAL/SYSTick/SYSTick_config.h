@@ -20,6 +20,7 @@
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL MACROS
 ---------------------------------------------------------------------------------------------------------------------*/
+/*the 1 ms timebase reload follows the AHB clock reported by the RCC driver (MRCC_u32GetHclk)*/
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
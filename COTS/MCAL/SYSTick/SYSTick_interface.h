@@ -18,9 +18,9 @@
 ---------------------------------------------------------------------------------------------------------------------*/
 #include "../../LIB//Std_Types.h"
 #include "../../LIB//Bit_Math.h"
-#include "SYSTICK_config.h"
+#include "SYSTick_config.h"
 
-#include "SYSTICK_private.h"
+#include "SYSTick_private.h"
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA TYPES AND STRUCTURES
@@ -76,4 +76,113 @@ void MSYSTICK_VoidStartSYSTICK(uint32 Copy_uint8ReloadValue,void (*SysTick_CallB
 *******************************************************************************/
 void MSYSTICK_VoidDisableSysTick();
 
+/******************************************************************************
+* \Syntax          : uint32 MSYSTICK_uint32GetTickCount(void)
+* \Description     : number of SysTick interrupts since start (wraps around), used as timestamp by other modules
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 tick count
+*******************************************************************************/
+uint32 MSYSTICK_uint32GetTickCount(void);
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidStartTimebase(void)
+* \Description     : run SysTick from AHB at 1 kHZ with its NVIC_SYSTEM_PRIORITIES priority and keep the 64-bit
+*                    millisecond count, replaces any reload started by MSYSTICK_VoidStartSYSTICK (the callback stays)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidStartTimebase(void);
+
+/******************************************************************************
+* \Syntax          : uint64 MSYSTICK_uint64GetTickCount(void)
+* \Description     : 64-bit tick count (milliseconds once the timebase runs), lock-free: the high word is read
+*                    again to detect a carry from the ISR in between
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint64 tick count
+*******************************************************************************/
+uint64 MSYSTICK_uint64GetTickCount(void);
+
+/******************************************************************************
+* \Syntax          : uint64 MSYSTICK_uint64GetTimeUs(void)
+* \Description     : monotonic microseconds since the timebase started: tick count combined with STK_VAL.
+*                    a reload whose interrupt is still pending (SysTick masked by the caller) is detected through
+*                    PENDSTSET and counted, so time never steps back. masking SysTick for more than 1 ms loses ticks
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint64 microseconds , 0 while the timebase is stopped
+*******************************************************************************/
+uint64 MSYSTICK_uint64GetTimeUs(void);
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidDelayUs(uint32 Copy_uint32Microseconds)
+* \Description     : busy wait on the timebase (returns at once while the timebase is stopped)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Microseconds
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidDelayUs(uint32 Copy_uint32Microseconds);
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidDelayMs(uint32 Copy_uint32Milliseconds)
+* \Description     : busy wait on the timebase (returns at once while the timebase is stopped)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Milliseconds
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidDelayMs(uint32 Copy_uint32Milliseconds);
+
+/******************************************************************************
+* \Syntax          : uint8 MSYSTICK_uint8TimeoutExpired(uint64 Copy_uint64StartUs , uint32 Copy_uint32TimeoutUs)
+* \Description     : polling loop guard: Copy_uint64StartUs taken with MSYSTICK_uint64GetTimeUs before the loop.
+*                    never expires while the timebase is stopped (behaves like the unbounded wait it replaces)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint64 Copy_uint64StartUs , uint32 Copy_uint32TimeoutUs
+* \Parameters (out): None
+* \Return value:   : 1 timeout elapsed , 0 otherwise
+*******************************************************************************/
+uint8 MSYSTICK_uint8TimeoutExpired(uint64 Copy_uint64StartUs , uint32 Copy_uint32TimeoutUs);
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidSetCallBack(void (*Copy_pCallBack)(void))
+* \Description     : replace the function called from every SysTick interrupt without touching the counter
+*                    (NULL removes it). one slot only: the software timer service owns it when used
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : void (*Copy_pCallBack)(void)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidSetCallBack(void (*Copy_pCallBack)(void));
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidSleepTicks(uint32 Copy_uint32Ticks)
+* \Description     : tickless idle: stretch the SysTick period to Copy_uint32Ticks (clamped to one 24 bit reload) and
+*                    sleep with WFI, any interrupt ends the sleep early. on wake the elapsed whole ticks are added to
+*                    the count and the counter is put back on its millisecond grid , so timestamps stay exact.
+*                    call with PRIMASK set (Critical_uint32EnterAll) after deciding the sleep length, the interrupt
+*                    that woke the core runs once PRIMASK is restored. 0: returns at once , 1: plain WFI
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint32 Copy_uint32Ticks : ticks until the next deadline
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidSleepTicks(uint32 Copy_uint32Ticks);
+
 #endif
@@ -46,6 +46,27 @@ typedef union
 #define     STK_VAL         ((volatile uint32*)0xE000E018)
 #define     STK_CALIB       ((volatile uint32*)0xE000E01C)
 
+/*interrupt control and state: SysTick pending flag (set on reload until the handler is entered)*/
+#define     SCB_ICSR                ((volatile uint32*)0xE000ED04)
+#define     SCB_ICSR_PENDSTSET      (1UL << 26)
+
+/*timebase: one interrupt per millisecond*/
+#define     SYSTICK_TIMEBASE_HZ     1000UL
+/*24 bit counter*/
+#define     SYSTICK_MAX_RELOAD      0xFFFFFFUL
+
+/*CTRL bits for single reads: reading CTRL clears COUNTFLAG , the bitfield writes would lose it*/
+#define     SYSTICK_CTRL_ENABLE     (1UL << 0)
+#define     SYSTICK_CTRL_COUNTFLAG  (1UL << 16)
+
+/*sleep until an interrupt is pending (wakes even with PRIMASK set) , nothing to wait for in host builds (tests)*/
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define     SYSTICK_WFI()           __asm__ volatile ("dsb\n\twfi\n\tisb" ::: "memory")
+#else
+#define     SYSTICK_WFI()
+#endif
+
+
 
 
 #endif
@@ -15,11 +15,61 @@
  *  INCLUDES
 ---------------------------------------------------------------------------------------------------------------------*/
 #include "SYSTick_interface.h"
+#include "../NVIC/NVIC_Interface.h"
+#include "../RCC/RCC_interface.h"
+#include "../../LIB/Atomic.h"
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
 ---------------------------------------------------------------------------------------------------------------------*/
 static void (*SysTick_CallBack)(void) = NULL;
+/*incremented every SysTick interrupt, free running timestamp (low word of the 64-bit count)*/
+static volatile uint32 SysTick_uint32TickCount = 0;
+static volatile uint32 SysTick_uint32TickCountHigh = 0;
+/*timebase period from the live AHB clock , 0 until MSYSTICK_VoidStartTimebase*/
+static uint32 SysTick_uint32CyclesPerTick = 0;
+static uint32 SysTick_uint32Reload = 0;
+/*tickless idle: longest sleep one 24 bit reload can cover*/
+static uint32 SysTick_uint32MaxSleepTicks = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*count ticks that passed without an interrupt (interrupts masked by the caller)*/
+static void MSYSTICK_VoidAddTicks(uint32 Copy_uint32Ticks)
+{
+    uint32 Local_uint32Count = SysTick_uint32TickCount + Copy_uint32Ticks;
+
+    if(Local_uint32Count < SysTick_uint32TickCount)
+    {
+        SysTick_uint32TickCountHigh++;
+    }
+    SysTick_uint32TickCount = Local_uint32Count;
+}
+
+/*1 ms period from the live AHB clock*/
+static void MSYSTICK_VoidDeriveReload(void)
+{
+    SysTick_uint32Reload = (MRCC_u32GetHclk() / SYSTICK_TIMEBASE_HZ) - 1UL;
+    SysTick_uint32MaxSleepTicks = (SYSTICK_MAX_RELOAD / (SysTick_uint32Reload + 1UL)) - 1UL;
+    SysTick_uint32CyclesPerTick = SysTick_uint32Reload + 1UL;
+}
+
+/*clock change: the reload follows the new AHB clock , the running millisecond restarts (up to 1 ms not counted)*/
+static void MSYSTICK_VoidClockChanged(uint8 Copy_uint8Event)
+{
+    uint32 Local_uint32Saved;
+
+    if((Copy_uint8Event == RCC_CLOCK_POST_CHANGE) && (SysTick_uint32CyclesPerTick != 0))
+    {
+        /*time readers must not mix the old period with the new one*/
+        Local_uint32Saved = Critical_uint32EnterAll();
+        MSYSTICK_VoidDeriveReload();
+        *STK_LOAD = SysTick_uint32Reload;
+        *STK_VAL = 0;
+        Critical_VoidExitAll(Local_uint32Saved);
+    }
+}
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTION IMPLEMENTION
@@ -87,15 +137,283 @@ void MSYSTICK_VoidDisableSysTick()
 
 
 
-/*SysTick Handler */
+/******************************************************************************
+* \Syntax          : uint32 MSYSTICK_uint32GetTickCount(void)
+* \Description     : number of SysTick interrupts since start (wraps around), used as timestamp by other modules
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 tick count
+*******************************************************************************/
+uint32 MSYSTICK_uint32GetTickCount(void)
+{
+    return SysTick_uint32TickCount;
+}
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidStartTimebase(void)
+* \Description     : run SysTick from AHB at 1 kHZ with its NVIC_SYSTEM_PRIORITIES priority and keep the 64-bit
+*                    millisecond count, replaces any reload started by MSYSTICK_VoidStartSYSTICK (the callback stays).
+*                    the reload follows the AHB clock of MRCC_u32GetHclk , also across MRCC_Std_ReturnTypeSetClockMode
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidStartTimebase(void)
+{
+    MSYSTICK_VoidDeriveReload();
+    (void)MRCC_Std_ReturnTypeRegisterClockCallback(MSYSTICK_VoidClockChanged);
+    /*priority from NVIC_SYSTEM_PRIORITIES (most urgent by default: other handlers can read the time and a reload is
+      never held pending for long)*/
+    MNVIC_VoidApplySystemPriority(NVIC_EXC_SYSTICK);
+    MSYSTICK_VoidInit(AHB_CLK);
+    MSYSTICK_VoidStartSYSTICK(SysTick_uint32Reload,NULL);
+}
+
+/******************************************************************************
+* \Syntax          : uint64 MSYSTICK_uint64GetTickCount(void)
+* \Description     : 64-bit tick count (milliseconds once the timebase runs), lock-free: the high word is read
+*                    again to detect a carry from the ISR in between
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint64 tick count
+*******************************************************************************/
+uint64 MSYSTICK_uint64GetTickCount(void)
+{
+    uint32 Local_uint32High;
+    uint32 Local_uint32Low;
+
+    do
+    {
+        Local_uint32High = SysTick_uint32TickCountHigh;
+        Local_uint32Low = SysTick_uint32TickCount;
+    }while(Local_uint32High != SysTick_uint32TickCountHigh);
+    return ((uint64)Local_uint32High << 32) | Local_uint32Low;
+}
+
+/******************************************************************************
+* \Syntax          : uint64 MSYSTICK_uint64GetTimeUs(void)
+* \Description     : monotonic microseconds since the timebase started: tick count combined with STK_VAL.
+*                    a reload whose interrupt is still pending (SysTick masked by the caller) is detected through
+*                    PENDSTSET and counted, so time never steps back. masking SysTick for more than 1 ms loses ticks
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint64 microseconds , 0 while the timebase is stopped
+*******************************************************************************/
+uint64 MSYSTICK_uint64GetTimeUs(void)
+{
+    uint64 Local_uint64Ticks;
+    uint64 Local_uint64Counted;
+    uint32 Local_uint32Value;
+
+    if(SysTick_uint32CyclesPerTick == 0)
+    {
+        return 0;
+    }
+    do
+    {
+        Local_uint64Ticks = MSYSTICK_uint64GetTickCount();
+        Local_uint64Counted = Local_uint64Ticks;
+        Local_uint32Value = *STK_VAL;
+        if((*SCB_ICSR & SCB_ICSR_PENDSTSET) != 0)
+        {
+            /*reloaded , not counted yet: the VAL above may be from before or after the reload, this one is after*/
+            Local_uint32Value = *STK_VAL;
+            if(Local_uint32Value == 0)
+            {
+                /*pended on the 1 -> 0 transition , the reload is the next clock: the counted tick has just begun
+                  (not LOAD cycles into it , that read 1 ms ahead and stepped back after the reload)*/
+                Local_uint32Value = SysTick_uint32Reload;
+            }
+            Local_uint64Counted++;
+        }
+        /*the ISR ran meanwhile: tick and VAL may belong to different milliseconds*/
+    }while(Local_uint64Ticks != MSYSTICK_uint64GetTickCount());
+
+    /*cycles into the tick scaled to microseconds: below 72000 * 1000 , no overflow*/
+    return (Local_uint64Counted * 1000U) + (((SysTick_uint32Reload - Local_uint32Value) * 1000UL) / SysTick_uint32CyclesPerTick);
+}
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidDelayUs(uint32 Copy_uint32Microseconds)
+* \Description     : busy wait on the timebase (returns at once while the timebase is stopped)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Microseconds
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidDelayUs(uint32 Copy_uint32Microseconds)
+{
+    uint64 Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+
+    if(SysTick_uint32CyclesPerTick == 0)
+    {
+        return;
+    }
+    while((MSYSTICK_uint64GetTimeUs() - Local_uint64Start) < Copy_uint32Microseconds);
+}
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidDelayMs(uint32 Copy_uint32Milliseconds)
+* \Description     : busy wait on the timebase (returns at once while the timebase is stopped)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Milliseconds
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidDelayMs(uint32 Copy_uint32Milliseconds)
+{
+    uint64 Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+
+    if(SysTick_uint32CyclesPerTick == 0)
+    {
+        return;
+    }
+    while((MSYSTICK_uint64GetTimeUs() - Local_uint64Start) < ((uint64)Copy_uint32Milliseconds * 1000U));
+}
+
+/******************************************************************************
+* \Syntax          : uint8 MSYSTICK_uint8TimeoutExpired(uint64 Copy_uint64StartUs , uint32 Copy_uint32TimeoutUs)
+* \Description     : polling loop guard: Copy_uint64StartUs taken with MSYSTICK_uint64GetTimeUs before the loop.
+*                    never expires while the timebase is stopped (behaves like the unbounded wait it replaces)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint64 Copy_uint64StartUs , uint32 Copy_uint32TimeoutUs
+* \Parameters (out): None
+* \Return value:   : 1 timeout elapsed , 0 otherwise
+*******************************************************************************/
+uint8 MSYSTICK_uint8TimeoutExpired(uint64 Copy_uint64StartUs , uint32 Copy_uint32TimeoutUs)
+{
+    uint64 Local_uint64Now = MSYSTICK_uint64GetTimeUs();
+
+    if(SysTick_uint32CyclesPerTick == 0)
+    {
+        return 0;
+    }
+    return ((Local_uint64Now - Copy_uint64StartUs) >= Copy_uint32TimeoutUs) ? 1 : 0;
+}
 
-//void SysTick_Handler(void)
-//{
-//
-//	if(SysTick_CallBack != NULL)
-//    {
-//        SysTick_CallBack();
-//    }
-//	STK_CTRL->B.COUNTFLAG = 0U;/*clear interrupt flag*/
-//
-//}
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidSetCallBack(void (*Copy_pCallBack)(void))
+* \Description     : replace the function called from every SysTick interrupt without touching the counter
+*                    (NULL removes it). one slot only: the software timer service owns it when used
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : void (*Copy_pCallBack)(void)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidSetCallBack(void (*Copy_pCallBack)(void))
+{
+    SysTick_CallBack = Copy_pCallBack;
+}
+
+/******************************************************************************
+* \Syntax          : void MSYSTICK_VoidSleepTicks(uint32 Copy_uint32Ticks)
+* \Description     : tickless idle: stretch the SysTick period to Copy_uint32Ticks (clamped to one 24 bit reload) and
+*                    sleep with WFI, any interrupt ends the sleep early. on wake the elapsed whole ticks are added to
+*                    the count and the counter is put back on its millisecond grid , so timestamps stay exact.
+*                    call with PRIMASK set (Critical_uint32EnterAll) after deciding the sleep length, the interrupt
+*                    that woke the core runs once PRIMASK is restored. 0: returns at once , 1: plain WFI
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint32 Copy_uint32Ticks : ticks until the next deadline
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MSYSTICK_VoidSleepTicks(uint32 Copy_uint32Ticks)
+{
+    uint32 Local_uint32Ctrl;
+    uint32 Local_uint32Reload;
+    uint32 Local_uint32Elapsed;
+    uint32 Local_uint32Complete;
+    uint32 Local_uint32Partial;
+
+    if(Copy_uint32Ticks == 0)
+    {
+        return;
+    }
+    if((Copy_uint32Ticks == 1) || (SysTick_uint32CyclesPerTick == 0))
+    {
+        /*the next tick (or any interrupt) wakes the core anyway*/
+        SYSTICK_WFI();
+        return;
+    }
+    if(Copy_uint32Ticks > SysTick_uint32MaxSleepTicks)
+    {
+        Copy_uint32Ticks = SysTick_uint32MaxSleepTicks;
+    }
+
+    /*stop the counter: the cycles left in the current tick are the start of the long period*/
+    Local_uint32Ctrl = STK_CTRL->Reg;
+    STK_CTRL->Reg = Local_uint32Ctrl & ~SYSTICK_CTRL_ENABLE;
+    if(((*SCB_ICSR & SCB_ICSR_PENDSTSET) != 0) || (*STK_VAL == 0))
+    {
+        /*a tick is due right now: let its interrupt run instead of sleeping*/
+        STK_CTRL->Reg = Local_uint32Ctrl | SYSTICK_CTRL_ENABLE;
+        return;
+    }
+    /*the load takes one clock of its own: LOAD + 1 cycles to the next interrupt*/
+    Local_uint32Reload = *STK_VAL + ((Copy_uint32Ticks - 1) * SysTick_uint32CyclesPerTick) - 1;
+    *STK_LOAD = Local_uint32Reload;
+    /*any write clears VAL , the counter loads the long period on the next clock*/
+    *STK_VAL = 0;
+    STK_CTRL->Reg = Local_uint32Ctrl | SYSTICK_CTRL_ENABLE;
+
+    SYSTICK_WFI();
+
+    Local_uint32Ctrl = STK_CTRL->Reg;
+    STK_CTRL->Reg = Local_uint32Ctrl & ~SYSTICK_CTRL_ENABLE;
+    if((Local_uint32Ctrl & SYSTICK_CTRL_COUNTFLAG) != 0)
+    {
+        /*slept the whole period: the pending interrupt counts the last tick ,
+          the counter already runs in the next tick from the long reload*/
+        MSYSTICK_VoidAddTicks(Copy_uint32Ticks - 1);
+        Local_uint32Elapsed = Local_uint32Reload - *STK_VAL;
+        Local_uint32Partial = (Local_uint32Elapsed < SysTick_uint32Reload) ?
+                              (SysTick_uint32Reload - Local_uint32Elapsed) : SysTick_uint32Reload;
+    }
+    else
+    {
+        /*another interrupt: cycles counted since the start of the tick the sleep began in*/
+        Local_uint32Elapsed = (Copy_uint32Ticks * SysTick_uint32CyclesPerTick) - *STK_VAL;
+        Local_uint32Complete = Local_uint32Elapsed / SysTick_uint32CyclesPerTick;
+        MSYSTICK_VoidAddTicks(Local_uint32Complete);
+        /*rest of the current tick , VAL then counts down to the millisecond boundary*/
+        Local_uint32Partial = ((Local_uint32Complete + 1) * SysTick_uint32CyclesPerTick) - Local_uint32Elapsed - 1;
+        if(Local_uint32Partial == 0)
+        {
+            /*on the boundary: LOAD 0 would stop the counter , count the tick and start a full one*/
+            MSYSTICK_VoidAddTicks(1);
+            Local_uint32Partial = SysTick_uint32Reload;
+        }
+    }
+    *STK_LOAD = Local_uint32Partial;
+    *STK_VAL = 0;
+    STK_CTRL->Reg = Local_uint32Ctrl | SYSTICK_CTRL_ENABLE;
+    /*used from the next reload on: back to 1 ms periods*/
+    *STK_LOAD = SysTick_uint32Reload;
+}
+
+/*SysTick Handler */
+void SysTick_Handler(void)
+{
+    /*only writer of the count: the carry needs no atomic update*/
+    if(++SysTick_uint32TickCount == 0)
+    {
+        SysTick_uint32TickCountHigh++;
+    }
+    if(SysTick_CallBack != NULL)
+    {
+        SysTick_CallBack();
+    }
+}
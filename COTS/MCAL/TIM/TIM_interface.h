@@ -0,0 +1,133 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  TIM_interface.h
+ *       Module:  TIM Module
+ *  Description:  Interface header file for general purpose timers (TIM2,TIM3,TIM4) Driver
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _TIM_INTERFACE_H
+#define _TIM_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB//Std_Types.h"
+#include "../../LIB//Bit_Math.h"
+
+#include "TIM_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef enum
+{
+    TIM_2,
+    TIM_3,
+    TIM_4
+}TIM_Num_t;
+
+#define TIM_COUNT                   3
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidInit(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Prescaler)
+* \Description     : Enable timer clock and set its counter clock prescaler, auto reload register is buffered
+*                    so a period written while counting takes effect from the next update event
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint16 Copy_uint16Prescaler : counter clock = TIMxCLK/(Prescaler+1)
+*                    (a raw prescaler does not follow a run time clock change , see MTIM_Std_ReturnTypeSetTickHz)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidInit(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Prescaler);
+
+/******************************************************************************
+* \Syntax          : uint32 MTIM_uint32GetClockHz(void)
+* \Description     : TIMxCLK of TIM2..4 from the live APB1 clock: PCLK1 , doubled when APB1 is divided
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MTIM_uint32GetClockHz(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MTIM_Std_ReturnTypeSetTickHz(TIM_Num_t Copy_uint8Timer , uint32 Copy_uint32TickHz)
+* \Description     : set the counter clock of an initialized timer instead of a raw prescaler. the prescaler is derived
+*                    from MTIM_uint32GetClockHz and derived again after every run time clock change , so the tick keeps
+*                    its length in every clock mode. a new prescaler takes effect at the next update event
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint32 Copy_uint32TickHz : counter clock in HZ
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid timer or tick out of the prescaler range at the current clock
+*******************************************************************************/
+Std_ReturnType MTIM_Std_ReturnTypeSetTickHz(TIM_Num_t Copy_uint8Timer , uint32 Copy_uint32TickHz);
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidSetPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period)
+* \Description     : Write the (buffered) auto reload value, takes effect at the next update event
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint16 Copy_uint16Period : number of counter ticks between updates (>=1)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidSetPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period);
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidLoadPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period)
+* \Description     : Write the auto reload value and force an update event so it applies immediately and counter restarts from 0
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint16 Copy_uint16Period : number of counter ticks between updates (>=1)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidLoadPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period);
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidStart(TIM_Num_t Copy_uint8Timer)
+* \Description     : Start timer counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidStart(TIM_Num_t Copy_uint8Timer);
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidStop(TIM_Num_t Copy_uint8Timer)
+* \Description     : Stop timer counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidStop(TIM_Num_t Copy_uint8Timer);
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidSetUpdateCallback(TIM_Num_t Copy_uint8Timer , void (*callback)(void))
+* \Description     : Register update (overflow) interrupt callback and enable update interrupt of the timer,
+*                    timer IRQ must be enabled in NVIC by the application
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , void (*callback)(void) callback function to be called in interrupt handler
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidSetUpdateCallback(TIM_Num_t Copy_uint8Timer , void (*callback)(void));
+
+#endif
@@ -0,0 +1,64 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  TIM_private.h
+ *       Module:  TIM Module
+ *  Description:  Private header file for general purpose timers (TIM2,TIM3,TIM4) Driver
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _TIM_PRIVATE_H
+#define _TIM_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/* Register Map for general purpose timer */
+typedef struct{
+    volatile uint32 CR1;
+    volatile uint32 CR2;
+    volatile uint32 SMCR;
+    volatile uint32 DIER;
+    volatile uint32 SR;
+    volatile uint32 EGR;
+    volatile uint32 CCMR1;
+    volatile uint32 CCMR2;
+    volatile uint32 CCER;
+    volatile uint32 CNT;
+    volatile uint32 PSC;
+    volatile uint32 ARR;
+    uint32 Reserved1;
+    volatile uint32 CCR[4];
+    uint32 Reserved2;
+    volatile uint32 DCR;
+    volatile uint32 DMAR;
+}TIM_MemoryMap_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define     TIM2_Base_Address        0x40000000            // Base address of TIM2
+#define     TIM3_Base_Address        0x40000400            // Base address of TIM3
+#define     TIM4_Base_Address        0x40000800            // Base address of TIM4
+
+/*timers are 0x400 apart on APB1*/
+#define     TIM_ADDRESS(TIMER)       ((volatile TIM_MemoryMap_t *)(TIM2_Base_Address + ((TIMER) * 0x400)))
+
+/*TIMx_CR1 Register Bits*/
+#define     TIM_CR1_CEN              0
+#define     TIM_CR1_URS              2
+#define     TIM_CR1_ARPE             7
+
+/*TIMx_DIER Register Bits*/
+#define     TIM_DIER_UIE             0
+
+/*TIMx_SR Register Bits*/
+#define     TIM_SR_UIF               0
+
+/*TIMx_EGR Register Bits*/
+#define     TIM_EGR_UG               0
+
+#endif
@@ -0,0 +1,238 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  TIM_program.c
+ *       Module:  TIM Module
+ *  Description:  implementaion C file for general purpose timers (TIM2,TIM3,TIM4) Driver
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "TIM_interface.h"
+#include "../RCC/RCC_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static void (*TIM_UpdateCallBack[TIM_COUNT])(void) = {NULL, NULL, NULL};
+/*counter clock set through MTIM_Std_ReturnTypeSetTickHz , 0: raw prescaler left as it is on a clock change*/
+static uint32 TIM_uint32TickHz[TIM_COUNT] = {0, 0, 0};
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*prescaler of a tick at the live TIMxCLK , rounded to the nearest divisor , N_OK out of the 16-bit range*/
+static Std_ReturnType MTIM_Std_ReturnTypeApplyTick(TIM_Num_t Copy_uint8Timer)
+{
+    uint32 Local_uint32TickHz = TIM_uint32TickHz[Copy_uint8Timer];
+    uint32 Local_uint32Divisor = (MTIM_uint32GetClockHz() + (Local_uint32TickHz / 2UL)) / Local_uint32TickHz;
+
+    if((Local_uint32Divisor == 0) || (Local_uint32Divisor > 65536UL))
+    {
+        return N_OK;
+    }
+    /*preloaded: the counter keeps its tick until the next update event*/
+    TIM_ADDRESS(Copy_uint8Timer)->PSC = Local_uint32Divisor - 1UL;
+    return OK;
+}
+
+/*clock change: the timers set by tick rate get the prescaler of the new APB1 clock*/
+static void MTIM_VoidClockChanged(uint8 Copy_uint8Event)
+{
+    uint8 Local_uint8Timer;
+
+    if(Copy_uint8Event == RCC_CLOCK_POST_CHANGE)
+    {
+        for(Local_uint8Timer = 0; Local_uint8Timer < TIM_COUNT; Local_uint8Timer++)
+        {
+            if(TIM_uint32TickHz[Local_uint8Timer] != 0)
+            {
+                (void)MTIM_Std_ReturnTypeApplyTick((TIM_Num_t)Local_uint8Timer);
+            }
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidInit(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Prescaler)
+* \Description     : Enable timer clock and set its counter clock prescaler, auto reload register is buffered
+*                    so a period written while counting takes effect from the next update event
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint16 Copy_uint16Prescaler : counter clock = TIMxCLK/(Prescaler+1)
+*                    (a raw prescaler does not follow a run time clock change , see MTIM_Std_ReturnTypeSetTickHz)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidInit(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Prescaler)
+{
+    volatile TIM_MemoryMap_t* Local_pTimer = TIM_ADDRESS(Copy_uint8Timer);
+    /*TIM2,TIM3,TIM4 enable bits are 0,1,2 in APB1ENR*/
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB1,PERIPHERAL_EN_TIM2 + Copy_uint8Timer,RCC_CLIENT_TIM);
+    /*stop counter while configuring*/
+    Local_pTimer->CR1 = 0;
+    Local_pTimer->PSC = Copy_uint16Prescaler;
+    /*buffered ARR + only counter overflow generates update interrupt (UG does not)*/
+    Local_pTimer->CR1 = (1<<TIM_CR1_ARPE) | (1<<TIM_CR1_URS);
+    /*load prescaler from its preload register*/
+    Local_pTimer->EGR = (1<<TIM_EGR_UG);
+    Local_pTimer->SR = 0;
+    TIM_uint32TickHz[Copy_uint8Timer] = 0;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MTIM_uint32GetClockHz(void)
+* \Description     : TIMxCLK of TIM2..4 from the live APB1 clock: PCLK1 , doubled when APB1 is divided
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 frequency in HZ
+*******************************************************************************/
+uint32 MTIM_uint32GetClockHz(void)
+{
+    uint32 Local_uint32Pclk1 = MRCC_u32GetPclk1();
+    /*RM0008 clock tree: x1 when the APB1 prescaler is 1 , x2 otherwise*/
+    return (Local_uint32Pclk1 == MRCC_u32GetHclk()) ? Local_uint32Pclk1 : (2UL * Local_uint32Pclk1);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MTIM_Std_ReturnTypeSetTickHz(TIM_Num_t Copy_uint8Timer , uint32 Copy_uint32TickHz)
+* \Description     : set the counter clock of an initialized timer instead of a raw prescaler. the prescaler is derived
+*                    from MTIM_uint32GetClockHz and derived again after every run time clock change , so the tick keeps
+*                    its length in every clock mode. a new prescaler takes effect at the next update event
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint32 Copy_uint32TickHz : counter clock in HZ
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid timer or tick out of the prescaler range at the current clock
+*******************************************************************************/
+Std_ReturnType MTIM_Std_ReturnTypeSetTickHz(TIM_Num_t Copy_uint8Timer , uint32 Copy_uint32TickHz)
+{
+    if((Copy_uint8Timer >= TIM_COUNT) || (Copy_uint32TickHz == 0))
+    {
+        return N_OK;
+    }
+    TIM_uint32TickHz[Copy_uint8Timer] = Copy_uint32TickHz;
+    if(MTIM_Std_ReturnTypeApplyTick(Copy_uint8Timer) != OK)
+    {
+        TIM_uint32TickHz[Copy_uint8Timer] = 0;
+        return N_OK;
+    }
+    /*once for all timers: RCC refuses a callback registered twice*/
+    (void)MRCC_Std_ReturnTypeRegisterClockCallback(MTIM_VoidClockChanged);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidSetPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period)
+* \Description     : Write the (buffered) auto reload value, takes effect at the next update event
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint16 Copy_uint16Period : number of counter ticks between updates (>=1)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidSetPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period)
+{
+    TIM_ADDRESS(Copy_uint8Timer)->ARR = (uint32)Copy_uint16Period - 1U;
+}
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidLoadPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period)
+* \Description     : Write the auto reload value and force an update event so it applies immediately and counter restarts from 0
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , uint16 Copy_uint16Period : number of counter ticks between updates (>=1)
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidLoadPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period)
+{
+    volatile TIM_MemoryMap_t* Local_pTimer = TIM_ADDRESS(Copy_uint8Timer);
+    Local_pTimer->ARR = (uint32)Copy_uint16Period - 1U;
+    Local_pTimer->EGR = (1<<TIM_EGR_UG);
+}
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidStart(TIM_Num_t Copy_uint8Timer)
+* \Description     : Start timer counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidStart(TIM_Num_t Copy_uint8Timer)
+{
+    SET_BIT(TIM_ADDRESS(Copy_uint8Timer)->CR1,TIM_CR1_CEN);
+}
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidStop(TIM_Num_t Copy_uint8Timer)
+* \Description     : Stop timer counter
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidStop(TIM_Num_t Copy_uint8Timer)
+{
+    CLEAR_BIT(TIM_ADDRESS(Copy_uint8Timer)->CR1,TIM_CR1_CEN);
+}
+
+/******************************************************************************
+* \Syntax          : void MTIM_VoidSetUpdateCallback(TIM_Num_t Copy_uint8Timer , void (*callback)(void))
+* \Description     : Register update (overflow) interrupt callback and enable update interrupt of the timer,
+*                    timer IRQ must be enabled in NVIC by the application
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : TIM_Num_t Copy_uint8Timer : timer name , void (*callback)(void) callback function to be called in interrupt handler
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MTIM_VoidSetUpdateCallback(TIM_Num_t Copy_uint8Timer , void (*callback)(void))
+{
+    TIM_UpdateCallBack[Copy_uint8Timer] = callback;
+    SET_BIT(TIM_ADDRESS(Copy_uint8Timer)->DIER,TIM_DIER_UIE);
+}
+
+/*Timers update handlers*/
+void TIM2_IRQHandler(void)
+{
+    /*clear update flag first (rc_w0 -> write 0 only to UIF)*/
+    TIM_ADDRESS(TIM_2)->SR = ~(1UL<<TIM_SR_UIF);
+    if(TIM_UpdateCallBack[TIM_2] != NULL)
+    {
+        TIM_UpdateCallBack[TIM_2]();
+    }
+}
+
+void TIM3_IRQHandler(void)
+{
+    TIM_ADDRESS(TIM_3)->SR = ~(1UL<<TIM_SR_UIF);
+    if(TIM_UpdateCallBack[TIM_3] != NULL)
+    {
+        TIM_UpdateCallBack[TIM_3]();
+    }
+}
+
+void TIM4_IRQHandler(void)
+{
+    TIM_ADDRESS(TIM_4)->SR = ~(1UL<<TIM_SR_UIF);
+    if(TIM_UpdateCallBack[TIM_4] != NULL)
+    {
+        TIM_UpdateCallBack[TIM_4]();
+    }
+}
@@ -20,28 +20,10 @@
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL MACROS
 ---------------------------------------------------------------------------------------------------------------------*/
-/*frequency value in MHZ*/
-#define FREQ   8
-
-/*OVER8=0*/
-#if FREQ==16
-/*BAUD_RATE and its corresponding USART_BRR value options:
-* 9600 -> 0x683
-* 112500 -> 0x8B  
+/*baud rate in bits per second , USART_BRR is derived from the live APB2 clock (MRCC_u32GetPclk2)
+* e.g. 9600 , 19200 , 57600 , 115200
 */
-#define BAUD_RATE_9600      0x683
-#define BAUD_RATE_112500    0x8B
-#elif FREQ==8
-/*BAUD_RATE and its corresponding USART_BRR value options:
-* 9600 -> 0xD05
-* 112500 -> 0x43  
-*/
-#define BAUD_RATE_9600      0x342
-#define BAUD_RATE_112500    0x43
-
-#endif
-
-#define BAUD_RATE   BAUD_RATE_9600
+#define BAUD_RATE   9600UL
 /* 8 bit or 9 bit*/
 #define 	BIT_WORD_8					1
 /* parity enabled or disabled*/
@@ -49,6 +31,14 @@
 /*even parity or odd*/	
 #define 	EVEN_PARITY					0
 
+/*interrupt driven transfer: bytes buffered in each direction (power of 2)*/
+#define     UART_RX_BUFFER_SIZE         64
+#define     UART_TX_BUFFER_SIZE         64
+/*group priority given to USART1 in NVIC_IRQ_PRIORITIES, TXEIE updates mask only this level and below*/
+#define     UART_IRQ_PRIORITY           4
+/*blocking calls give up after this long (microseconds on the SysTick timebase)*/
+#define     UART_TX_TIMEOUT_US          10000UL
+
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA
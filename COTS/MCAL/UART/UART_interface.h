@@ -62,7 +62,8 @@ void MUSART1_voidDisable(void);
 
 /******************************************************************************
 * \Syntax          : void MUSART1_voidSendData(u8 Copy_u16Data)                                     
-* \Description     : Sending byte of data by loading it to data register and wait until transmission complete                                                                             
+* \Description     : Sending byte of data by loading it to data register and wait until transmission complete
+*                    (each wait gives up after UART_TX_TIMEOUT_US)                                                                             
 * \Sync\Async      : Synchronous                                               
 * \Reentrancy      : Non Reentrant                                             
 * \Parameters (in) : uint8 Copy_u8Data: byte of data to be sent                   
@@ -105,6 +106,17 @@ void MUSART1_voidSendNumbers(sint32 Copy_s32Number);
 *******************************************************************************/
 uint8 MUSART1_u8ReceiveData(void);
 
+/******************************************************************************
+* \Syntax          : Std_ReturnType MUSART1_Std_ReturnTypeReceiveTimeout(uint8* Copy_pu8Data , uint32 Copy_uint32TimeoutUs)
+* \Description     : polling receive of one byte that gives up after Copy_uint32TimeoutUs on the SysTick timebase
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint32 Copy_uint32TimeoutUs
+* \Parameters (out): uint8* Copy_pu8Data: received byte
+* \Return value:   : OK byte received , N_OK timeout
+*******************************************************************************/
+Std_ReturnType MUSART1_Std_ReturnTypeReceiveTimeout(uint8* Copy_pu8Data , uint32 Copy_uint32TimeoutUs);
+
 /******************************************************************************
 * \Syntax          : uint8 MUSART1_u8ReceiveDataBlock(uint8* Copy_u8DataArr)                                 
 * \Description     : Receive block of data
@@ -116,5 +128,52 @@ uint8 MUSART1_u8ReceiveData(void);
 *******************************************************************************/
 uint8 MUSART1_u8ReceiveDataBlock(uint8* Copy_u8DataArr);
 
+/******************************************************************************
+* \Syntax          : void MUSART1_voidEnableInterrupts(void)
+* \Description     : start interrupt driven transfer: RXNE interrupt fills the receive buffer, TXE interrupt
+*                    drains the transmit buffer (USART1 must be enabled in the NVIC by the application)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MUSART1_voidEnableInterrupts(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MUSART1_Std_ReturnTypeWriteByte(uint8 Copy_u8Data)
+* \Description     : queue one byte for the TXE interrupt, lock-free, callable from thread code and from
+*                    ISRs of any priority at the same time (the TXE interrupt pops again after clearing TXEIE,
+*                    a byte pushed by a more urgent ISR in between is not left in the buffer)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_u8Data: byte to be sent
+* \Parameters (out): None
+* \Return value:   : OK queued , N_OK transmit buffer full
+*******************************************************************************/
+Std_ReturnType MUSART1_Std_ReturnTypeWriteByte(uint8 Copy_u8Data);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MUSART1_Std_ReturnTypeReadByte(uint8* Copy_pu8Data)
+* \Description     : take the oldest byte received by the RXNE interrupt without waiting
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): uint8* Copy_pu8Data: received byte
+* \Return value:   : OK byte returned , N_OK nothing received
+*******************************************************************************/
+Std_ReturnType MUSART1_Std_ReturnTypeReadByte(uint8* Copy_pu8Data);
+
+/******************************************************************************
+* \Syntax          : uint32 MUSART1_uint32GetRxOverruns(void)
+* \Description     : number of received bytes dropped because the receive buffer was full
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 dropped bytes
+*******************************************************************************/
+uint32 MUSART1_uint32GetRxOverruns(void);
+
 
 #endif
@@ -14,7 +14,7 @@
 #define _UART_PRIVATE_H
 
 
-#include "../../LIB/Std_types.h"
+#include "../../LIB/Std_Types.h"
 
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL DATA TYPES AND STRUCTURES
@@ -76,6 +76,9 @@ typedef union
 #define     USART_BRR       (*((volatile uint32*)0x40013808))
 #define     USART_CR1       (*((volatile UART_USART_CR1_TAG*)0x4001380C))
 
+/*one frame on the line (start , 9 bits , stop with margin) at BAUD_RATE , rounded up*/
+#define     UART_FRAME_TIME_US      (((12UL * 1000000UL) / BAUD_RATE) + 1UL)
+
 
 
 #endif
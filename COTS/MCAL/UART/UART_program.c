@@ -19,6 +19,66 @@
 #include "../../LIB/Bit_Math.h"
 #include "../AFIO/AFIO_interface.h"
 #include "../GPIO/GPIO_interface.h"
+#include "../NVIC/NVIC_Interface.h"
+#include "../SYSTick/SYSTick_interface.h"
+#include "../../LIB/Ring_Buffer.h"
+
+#if ((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) != 0) || ((UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) != 0)
+#error "UART_RX_BUFFER_SIZE and UART_TX_BUFFER_SIZE must be powers of 2"
+#endif
+
+/*BASEPRI value masking USART1 and every less urgent interrupt*/
+#define UART_CRITICAL_THRESHOLD     NVIC_ENCODE_PRIORITY(NVIC_PRIORITY_GROUPING,UART_IRQ_PRIORITY,0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*receive: ISR -> application (SPSC) , transmit: any context -> ISR (MPSC)*/
+static uint8 usart1_rx_buffer[UART_RX_BUFFER_SIZE];
+static Ring_Buffer_t usart1_rx_ring;
+static volatile uint32 usart1_rx_overruns = 0;
+
+static uint8 usart1_tx_buffer[UART_TX_BUFFER_SIZE];
+static volatile uint32 usart1_tx_sequence[UART_TX_BUFFER_SIZE];
+static Ring_Buffer_t usart1_tx_ring;
+/*TXEIE held off during a clock change*/
+static uint8 usart1_tx_held = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*PCLK2 / baud as 12.4 fixed point (16x oversampling) , rounded*/
+static void MUSART1_VoidSetBaudRate(void)
+{
+    USART_BRR = (MRCC_u32GetPclk2() + (BAUD_RATE / 2UL)) / BAUD_RATE;
+}
+
+/*clock change: the interrupt transfer is held and the bytes in DR and on the line finish at the old rate (at most
+  two frame times) , then BRR follows the new APB2 clock. bytes received during the switch may be lost*/
+static void MUSART1_VoidClockChanged(uint8 Copy_uint8Event)
+{
+    uint64 Local_uint64Start;
+
+    if(Copy_uint8Event == RCC_CLOCK_PRE_CHANGE)
+    {
+        usart1_tx_held = USART_CR1.B.TXEIE;
+        USART_CR1.B.TXEIE = 0;
+        Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+        while((USART_SR.B.TXE == 0) || (USART_SR.B.TC == 0))
+        {
+            if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,2UL * UART_FRAME_TIME_US))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        MUSART1_VoidSetBaudRate();
+        USART_CR1.B.TXEIE = usart1_tx_held;
+    }
+}
+
 /*---------------------------------------------------------------------------------------------------------------------
  *  GLOBAL FUNCTION IMPLEMENTION
 ---------------------------------------------------------------------------------------------------------------------*/ 
@@ -35,16 +95,17 @@
 void MUSART1_voidInit(void)
 {
     /*enable clock of UART1*/
-    MRCC_voidEnableClock(RCC_APB2,PERIPHERAL_EN_USART1);
-    MRCC_voidEnableClock(RCC_APB2,PERIPHERAL_EN_AFIO);
-    MRCC_voidEnableClock(RCC_APB2,PERIPHERAL_EN_IOPA);
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_USART1,RCC_CLIENT_UART1);
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_AFIO,RCC_CLIENT_UART1);
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_IOPA,RCC_CLIENT_UART1);
     /*set AFIO pins*/
     MAFIO_voidRemapPeripheralPins(UART1_REMAP);//Rx pinA10, TX pinA9
     /*setup AFIO pins for CAN Tx,Rx */
     MGPIO_VoidSetPinMode_TYPE(_GPIOA_PORT,pin10,INPUT_FLOATING);//RX
     MGPIO_VoidSetPinMode_TYPE(_GPIOA_PORT,pin9,OUTPUT_SPEED_50MHZ_AFPUSHPULL);//TX
-    /*set baud rate*/
-    USART_BRR = BAUD_RATE;
+    /*set baud rate , again after every run time clock change*/
+    MUSART1_VoidSetBaudRate();
+    (void)MRCC_Std_ReturnTypeRegisterClockCallback(MUSART1_VoidClockChanged);
     /*specify frame bits*/
     #if BIT_WORD_8==1
     USART_CR1.B.M = 0;
@@ -79,7 +140,7 @@ void MUSART1_voidInit(void)
 
 /******************************************************************************
 * \Syntax          : void MUSART1_voidEnable(void)                                     
-* \Description     : Enable UART1                                                                             
+* \Description     : Enable UART1 , takes the USART1 clock back if MUSART1_voidDisable gated it
 * \Sync\Async      : Synchronous                                               
 * \Reentrancy      : Non Reentrant                                             
 * \Parameters (in) : None               
@@ -89,12 +150,14 @@ void MUSART1_voidInit(void)
 void MUSART1_voidEnable(void)
 {
     /*enable uart*/
+    (void)MRCC_Std_ReturnTypeGetClock(RCC_APB2,PERIPHERAL_EN_USART1,RCC_CLIENT_UART1);
     USART_CR1.B.UE =1;
 }
 
 /******************************************************************************
 * \Syntax          : void MUSART1_voidDisable(void)                                      
-* \Description     : Disable  UART timer by clear its ENABLE bit                                                                             
+* \Description     : Disable  UART timer by clear its ENABLE bit then release the USART1 clock (gated when no
+*                    other client holds it , the registers keep their configuration)
 * \Sync\Async      : Synchronous                                               
 * \Reentrancy      : Non Reentrant                                             
 * \Parameters (in) : None                    
@@ -105,12 +168,14 @@ void MUSART1_voidDisable(void)
 {
     /*disable uart*/
     USART_CR1.B.UE =0;
+    (void)MRCC_Std_ReturnTypePutClock(RCC_APB2,PERIPHERAL_EN_USART1,RCC_CLIENT_UART1);
 }
 
 
 /******************************************************************************
 * \Syntax          : void MUSART1_voidSendData(u8 Copy_u16Data)                                     
-* \Description     : Sending byte of data by loading it to data register and wait until transmission complete                                                                             
+* \Description     : Sending byte of data by loading it to data register and wait until transmission complete
+*                    (each wait gives up after UART_TX_TIMEOUT_US)                                                                             
 * \Sync\Async      : Synchronous                                               
 * \Reentrancy      : Non Reentrant                                             
 * \Parameters (in) : uint8 Copy_u8Data: byte of data to be sent                   
@@ -119,11 +184,25 @@ void MUSART1_voidDisable(void)
 *******************************************************************************/
 void MUSART1_voidSendData(uint8 Copy_u8Data)
 {
+    uint64 Local_uint64Start = MSYSTICK_uint64GetTimeUs();
     /*check if data register completes transfering data to the shift register and data register is empty*/
-    while(USART_SR.B.TXE==0);
+    while(USART_SR.B.TXE==0)
+    {
+        if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,UART_TX_TIMEOUT_US))
+        {
+            return;
+        }
+    }
     USART_DR = Copy_u8Data;
     /*wait until data is transfered*/
-    while (USART_SR.B.TC==0);
+    Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+    while (USART_SR.B.TC==0)
+    {
+        if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,UART_TX_TIMEOUT_US))
+        {
+            return;
+        }
+    }
     /*clear transmission complete flag*/
     USART_SR.B.TC=0;
 }
@@ -185,6 +264,30 @@ uint8 MUSART1_u8ReceiveData(void)
     return (uint8)(USART_DR);
 }
 
+/******************************************************************************
+* \Syntax          : Std_ReturnType MUSART1_Std_ReturnTypeReceiveTimeout(uint8* Copy_pu8Data , uint32 Copy_uint32TimeoutUs)
+* \Description     : polling receive of one byte that gives up after Copy_uint32TimeoutUs on the SysTick timebase
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint32 Copy_uint32TimeoutUs
+* \Parameters (out): uint8* Copy_pu8Data: received byte
+* \Return value:   : OK byte received , N_OK timeout
+*******************************************************************************/
+Std_ReturnType MUSART1_Std_ReturnTypeReceiveTimeout(uint8* Copy_pu8Data , uint32 Copy_uint32TimeoutUs)
+{
+    uint64 Local_uint64Start = MSYSTICK_uint64GetTimeUs();
+
+    while(USART_SR.B.RXNE==0)
+    {
+        if(MSYSTICK_uint8TimeoutExpired(Local_uint64Start,Copy_uint32TimeoutUs))
+        {
+            return N_OK;
+        }
+    }
+    *Copy_pu8Data = (uint8)(USART_DR);
+    return OK;
+}
+
 /******************************************************************************
 * \Syntax          : uint8 MUSART1_u8ReceiveDataBlock(uint8* Copy_u8DataArr)                                 
 * \Description     : Receive block of data
@@ -206,3 +309,109 @@ uint8 MUSART1_u8ReceiveDataBlock(uint8* Copy_u8DataArr)
     }while(u8data!='\0');
     Copy_u8DataArr[u8count++]='\0';
 }
+
+/******************************************************************************
+* \Syntax          : void MUSART1_voidEnableInterrupts(void)
+* \Description     : start interrupt driven transfer: RXNE interrupt fills the receive buffer, TXE interrupt
+*                    drains the transmit buffer (USART1 must be enabled in the NVIC by the application)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void MUSART1_voidEnableInterrupts(void)
+{
+    Ring_VoidInit(&usart1_rx_ring,usart1_rx_buffer,sizeof(uint8),UART_RX_BUFFER_SIZE,NULL);
+    Ring_VoidInit(&usart1_tx_ring,usart1_tx_buffer,sizeof(uint8),UART_TX_BUFFER_SIZE,usart1_tx_sequence);
+    USART_CR1.B.RXNEIE = 1;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MUSART1_Std_ReturnTypeWriteByte(uint8 Copy_u8Data)
+* \Description     : queue one byte for the TXE interrupt, lock-free, callable from thread code and from
+*                    ISRs of any priority at the same time (the TXE interrupt pops again after clearing TXEIE,
+*                    a byte pushed by a more urgent ISR in between is not left in the buffer)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_u8Data: byte to be sent
+* \Parameters (out): None
+* \Return value:   : OK queued , N_OK transmit buffer full
+*******************************************************************************/
+Std_ReturnType MUSART1_Std_ReturnTypeWriteByte(uint8 Copy_u8Data)
+{
+    uint32 Local_uint32Saved;
+
+    if(Ring_Std_ReturnTypeMpscPush(&usart1_tx_ring,&Copy_u8Data) != OK)
+    {
+        return N_OK;
+    }
+    /*CR1 is also written by the ISR when the buffer runs dry: mask USART1 (and lower) only,
+      more urgent interrupts keep running during the read-modify-write*/
+    Local_uint32Saved = Critical_uint32EnterBasepri(UART_CRITICAL_THRESHOLD);
+    USART_CR1.B.TXEIE = 1;
+    Critical_VoidExitBasepri(Local_uint32Saved);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType MUSART1_Std_ReturnTypeReadByte(uint8* Copy_pu8Data)
+* \Description     : take the oldest byte received by the RXNE interrupt without waiting
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant (single consumer)
+* \Parameters (in) : None
+* \Parameters (out): uint8* Copy_pu8Data: received byte
+* \Return value:   : OK byte returned , N_OK nothing received
+*******************************************************************************/
+Std_ReturnType MUSART1_Std_ReturnTypeReadByte(uint8* Copy_pu8Data)
+{
+    return Ring_Std_ReturnTypeSpscPop(&usart1_rx_ring,Copy_pu8Data);
+}
+
+/******************************************************************************
+* \Syntax          : uint32 MUSART1_uint32GetRxOverruns(void)
+* \Description     : number of received bytes dropped because the receive buffer was full
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 dropped bytes
+*******************************************************************************/
+uint32 MUSART1_uint32GetRxOverruns(void)
+{
+    return usart1_rx_overruns;
+}
+
+void USART1_IRQHandler(void)
+{
+    uint8 Local_u8Data;
+
+    /*reading SR then DR clears RXNE and ORE*/
+    if(USART_SR.B.RXNE || USART_SR.B.ORE)
+    {
+        Local_u8Data = (uint8)USART_DR;
+        if(Ring_Std_ReturnTypeSpscPush(&usart1_rx_ring,&Local_u8Data) != OK)
+        {
+            usart1_rx_overruns++;
+        }
+    }
+    if(USART_CR1.B.TXEIE && USART_SR.B.TXE)
+    {
+        if(Ring_Std_ReturnTypeMpscPop(&usart1_tx_ring,&Local_u8Data) == OK)
+        {
+            USART_DR = Local_u8Data;
+        }
+        else
+        {
+            /*empty (or a producer is still filling its slot: it sets TXEIE again after publishing).
+              a more urgent producer may push and set TXEIE between the failed pop and this clear , or
+              during its read-modify-write: pop again after the clear and keep TXEIE on for that byte*/
+            USART_CR1.B.TXEIE = 0;
+            if(Ring_Std_ReturnTypeMpscPop(&usart1_tx_ring,&Local_u8Data) == OK)
+            {
+                USART_DR = Local_u8Data;
+                USART_CR1.B.TXEIE = 1;
+            }
+        }
+    }
+}
@@ -0,0 +1,30 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DPC_config.h
+ *       Module:  DPC Module
+ *  Description:  Configuration header file for deferred procedure call service
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _DPC_CONFIG_H
+#define _DPC_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*number of DPC levels (max 4), level number is the index in the lists below*/
+#define DPC_NUM_LEVELS              2
+
+/*EXTI line reserved for every level, must not be used by a GPIO pin.
+  lines 0..4 have their own vector, a line of 5..9 or 10..15 shares the vector (and priority) with the other lines
+  Options: EXTERNAL_INTERRUPT_0 ... EXTERNAL_INTERRUPT_15*/
+#define DPC_LEVEL_LINES             {EXTERNAL_INTERRUPT_3, EXTERNAL_INTERRUPT_4}
+
+/*NVIC preemption priority of every level (lower number = more urgent), keep below the posting ISRs*/
+#define DPC_LEVEL_PRIORITIES        {2, 3}
+
+#endif
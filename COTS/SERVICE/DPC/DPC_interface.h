@@ -0,0 +1,78 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DPC_interface.h
+ *       Module:  DPC Module
+ *  Description:  Interface header file for deferred procedure calls.
+ *                every level owns an unused EXTI line at its own NVIC priority, an ISR posts a work item to the
+ *                lock-free queue of a level and raises the line through SWIER, the item then runs in the
+ *                level's interrupt once no more urgent interrupt is active.
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _DPC_INTERFACE_H
+#define _DPC_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+
+#include "DPC_config.h"
+#include "DPC_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*work item, owned by the caller (static storage) and linked into a level queue while posted*/
+typedef struct DPC_Item
+{
+    struct DPC_Item* volatile Next;
+    void (*Function)(void* Copy_pArg);
+    void* Arg;
+    volatile uint32 Queued;
+}DPC_Item_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SDPC_VoidInit(void)
+* \Description     : reserve the EXTI line of every level, set its NVIC priority and enable it
+*                    (NVIC priority grouping must already be selected)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SDPC_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : void SDPC_VoidInitItem(DPC_Item_t* Copy_pItem , void (*Copy_pFunction)(void* Copy_pArg) , void* Copy_pArg)
+* \Description     : bind a work item to its function and argument (once, before the first post)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : DPC_Item_t* Copy_pItem , Copy_pFunction : deferred work , void* Copy_pArg : its argument
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SDPC_VoidInitItem(DPC_Item_t* Copy_pItem , void (*Copy_pFunction)(void* Copy_pArg) , void* Copy_pArg);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SDPC_Std_ReturnTypePost(uint8 Copy_uint8Level , DPC_Item_t* Copy_pItem)
+* \Description     : queue a work item on a level and raise the level's interrupt, lock-free, callable from any ISR
+*                    or thread code. posting an item already queued and not yet started is ignored (coalesced)
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Level : DPC level , DPC_Item_t* Copy_pItem
+* \Parameters (out): None
+* \Return value:   : OK queued , N_OK item already queued or level out of range
+*******************************************************************************/
+Std_ReturnType SDPC_Std_ReturnTypePost(uint8 Copy_uint8Level , DPC_Item_t* Copy_pItem);
+
+#endif
@@ -0,0 +1,27 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DPC_private.h
+ *       Module:  DPC Module
+ *  Description:  Private header file for deferred procedure call service
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _DPC_PRIVATE_H
+#define _DPC_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*NVIC vector of an EXTI line*/
+#define DPC_LINE_IRQ(LINE)          (((LINE) < 5) ? (NVIC_InterruptType_t)(EXTI0 + (LINE)) : \
+                                     ((LINE) < 10) ? EXTI9_5 : EXTI15_10)
+
+#if (DPC_NUM_LEVELS < 1) || (DPC_NUM_LEVELS > 4)
+#error "DPC_NUM_LEVELS must be 1..4"
+#endif
+
+#endif
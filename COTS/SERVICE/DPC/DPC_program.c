@@ -0,0 +1,178 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  DPC_program.c
+ *       Module:  DPC Module
+ *  Description:  implementaion C file for deferred procedure call service
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../MCAL/External_Interrupt/External_Interrupt_interface.h"
+#include "../../MCAL/NVIC/NVIC_Interface.h"
+#include "../../LIB/Atomic.h"
+#include "../PROFILER/PROFILER_interface.h"
+#include "DPC_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static const EXTERNAL_InterruptNumber_t DPC_LevelLine[DPC_NUM_LEVELS] = DPC_LEVEL_LINES;
+static const uint8 DPC_LevelPriority[DPC_NUM_LEVELS] = DPC_LEVEL_PRIORITIES;
+
+/*LIFO of posted items per level: producers push with compare-and-swap (LDREX/STREX),
+  the level's ISR takes the whole list with one swap, so no item is ever popped alone (no ABA)*/
+static DPC_Item_t* volatile DPC_LevelHead[DPC_NUM_LEVELS];
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+static void SDPC_VoidRunLevel(uint8 Copy_uint8Level)
+{
+    DPC_Item_t* Local_pList = (DPC_Item_t*)Atomic_pExchangePointer((void* volatile*)&DPC_LevelHead[Copy_uint8Level],NULL);
+    DPC_Item_t* Local_pFifo = NULL;
+    DPC_Item_t* Local_pNext;
+
+    /*reverse to run items in post order*/
+    while(Local_pList != NULL)
+    {
+        Local_pNext = Local_pList->Next;
+        Local_pList->Next = Local_pFifo;
+        Local_pFifo = Local_pList;
+        Local_pList = Local_pNext;
+    }
+    while(Local_pFifo != NULL)
+    {
+        Local_pNext = Local_pFifo->Next;
+        /*released before the call so the item may post itself again*/
+        Atomic_VoidStoreRelease(&Local_pFifo->Queued,0);
+        Local_pFifo->Function(Local_pFifo->Arg);
+        Local_pFifo = Local_pNext;
+    }
+    /*items posted meanwhile raised the line again: the ISR is pending and runs them next*/
+}
+
+/*EXTI callbacks carry no line number: one entry per level*/
+static void SDPC_VoidLevel0(void)
+{
+    SDPC_VoidRunLevel(0);
+}
+#if DPC_NUM_LEVELS > 1
+static void SDPC_VoidLevel1(void)
+{
+    SDPC_VoidRunLevel(1);
+}
+#endif
+#if DPC_NUM_LEVELS > 2
+static void SDPC_VoidLevel2(void)
+{
+    SDPC_VoidRunLevel(2);
+}
+#endif
+#if DPC_NUM_LEVELS > 3
+static void SDPC_VoidLevel3(void)
+{
+    SDPC_VoidRunLevel(3);
+}
+#endif
+
+static void (* const DPC_LevelCallback[DPC_NUM_LEVELS])(void) =
+{
+    SDPC_VoidLevel0,
+#if DPC_NUM_LEVELS > 1
+    SDPC_VoidLevel1,
+#endif
+#if DPC_NUM_LEVELS > 2
+    SDPC_VoidLevel2,
+#endif
+#if DPC_NUM_LEVELS > 3
+    SDPC_VoidLevel3,
+#endif
+};
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SDPC_VoidInit(void)
+* \Description     : reserve the EXTI line of every level, set its NVIC priority and enable it
+*                    (NVIC priority grouping must already be selected)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SDPC_VoidInit(void)
+{
+    uint8 Local_uint8Level;
+    EXTERNAL_InterruptNumber_t Local_Line;
+
+    for(Local_uint8Level = 0; Local_uint8Level < DPC_NUM_LEVELS; Local_uint8Level++)
+    {
+        Local_Line = DPC_LevelLine[Local_uint8Level];
+        DPC_LevelHead[Local_uint8Level] = NULL;
+        MEXTERNAL_INTERRUPT_VoidInterruptCallback(Local_Line,DPC_LevelCallback[Local_uint8Level]);
+        /*no edge trigger selected: only SWIER can raise the line*/
+        MEXTERNAL_INTERRUPT_VoidEnableInterrupt(Local_Line);
+        MNVIC_VoidSetPriority(DPC_LINE_IRQ(Local_Line),DPC_LevelPriority[Local_uint8Level],0);
+        MNVIC_VoidEnableInterrupt(DPC_LINE_IRQ(Local_Line));
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void SDPC_VoidInitItem(DPC_Item_t* Copy_pItem , void (*Copy_pFunction)(void* Copy_pArg) , void* Copy_pArg)
+* \Description     : bind a work item to its function and argument (once, before the first post)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : DPC_Item_t* Copy_pItem , Copy_pFunction : deferred work , void* Copy_pArg : its argument
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SDPC_VoidInitItem(DPC_Item_t* Copy_pItem , void (*Copy_pFunction)(void* Copy_pArg) , void* Copy_pArg)
+{
+    Copy_pItem->Next = NULL;
+    Copy_pItem->Function = Copy_pFunction;
+    Copy_pItem->Arg = Copy_pArg;
+    Copy_pItem->Queued = 0;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SDPC_Std_ReturnTypePost(uint8 Copy_uint8Level , DPC_Item_t* Copy_pItem)
+* \Description     : queue a work item on a level and raise the level's interrupt, lock-free, callable from any ISR
+*                    or thread code. posting an item already queued and not yet started is ignored (coalesced)
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Level : DPC level , DPC_Item_t* Copy_pItem
+* \Parameters (out): None
+* \Return value:   : OK queued , N_OK item already queued or level out of range
+*******************************************************************************/
+Std_ReturnType SDPC_Std_ReturnTypePost(uint8 Copy_uint8Level , DPC_Item_t* Copy_pItem)
+{
+    DPC_Item_t* Local_pHead;
+
+    if(Copy_uint8Level >= DPC_NUM_LEVELS)
+    {
+        return N_OK;
+    }
+    /*claim the item: one post wins, the others see it queued*/
+    if(Atomic_uint32Exchange(&Copy_pItem->Queued,1) != 0)
+    {
+        return N_OK;
+    }
+    do
+    {
+        Local_pHead = DPC_LevelHead[Copy_uint8Level];
+        Copy_pItem->Next = Local_pHead;
+    }while(Atomic_uint8CompareAndSwapPointer((void* volatile*)&DPC_LevelHead[Copy_uint8Level],Local_pHead,Copy_pItem) == 0);
+    /*start of the level's entry latency when its vector is profiled (nothing in release builds)*/
+    SPROFILER_VoidMarkPending(PROFILER_IRQ_VECTOR(DPC_LINE_IRQ(DPC_LevelLine[Copy_uint8Level])));
+    MEXTERNAL_INTERRUPT_VoidTriggerSoftwareInterrupt(DPC_LevelLine[Copy_uint8Level]);
+    return OK;
+}
@@ -0,0 +1,38 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  FAULT_config.h
+ *       Module:  FAULT Module
+ *  Description:  Configuration header file for fault capture
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _FAULT_CONFIG_H
+#define _FAULT_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*fault records kept in .noinit , the oldest one is overwritten when the history is full*/
+#define FAULT_HISTORY_SIZE          4
+
+/*words of the faulting stack saved above the exception frame*/
+#define FAULT_STACK_DUMP_WORDS      16
+
+/*1: reset the MCU once the record is written , 0: stop in the handler for the debugger*/
+#define FAULT_RESET_ON_FAULT        1
+
+/*1: MemManage , BusFault and UsageFault get their own handler instead of escalating to HardFault
+  (the record is the same , CFSR tells which one it was)*/
+#define FAULT_ENABLE_SYSTEM_HANDLERS    1
+
+/*1: an integer division by zero faults (UsageFault DIVBYZERO) instead of returning 0 , off by default: code
+  that relies on the architectural x/0 = 0 would start resetting , a build may set its own*/
+#ifndef FAULT_TRAP_DIV_BY_ZERO
+#define FAULT_TRAP_DIV_BY_ZERO      0
+#endif
+
+#endif
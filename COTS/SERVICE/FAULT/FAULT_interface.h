@@ -0,0 +1,125 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  FAULT_interface.h
+ *       Module:  FAULT Module
+ *  Description:  Interface header file for fault capture.
+ *                HardFault , MemManage , BusFault and UsageFault save the stacked registers , CFSR/HFSR/MMFAR/BFAR ,
+ *                the interrupted vector and a short stack dump into a circular history in .noinit (kept across
+ *                resets , not across power loss) then reset the MCU. on the next boot SFAULT_VoidReport prints the
+ *                records not reported yet over any byte output. the history lives in SFAULT_Log so a debugger can
+ *                read it directly (gdb: p SFAULT_Log)
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _FAULT_INTERFACE_H
+#define _FAULT_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+
+#include "FAULT_config.h"
+#include "FAULT_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint32 Magic;
+    uint32 Sequence;                            /*fault number since the history was created , 1 = first*/
+    uint32 Frame[FAULT_FRAME_WORDS];            /*r0 r1 r2 r3 r12 lr pc xpsr , 0 when the frame was unreadable*/
+    uint32 ExcReturn;                           /*lr of the handler: bit 2 set = the task (PSP) stack faulted*/
+    uint32 StackPointer;                        /*address of the stacked frame*/
+    uint32 Cfsr;
+    uint32 Hfsr;
+    uint32 Mmfar;
+    uint32 Bfar;
+    uint16 FaultVector;                         /*3 HardFault , 4 MemManage , 5 BusFault , 6 UsageFault*/
+    uint16 ActiveVector;                        /*exception interrupted by the fault , 0 thread mode , 16+ IRQ*/
+    uint32 Stack[FAULT_STACK_DUMP_WORDS];       /*words above the frame*/
+    uint32 Check;
+}FAULT_Record_t;
+
+typedef struct
+{
+    uint32 Magic;
+    uint32 Count;                               /*faults recorded , the newest is in Records[(Count - 1) % size]*/
+    uint32 Reported;                            /*value of Count at the last report*/
+    uint32 Check;
+    FAULT_Record_t Records[FAULT_HISTORY_SIZE];
+}FAULT_Log_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+extern FAULT_Log_t SFAULT_Log;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SFAULT_VoidInit(void)
+* \Description     : keep the history when it survived the reset (start an empty one after power on) and enable
+*                    the configurable fault handlers. call early in main
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SFAULT_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : uint8 SFAULT_uint8Report(void (*Copy_pPutChar)(uint8 Copy_u8Data))
+* \Description     : print one line per record written since the last report (oldest first , hex words):
+*                    FAULT seq vector active pc lr xpsr r0 r1 r2 r3 r12 cfsr hfsr mmfar bfar sp exc_return
+*                    followed by a STACK line , e.g. SFAULT_uint8Report(MUSART1_voidSendData)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pPutChar : byte output
+* \Parameters (out): None
+* \Return value:   : uint8 records printed
+*******************************************************************************/
+uint8 SFAULT_uint8Report(void (*Copy_pPutChar)(uint8 Copy_u8Data));
+
+/******************************************************************************
+* \Syntax          : uint32 SFAULT_uint32GetCount(void)
+* \Description     : faults recorded since the history was created
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 count
+*******************************************************************************/
+uint32 SFAULT_uint32GetCount(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SFAULT_Std_ReturnTypeGetRecord(uint8 Copy_uint8Age , FAULT_Record_t* Copy_pRecord)
+* \Description     : copy a record of the history , age 0 is the newest
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Age : 0 .. FAULT_HISTORY_SIZE - 1
+* \Parameters (out): FAULT_Record_t* Copy_pRecord
+* \Return value:   : OK , N_OK no such record or record damaged
+*******************************************************************************/
+Std_ReturnType SFAULT_Std_ReturnTypeGetRecord(uint8 Copy_uint8Age , FAULT_Record_t* Copy_pRecord);
+
+/******************************************************************************
+* \Syntax          : void SFAULT_VoidClear(void)
+* \Description     : empty the history
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SFAULT_VoidClear(void);
+
+#endif
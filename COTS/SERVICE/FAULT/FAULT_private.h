@@ -0,0 +1,49 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  FAULT_private.h
+ *       Module:  FAULT Module
+ *  Description:  Private header file for fault capture
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _FAULT_PRIVATE_H
+#define _FAULT_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*system control block*/
+#define FAULT_SCB_ICSR              (*(volatile uint32*)0xE000ED04)
+#define FAULT_SCB_AIRCR             (*(volatile uint32*)0xE000ED0C)
+#define FAULT_SCB_CCR               (*(volatile uint32*)0xE000ED14)
+#define FAULT_SCB_SHCSR             (*(volatile uint32*)0xE000ED24)
+#define FAULT_SCB_CFSR              (*(volatile uint32*)0xE000ED28)
+#define FAULT_SCB_HFSR              (*(volatile uint32*)0xE000ED2C)
+#define FAULT_SCB_MMFAR             (*(volatile uint32*)0xE000ED34)
+#define FAULT_SCB_BFAR              (*(volatile uint32*)0xE000ED38)
+
+#define FAULT_AIRCR_VECTKEY         0x05FA0000UL
+#define FAULT_AIRCR_PRIGROUP_MASK   0x00000700UL
+#define FAULT_AIRCR_SYSRESETREQ     (1UL << 2)
+#define FAULT_CCR_DIV_0_TRP         (1UL << 4)
+#define FAULT_SHCSR_MEMFAULTENA     (1UL << 16)
+#define FAULT_SHCSR_BUSFAULTENA     (1UL << 17)
+#define FAULT_SHCSR_USGFAULTENA     (1UL << 18)
+#define FAULT_ICSR_VECTACTIVE_MASK  0x1FFUL
+#define FAULT_XPSR_EXCEPTION_MASK   0x1FFUL
+
+/*r0 r1 r2 r3 r12 lr pc xpsr stacked by the core on exception entry*/
+#define FAULT_FRAME_WORDS           8
+
+#define FAULT_LOG_MAGIC             0xFA017C0DUL
+#define FAULT_RECORD_MAGIC          0xFA01DEADUL
+
+#if (FAULT_HISTORY_SIZE < 1) || (FAULT_HISTORY_SIZE > 16)
+#error "FAULT_HISTORY_SIZE must be 1..16"
+#endif
+
+#endif
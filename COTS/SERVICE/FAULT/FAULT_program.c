@@ -0,0 +1,319 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  FAULT_program.c
+ *       Module:  FAULT Module
+ *  Description:  implementaion C file for fault capture
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "FAULT_interface.h"
+#include "../../LIB/Atomic.h"
+#include "../../LIB/Compiler.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*RAM that may hold a stack: from the start of .data to the top of the main stack*/
+extern uint32 _S_data;
+extern uint32 _stak_top;
+
+/*not zeroed by Rest_Handler , validated by SFAULT_VoidInit*/
+NOINIT FAULT_Log_t SFAULT_Log;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+void SFAULT_VoidCapture(uint32* Copy_pFrame , uint32 Copy_uint32ExcReturn);
+
+/*rotate and xor of every word before Check*/
+static uint32 SFAULT_uint32Checksum(const FAULT_Record_t* Copy_pRecord)
+{
+    const uint32* Local_pWord = (const uint32*)Copy_pRecord;
+    uint32 Local_uint32Words = (uint32)((const uint32*)&Copy_pRecord->Check - Local_pWord);
+    uint32 Local_uint32Sum = 0;
+
+    while(Local_uint32Words-- != 0)
+    {
+        Local_uint32Sum = ((Local_uint32Sum << 1) | (Local_uint32Sum >> 31)) ^ *Local_pWord++;
+    }
+    return ~Local_uint32Sum;
+}
+
+static uint32 SFAULT_uint32LogCheck(void)
+{
+    return ~(SFAULT_Log.Magic ^ SFAULT_Log.Count ^ (SFAULT_Log.Reported << 1));
+}
+
+/*header written after a power on (random RAM) or a damaged history*/
+static uint8 SFAULT_uint8LogValid(void)
+{
+    return (SFAULT_Log.Magic == FAULT_LOG_MAGIC) && (SFAULT_Log.Check == SFAULT_uint32LogCheck()) &&
+           (SFAULT_Log.Reported <= SFAULT_Log.Count);
+}
+
+static uint8 SFAULT_uint8RecordValid(const FAULT_Record_t* Copy_pRecord)
+{
+    return (Copy_pRecord->Magic == FAULT_RECORD_MAGIC) && (Copy_pRecord->Check == SFAULT_uint32Checksum(Copy_pRecord));
+}
+
+/*a frame or stack word is read only inside the RAM that can hold a stack , a wild SP must not fault again*/
+static uint8 SFAULT_uint8StackReadable(const uint32* Copy_pAddress)
+{
+    return ((uint32)Copy_pAddress >= (uint32)&_S_data) && ((uint32)Copy_pAddress < (uint32)&_stak_top) &&
+           (((uint32)Copy_pAddress & 3UL) == 0);
+}
+
+static void SFAULT_VoidPutHex(void (*Copy_pPutChar)(uint8 Copy_u8Data) , uint32 Copy_uint32Value)
+{
+    uint8 Local_uint8Itr;
+    uint8 Local_uint8Nibble;
+
+    for(Local_uint8Itr = 0; Local_uint8Itr < 8; Local_uint8Itr++)
+    {
+        Local_uint8Nibble = (uint8)((Copy_uint32Value >> (28 - (4 * Local_uint8Itr))) & 0xFUL);
+        Copy_pPutChar((uint8)((Local_uint8Nibble < 10) ? ('0' + Local_uint8Nibble) : ('a' + Local_uint8Nibble - 10)));
+    }
+    Copy_pPutChar(' ');
+}
+
+static void SFAULT_VoidPutText(void (*Copy_pPutChar)(uint8 Copy_u8Data) , const char* Copy_pText)
+{
+    while(*Copy_pText != '\0')
+    {
+        Copy_pPutChar((uint8)*Copy_pText++);
+    }
+}
+
+/*common part of the fault handlers (handler mode , interrupts of lower priority are blocked):
+  Copy_pFrame is the stack that was active at the fault , Copy_uint32ExcReturn the lr of the handler*/
+void SFAULT_VoidCapture(uint32* Copy_pFrame , uint32 Copy_uint32ExcReturn)
+{
+    FAULT_Record_t* Local_pRecord;
+    const uint32* Local_pWord;
+    uint8 Local_uint8Itr;
+
+    if(SFAULT_uint8LogValid() == 0)
+    {
+        /*fault before SFAULT_VoidInit ran after a power on*/
+        SFAULT_VoidClear();
+    }
+    Local_pRecord = &SFAULT_Log.Records[SFAULT_Log.Count % FAULT_HISTORY_SIZE];
+
+    Local_pRecord->Magic = FAULT_RECORD_MAGIC;
+    Local_pRecord->Sequence = SFAULT_Log.Count + 1;
+    Local_pRecord->ExcReturn = Copy_uint32ExcReturn;
+    Local_pRecord->StackPointer = (uint32)Copy_pFrame;
+    Local_pRecord->Cfsr = FAULT_SCB_CFSR;
+    Local_pRecord->Hfsr = FAULT_SCB_HFSR;
+    Local_pRecord->Mmfar = FAULT_SCB_MMFAR;
+    Local_pRecord->Bfar = FAULT_SCB_BFAR;
+    Local_pRecord->FaultVector = (uint16)(FAULT_SCB_ICSR & FAULT_ICSR_VECTACTIVE_MASK);
+    for(Local_uint8Itr = 0; Local_uint8Itr < FAULT_FRAME_WORDS; Local_uint8Itr++)
+    {
+        Local_pWord = Copy_pFrame + Local_uint8Itr;
+        Local_pRecord->Frame[Local_uint8Itr] = (SFAULT_uint8StackReadable(Local_pWord) == 1) ? *Local_pWord : 0;
+    }
+    Local_pRecord->ActiveVector = (uint16)(Local_pRecord->Frame[7] & FAULT_XPSR_EXCEPTION_MASK);
+    for(Local_uint8Itr = 0; Local_uint8Itr < FAULT_STACK_DUMP_WORDS; Local_uint8Itr++)
+    {
+        Local_pWord = Copy_pFrame + FAULT_FRAME_WORDS + Local_uint8Itr;
+        Local_pRecord->Stack[Local_uint8Itr] = (SFAULT_uint8StackReadable(Local_pWord) == 1) ? *Local_pWord : 0;
+    }
+    Local_pRecord->Check = SFAULT_uint32Checksum(Local_pRecord);
+
+    /*the record is complete before it is counted*/
+    SFAULT_Log.Count++;
+    SFAULT_Log.Check = SFAULT_uint32LogCheck();
+    ATOMIC_FENCE();
+
+#if FAULT_RESET_ON_FAULT == 1
+    FAULT_SCB_AIRCR = FAULT_AIRCR_VECTKEY | (FAULT_SCB_AIRCR & FAULT_AIRCR_PRIGROUP_MASK) | FAULT_AIRCR_SYSRESETREQ;
+    ATOMIC_FENCE();
+#endif
+    /*reset pending , or stop here for the debugger*/
+    while(1);
+}
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+/*pick the stack the core pushed the frame on (EXC_RETURN bit 2) and hand it to the capture with the EXC_RETURN.
+  naked: no prologue may move the stack before it is read*/
+#define FAULT_HANDLER(NAME)                                     \
+__attribute__((naked)) void NAME(void)                          \
+{                                                               \
+    __asm__ volatile (                                          \
+        "tst   lr, #4               \n\t"                       \
+        "ite   eq                   \n\t"                       \
+        "mrseq r0, msp              \n\t"                       \
+        "mrsne r0, psp              \n\t"                       \
+        "mov   r1, lr               \n\t"                       \
+        "b     SFAULT_VoidCapture   \n\t"                       \
+    );                                                          \
+}
+
+/*vector table names of startup.c , these replace the weak Default_Handler aliases*/
+FAULT_HANDLER(H_fault_Handler)
+FAULT_HANDLER(MM_Fault_Handler)
+FAULT_HANDLER(Bus_Fault)
+FAULT_HANDLER(Usage_Fault_Handler)
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SFAULT_VoidInit(void)
+* \Description     : keep the history when it survived the reset (start an empty one after power on) and enable
+*                    the configurable fault handlers. call early in main
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SFAULT_VoidInit(void)
+{
+    if(SFAULT_uint8LogValid() == 0)
+    {
+        SFAULT_VoidClear();
+    }
+#if FAULT_ENABLE_SYSTEM_HANDLERS == 1
+    FAULT_SCB_SHCSR |= (FAULT_SHCSR_MEMFAULTENA | FAULT_SHCSR_BUSFAULTENA | FAULT_SHCSR_USGFAULTENA);
+#endif
+#if FAULT_TRAP_DIV_BY_ZERO == 1
+    FAULT_SCB_CCR |= FAULT_CCR_DIV_0_TRP;
+#endif
+}
+
+/******************************************************************************
+* \Syntax          : uint8 SFAULT_uint8Report(void (*Copy_pPutChar)(uint8 Copy_u8Data))
+* \Description     : print one line per record written since the last report (oldest first , hex words):
+*                    FAULT seq vector active pc lr xpsr r0 r1 r2 r3 r12 cfsr hfsr mmfar bfar sp exc_return
+*                    followed by a STACK line , e.g. SFAULT_uint8Report(MUSART1_voidSendData)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pPutChar : byte output
+* \Parameters (out): None
+* \Return value:   : uint8 records printed
+*******************************************************************************/
+uint8 SFAULT_uint8Report(void (*Copy_pPutChar)(uint8 Copy_u8Data))
+{
+    static const uint8 Local_uint8FrameOrder[FAULT_FRAME_WORDS] = {6 , 5 , 7 , 0 , 1 , 2 , 3 , 4};
+    const FAULT_Record_t* Local_pRecord;
+    uint32 Local_uint32Sequence;
+    uint8 Local_uint8Printed = 0;
+    uint8 Local_uint8Itr;
+
+    if(SFAULT_uint8LogValid() == 0)
+    {
+        return 0;
+    }
+    /*older unreported records were overwritten*/
+    Local_uint32Sequence = SFAULT_Log.Reported;
+    if((SFAULT_Log.Count - Local_uint32Sequence) > FAULT_HISTORY_SIZE)
+    {
+        Local_uint32Sequence = SFAULT_Log.Count - FAULT_HISTORY_SIZE;
+    }
+    for(; Local_uint32Sequence < SFAULT_Log.Count; Local_uint32Sequence++)
+    {
+        Local_pRecord = &SFAULT_Log.Records[Local_uint32Sequence % FAULT_HISTORY_SIZE];
+        if(SFAULT_uint8RecordValid(Local_pRecord) == 0)
+        {
+            continue;
+        }
+        SFAULT_VoidPutText(Copy_pPutChar,"FAULT ");
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Sequence);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->FaultVector);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->ActiveVector);
+        for(Local_uint8Itr = 0; Local_uint8Itr < FAULT_FRAME_WORDS; Local_uint8Itr++)
+        {
+            SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Frame[Local_uint8FrameOrder[Local_uint8Itr]]);
+        }
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Cfsr);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Hfsr);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Mmfar);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Bfar);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->StackPointer);
+        SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->ExcReturn);
+        SFAULT_VoidPutText(Copy_pPutChar,"\r\nSTACK ");
+        for(Local_uint8Itr = 0; Local_uint8Itr < FAULT_STACK_DUMP_WORDS; Local_uint8Itr++)
+        {
+            SFAULT_VoidPutHex(Copy_pPutChar,Local_pRecord->Stack[Local_uint8Itr]);
+        }
+        SFAULT_VoidPutText(Copy_pPutChar,"\r\n");
+        Local_uint8Printed++;
+    }
+    SFAULT_Log.Reported = SFAULT_Log.Count;
+    SFAULT_Log.Check = SFAULT_uint32LogCheck();
+    return Local_uint8Printed;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 SFAULT_uint32GetCount(void)
+* \Description     : faults recorded since the history was created
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 count
+*******************************************************************************/
+uint32 SFAULT_uint32GetCount(void)
+{
+    return (SFAULT_uint8LogValid() == 1) ? SFAULT_Log.Count : 0;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SFAULT_Std_ReturnTypeGetRecord(uint8 Copy_uint8Age , FAULT_Record_t* Copy_pRecord)
+* \Description     : copy a record of the history , age 0 is the newest
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Age : 0 .. FAULT_HISTORY_SIZE - 1
+* \Parameters (out): FAULT_Record_t* Copy_pRecord
+* \Return value:   : OK , N_OK no such record or record damaged
+*******************************************************************************/
+Std_ReturnType SFAULT_Std_ReturnTypeGetRecord(uint8 Copy_uint8Age , FAULT_Record_t* Copy_pRecord)
+{
+    const FAULT_Record_t* Local_pRecord;
+
+    if((SFAULT_uint8LogValid() == 0) || (Copy_uint8Age >= FAULT_HISTORY_SIZE) || (Copy_uint8Age >= SFAULT_Log.Count))
+    {
+        return N_OK;
+    }
+    Local_pRecord = &SFAULT_Log.Records[(SFAULT_Log.Count - 1 - Copy_uint8Age) % FAULT_HISTORY_SIZE];
+    if(SFAULT_uint8RecordValid(Local_pRecord) == 0)
+    {
+        return N_OK;
+    }
+    *Copy_pRecord = *Local_pRecord;
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SFAULT_VoidClear(void)
+* \Description     : empty the history
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SFAULT_VoidClear(void)
+{
+    uint8 Local_uint8Itr;
+
+    for(Local_uint8Itr = 0; Local_uint8Itr < FAULT_HISTORY_SIZE; Local_uint8Itr++)
+    {
+        SFAULT_Log.Records[Local_uint8Itr].Magic = 0;
+    }
+    SFAULT_Log.Magic = FAULT_LOG_MAGIC;
+    SFAULT_Log.Count = 0;
+    SFAULT_Log.Reported = 0;
+    SFAULT_Log.Check = SFAULT_uint32LogCheck();
+}
@@ -0,0 +1,41 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  KERNEL_config.h
+ *       Module:  KERNEL Module
+ *  Description:  Configuration header file for preemptive kernel
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _KERNEL_CONFIG_H
+#define _KERNEL_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*task control blocks , the idle task takes one of them*/
+#define KERNEL_MAX_TASKS            8
+
+/*ticks a task runs before the next ready task of the same priority gets the core*/
+#define KERNEL_TIME_SLICE_TICKS     10
+
+/*most urgent NVIC group priority allowed to call the kernel (1..15), kernel lists are updated with this priority
+  and below masked through BASEPRI. the SW_TIMER DPC level must not be more urgent than this*/
+#define KERNEL_LOCK_PRIORITY        1
+
+/*stack of the idle task in words*/
+#define KERNEL_IDLE_STACK_WORDS     64
+
+/*1: paint every task stack on creation and register it with the STACK service (high-water mark , guard zone
+  check) , SSTACK_VoidInit must run before SKERNEL_VoidInit. 0: stacks are left as they are*/
+#define KERNEL_STACK_MONITOR        1
+/*1: PendSV stamps the DWT cycle counter on entry and records the cycles of every switch (min , max , last) ,
+  read with SKERNEL_Std_ReturnTypeGetSwitchCycles. MDWT_VoidEnableCycleCounter must run first. 0: no hook*/
+#ifndef KERNEL_MEASURE_SWITCH
+#define KERNEL_MEASURE_SWITCH       0
+#endif
+
+#endif
@@ -0,0 +1,180 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  KERNEL_interface.h
+ *       Module:  KERNEL Module
+ *  Description:  Interface header file for preemptive kernel.
+ *                fixed priority preemptive tasks on the process stack (PSP): the most urgent ready task always
+ *                runs , tasks of one priority share the core in KERNEL_TIME_SLICE_TICKS slices. the context switch
+ *                is the PendSV handler (r4-r11 saved on the task stack , O(1) CLZ selection) so it is deferred
+ *                until no other handler runs. task stacks are static arrays (KERNEL_STACK) collected by the
+ *                linker script in .kernel_stacks. delays and slicing come from the SW_TIMER wheel on SysTick.
+ *                switch cost: KERNEL_MEASURE_SWITCH (DWT stamps inside PendSV) or SPROFILER attached to
+ *                PROFILER_SYSTEM_VECTOR(NVIC_EXC_PENDSV).
+ *                the selection logic builds on Linux too as a host model (no stacks are switched there).
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _KERNEL_INTERFACE_H
+#define _KERNEL_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../LIB/Atomic.h"
+
+#include "KERNEL_config.h"
+#include "KERNEL_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*static task stack placed in .kernel_stacks (not zeroed at boot) , 8 byte aligned as the AAPCS requires*/
+#define KERNEL_STACK(NAME,WORDS)    static uint32 NAME[WORDS] __attribute__((section(".kernel_stacks"), aligned(8)))
+
+#define KERNEL_INVALID_TASK         0xFF
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*index of a task control block*/
+typedef uint8 KERNEL_TaskHandle_t;
+
+/*PendSV cycles from its first instruction to the restored context (KERNEL_MEASURE_SWITCH) , the exception entry
+  and return stacking are not included*/
+typedef struct
+{
+    uint32 Count;                       /*switches measured*/
+    uint32 MinCycles;
+    uint32 MaxCycles;
+    uint32 LastCycles;
+}KERNEL_SwitchStats_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidInit(void)
+* \Description     : free every task control block and create the idle task. call after SSWTIMER_VoidInit
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SKERNEL_Std_ReturnTypeCreateTask(KERNEL_TaskHandle_t* Copy_pHandle , void (*Copy_pEntry)(void* Copy_pArg) ,
+*                                                                    void* Copy_pArg , uint32* Copy_pStack , uint32 Copy_uint32StackWords ,
+*                                                                    uint8 Copy_uint8Priority)
+* \Description     : build the initial frame of a task on its stack and make it ready. a task that returns from its
+*                    entry waits forever. may be called before or after SKERNEL_VoidStart
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_pEntry , Copy_pArg : task function and its argument , Copy_pStack , Copy_uint32StackWords :
+*                    KERNEL_STACK array and its size , uint8 Copy_uint8Priority : 0..30 , lower number = more urgent
+* \Parameters (out): KERNEL_TaskHandle_t* Copy_pHandle
+* \Return value:   : OK , N_OK no free block or timer , stack too small or invalid priority
+*******************************************************************************/
+Std_ReturnType SKERNEL_Std_ReturnTypeCreateTask(KERNEL_TaskHandle_t* Copy_pHandle , void (*Copy_pEntry)(void* Copy_pArg) ,
+                                                void* Copy_pArg , uint32* Copy_pStack , uint32 Copy_uint32StackWords ,
+                                                uint8 Copy_uint8Priority);
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidStart(void)
+* \Description     : start the time slice timer and switch to the most urgent task on the process stack , never
+*                    returns. the main stack stays in use by the handlers
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidStart(void);
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidYield(void)
+* \Description     : hand the core to the next ready task of the same priority
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidYield(void);
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidDelay(uint32 Copy_uint32Ticks)
+* \Description     : block the calling task for Copy_uint32Ticks ticks (0: yield) , task context only
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Ticks
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidDelay(uint32 Copy_uint32Ticks);
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidWait(void)
+* \Description     : block the calling task until SKERNEL_Std_ReturnTypeNotify , returns at once when a notification
+*                    arrived since the last wait , task context only
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidWait(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SKERNEL_Std_ReturnTypeNotify(KERNEL_TaskHandle_t Copy_Task)
+* \Description     : wake a waiting task (or mark the notification for its next wait) , preempts the caller's task
+*                    when the woken one is more urgent. callable from ISRs up to KERNEL_LOCK_PRIORITY
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : KERNEL_TaskHandle_t Copy_Task
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid task
+*******************************************************************************/
+Std_ReturnType SKERNEL_Std_ReturnTypeNotify(KERNEL_TaskHandle_t Copy_Task);
+
+/******************************************************************************
+* \Syntax          : KERNEL_TaskHandle_t SKERNEL_GetCurrentTask(void)
+* \Description     : task that owns the core (the one PendSV switched to last)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : KERNEL_TaskHandle_t , KERNEL_INVALID_TASK before SKERNEL_VoidStart
+*******************************************************************************/
+KERNEL_TaskHandle_t SKERNEL_GetCurrentTask(void);
+
+/******************************************************************************
+* \Syntax          : uint32 SKERNEL_uint32GetStackHighWater(KERNEL_TaskHandle_t Copy_Task)
+* \Description     : deepest use of a task stack since its creation (KERNEL_STACK_MONITOR) , in bytes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : KERNEL_TaskHandle_t Copy_Task
+* \Parameters (out): None
+* \Return value:   : uint32 bytes , 0 invalid task or stack not monitored
+*******************************************************************************/
+uint32 SKERNEL_uint32GetStackHighWater(KERNEL_TaskHandle_t Copy_Task);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SKERNEL_Std_ReturnTypeGetSwitchCycles(KERNEL_SwitchStats_t* Copy_pStats)
+* \Description     : DWT cycles spent in PendSV per context switch since SKERNEL_VoidInit (KERNEL_MEASURE_SWITCH)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): KERNEL_SwitchStats_t* Copy_pStats
+* \Return value:   : OK , N_OK no switch measured yet or the hook is off
+*******************************************************************************/
+Std_ReturnType SKERNEL_Std_ReturnTypeGetSwitchCycles(KERNEL_SwitchStats_t* Copy_pStats);
+
+#endif
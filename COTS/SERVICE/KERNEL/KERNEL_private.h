@@ -0,0 +1,73 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  KERNEL_private.h
+ *       Module:  KERNEL Module
+ *  Description:  Private header file for preemptive kernel
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _KERNEL_PRIVATE_H
+#define _KERNEL_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define KERNEL_PRIORITIES           32
+#define KERNEL_IDLE_PRIORITY        (KERNEL_PRIORITIES - 1)
+
+/*priority p is bit 31-p of the ready mask: CLZ of the mask is the most urgent ready priority*/
+#define KERNEL_READY_BIT(PRIO)      (0x80000000UL >> (PRIO))
+
+#define KERNEL_STATE_FREE           0
+#define KERNEL_STATE_READY          1
+#define KERNEL_STATE_DELAYED        2
+#define KERNEL_STATE_WAITING        3
+
+/*initial exception frame: r0-r3 , r12 , lr , pc , xPSR (hardware) under r4-r11 (PendSV)*/
+#define KERNEL_HW_FRAME_WORDS       8
+#define KERNEL_SW_FRAME_WORDS       8
+#define KERNEL_INITIAL_XPSR         0x01000000UL        /*Thumb bit*/
+#define KERNEL_MIN_STACK_WORDS      (KERNEL_HW_FRAME_WORDS + KERNEL_SW_FRAME_WORDS + 16)
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+#define KERNEL_SCB_ICSR             (*(volatile uint32*)0xE000ED04)
+#define KERNEL_ICSR_PENDSVSET       (1UL << 28)
+/*the switch runs once no other handler is active (PendSV has the lowest priority)*/
+#define KERNEL_PEND_SWITCH()        (KERNEL_SCB_ICSR = KERNEL_ICSR_PENDSVSET)
+#define KERNEL_WFI()                __asm__ volatile ("dsb\n\twfi\n\tisb" ::: "memory")
+/*DWT->CYCCNT for the PendSV assembly (KERNEL_MEASURE_SWITCH)*/
+#define KERNEL_DWT_CYCCNT           "0xE0001004"
+#else
+/*host model: the switch decision is taken at once , no stacks are touched*/
+#define KERNEL_PEND_SWITCH()        SKERNEL_VoidSwitchContext()
+#define KERNEL_WFI()
+#endif
+
+#if (KERNEL_LOCK_PRIORITY < 1) || (KERNEL_LOCK_PRIORITY > 15)
+#error "KERNEL_LOCK_PRIORITY must be 1..15 (BASEPRI 0 masks nothing)"
+#endif
+
+#if (KERNEL_MAX_TASKS < 2) || (KERNEL_TIME_SLICE_TICKS < 1)
+#error "KERNEL_MAX_TASKS must leave room for the idle task and KERNEL_TIME_SLICE_TICKS must be >= 1"
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct KERNEL_Task
+{
+    uint32* StackPointer;               /*first member: PendSV saves and restores through it*/
+    struct KERNEL_Task* Next;           /*ring of the ready tasks of one priority*/
+    struct KERNEL_Task* Prev;
+    uint16 DelayTimer;                  /*SW_TIMER handle*/
+    uint8 Priority;
+    uint8 State;
+    uint8 Notified;
+    uint8 StackRegion;                  /*STACK service region , STACK_INVALID_REGION when not monitored*/
+}KERNEL_Task_t;
+
+#endif
@@ -0,0 +1,592 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  KERNEL_program.c
+ *       Module:  KERNEL Module
+ *  Description:  implementaion C file for preemptive kernel
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../MCAL/NVIC/NVIC_Interface.h"
+#include "../../MCAL/DWT/DWT_interface.h"
+#include "../SW_TIMER/SW_TIMER_interface.h"
+#include "../STACK/STACK_interface.h"
+#include "KERNEL_interface.h"
+
+/*BASEPRI value masking KERNEL_LOCK_PRIORITY and every less urgent interrupt*/
+#define KERNEL_LOCK_THRESHOLD       NVIC_ENCODE_PRIORITY(NVIC_PRIORITY_GROUPING,KERNEL_LOCK_PRIORITY,0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static KERNEL_Task_t Kernel_Tasks[KERNEL_MAX_TASKS];
+
+/*task owning the core , written by the switch only (referenced from the PendSV assembly)*/
+static KERNEL_Task_t* volatile Kernel_pCurrent __attribute__((used)) = NULL;
+
+/*ring of ready tasks per priority (head runs next) and one ready bit per priority*/
+static KERNEL_Task_t* Kernel_ReadyHead[KERNEL_PRIORITIES];
+static volatile uint32 Kernel_ReadyMask = 0;
+
+static uint8 Kernel_uint8Started = 0;
+static SW_TIMER_Handle_t Kernel_SliceTimer = SW_TIMER_INVALID_HANDLE;
+
+KERNEL_STACK(Kernel_IdleStack,KERNEL_IDLE_STACK_WORDS);
+
+#if KERNEL_MEASURE_SWITCH == 1
+/*written by PendSV only , which the kernel lock masks*/
+static KERNEL_SwitchStats_t Kernel_SwitchStats;
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+void SKERNEL_VoidSwitchContext(void);
+void SKERNEL_VoidRecordSwitch(uint32 Copy_uint32Start);
+
+/*append to the ring of its priority: runs after the tasks already ready there (lock held)*/
+static void SKERNEL_VoidReadyInsert(KERNEL_Task_t* Copy_pTask)
+{
+    KERNEL_Task_t* Local_pHead = Kernel_ReadyHead[Copy_pTask->Priority];
+
+    if(Local_pHead == NULL)
+    {
+        Copy_pTask->Next = Copy_pTask;
+        Copy_pTask->Prev = Copy_pTask;
+        Kernel_ReadyHead[Copy_pTask->Priority] = Copy_pTask;
+        Kernel_ReadyMask |= KERNEL_READY_BIT(Copy_pTask->Priority);
+    }
+    else
+    {
+        Copy_pTask->Next = Local_pHead;
+        Copy_pTask->Prev = Local_pHead->Prev;
+        Local_pHead->Prev->Next = Copy_pTask;
+        Local_pHead->Prev = Copy_pTask;
+    }
+}
+
+/*(lock held)*/
+static void SKERNEL_VoidReadyRemove(KERNEL_Task_t* Copy_pTask)
+{
+    if(Copy_pTask->Next == Copy_pTask)
+    {
+        Kernel_ReadyHead[Copy_pTask->Priority] = NULL;
+        Kernel_ReadyMask &= ~KERNEL_READY_BIT(Copy_pTask->Priority);
+    }
+    else
+    {
+        Copy_pTask->Prev->Next = Copy_pTask->Next;
+        Copy_pTask->Next->Prev = Copy_pTask->Prev;
+        if(Kernel_ReadyHead[Copy_pTask->Priority] == Copy_pTask)
+        {
+            Kernel_ReadyHead[Copy_pTask->Priority] = Copy_pTask->Next;
+        }
+    }
+}
+
+/*a task became ready: switch when it is more urgent than the running one (lock held)*/
+static void SKERNEL_VoidPreemptCheck(const KERNEL_Task_t* Copy_pTask)
+{
+    if((Kernel_uint8Started == 1) && (Copy_pTask->Priority < Kernel_pCurrent->Priority))
+    {
+        KERNEL_PEND_SWITCH();
+    }
+}
+
+/*entry return address of every task*/
+static void SKERNEL_VoidTaskExit(void)
+{
+    for(;;)
+    {
+        SKERNEL_VoidWait();
+    }
+}
+
+static void SKERNEL_VoidIdleTask(void* Copy_pArg)
+{
+    (void)Copy_pArg;
+    for(;;)
+    {
+        KERNEL_WFI();
+    }
+}
+
+/*SW_TIMER callback (DPC level): end of a delay*/
+static void SKERNEL_VoidDelayExpired(void* Copy_pArg)
+{
+    KERNEL_Task_t* Local_pTask = (KERNEL_Task_t*)Copy_pArg;
+    uint32 Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+
+    if(Local_pTask->State == KERNEL_STATE_DELAYED)
+    {
+        Local_pTask->State = KERNEL_STATE_READY;
+        SKERNEL_VoidReadyInsert(Local_pTask);
+        SKERNEL_VoidPreemptCheck(Local_pTask);
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+}
+
+/*SW_TIMER callback (DPC level): end of a time slice , the next task of the running priority gets the core*/
+static void SKERNEL_VoidSliceExpired(void* Copy_pArg)
+{
+    KERNEL_Task_t* Local_pCurrent;
+    uint32 Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+
+    (void)Copy_pArg;
+    Local_pCurrent = Kernel_pCurrent;
+    if((Local_pCurrent->State == KERNEL_STATE_READY) && (Local_pCurrent->Next != Local_pCurrent) &&
+       (Kernel_ReadyHead[Local_pCurrent->Priority] == Local_pCurrent))
+    {
+        Kernel_ReadyHead[Local_pCurrent->Priority] = Local_pCurrent->Next;
+        KERNEL_PEND_SWITCH();
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+}
+
+/*take the running task out of the ready rings and switch away (lock held)*/
+static void SKERNEL_VoidBlockCurrent(uint8 Copy_uint8State)
+{
+    Kernel_pCurrent->State = Copy_uint8State;
+    SKERNEL_VoidReadyRemove(Kernel_pCurrent);
+    KERNEL_PEND_SWITCH();
+}
+
+/*task block , frame and ready insertion of SKERNEL_Std_ReturnTypeCreateTask , the idle task comes through here with
+  its reserved priority*/
+static Std_ReturnType SKERNEL_Std_ReturnTypeBuildTask(KERNEL_TaskHandle_t* Copy_pHandle , void (*Copy_pEntry)(void* Copy_pArg) ,
+                                                      void* Copy_pArg , uint32* Copy_pStack , uint32 Copy_uint32StackWords ,
+                                                      uint8 Copy_uint8Priority)
+{
+    KERNEL_Task_t* Local_pTask = NULL;
+    uint32* Local_pStackPointer;
+    uint32 Local_uint32Saved;
+    uint8 Local_uint8Itr;
+
+    *Copy_pHandle = KERNEL_INVALID_TASK;
+    /*reserve a block , it is not in any ring until its frame is complete*/
+    Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+    for(Local_uint8Itr = 0; Local_uint8Itr < KERNEL_MAX_TASKS; Local_uint8Itr++)
+    {
+        if(Kernel_Tasks[Local_uint8Itr].State == KERNEL_STATE_FREE)
+        {
+            Local_pTask = &Kernel_Tasks[Local_uint8Itr];
+            Local_pTask->State = KERNEL_STATE_WAITING;
+            break;
+        }
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+    if(Local_pTask == NULL)
+    {
+        return N_OK;
+    }
+    if((Local_pTask->DelayTimer == SW_TIMER_INVALID_HANDLE) &&
+       (SSWTIMER_Std_ReturnTypeCreate(&Local_pTask->DelayTimer,SKERNEL_VoidDelayExpired,Local_pTask) == N_OK))
+    {
+        Local_pTask->State = KERNEL_STATE_FREE;
+        return N_OK;
+    }
+
+#if KERNEL_STACK_MONITOR == 1
+    /*whole stack painted before the frame is built , the frame itself counts as used*/
+    SSTACK_VoidPaint(Copy_pStack,Copy_uint32StackWords);
+    if(Local_pTask->StackRegion == STACK_INVALID_REGION)
+    {
+        (void)SSTACK_Std_ReturnTypeRegister(Copy_pStack,Copy_uint32StackWords,&Local_pTask->StackRegion);
+    }
+#endif
+
+    /*frame as an exception entry would leave it: r0 = argument , pc = entry (Thumb bit in xPSR) ,
+      lr = exit trap , r4-r11 below for the first PendSV restore*/
+    Local_pStackPointer = (uint32*)((uint32)(Copy_pStack + Copy_uint32StackWords) & ~7UL);
+    *(--Local_pStackPointer) = KERNEL_INITIAL_XPSR;
+    *(--Local_pStackPointer) = (uint32)Copy_pEntry & ~1UL;
+    *(--Local_pStackPointer) = (uint32)SKERNEL_VoidTaskExit;
+    for(Local_uint8Itr = 0; Local_uint8Itr < 4; Local_uint8Itr++)
+    {
+        /*r12 , r3 , r2 , r1*/
+        *(--Local_pStackPointer) = 0;
+    }
+    *(--Local_pStackPointer) = (uint32)Copy_pArg;
+    for(Local_uint8Itr = 0; Local_uint8Itr < KERNEL_SW_FRAME_WORDS; Local_uint8Itr++)
+    {
+        *(--Local_pStackPointer) = 0;
+    }
+    Local_pTask->StackPointer = Local_pStackPointer;
+    Local_pTask->Priority = Copy_uint8Priority;
+    Local_pTask->Notified = 0;
+
+    Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+    Local_pTask->State = KERNEL_STATE_READY;
+    SKERNEL_VoidReadyInsert(Local_pTask);
+    SKERNEL_VoidPreemptCheck(Local_pTask);
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    *Copy_pHandle = (KERNEL_TaskHandle_t)(Local_pTask - Kernel_Tasks);
+    return OK;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/*called by PendSV between saving and restoring a context: most urgent ready task , O(1)*/
+void SKERNEL_VoidSwitchContext(void)
+{
+    uint32 Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+
+    /*the idle task is always ready: the mask is never 0*/
+    Kernel_pCurrent = Kernel_ReadyHead[__builtin_clz((unsigned int)Kernel_ReadyMask)];
+    Critical_VoidExitBasepri(Local_uint32Saved);
+}
+
+#if KERNEL_MEASURE_SWITCH == 1
+/*called by PendSV once the new context is restored , Copy_uint32Start is the DWT stamp of its first instruction*/
+void SKERNEL_VoidRecordSwitch(uint32 Copy_uint32Start)
+{
+    uint32 Local_uint32Cycles = MDWT_CYCLE_COUNT() - Copy_uint32Start;
+
+    Kernel_SwitchStats.LastCycles = Local_uint32Cycles;
+    if((Kernel_SwitchStats.Count == 0) || (Local_uint32Cycles < Kernel_SwitchStats.MinCycles))
+    {
+        Kernel_SwitchStats.MinCycles = Local_uint32Cycles;
+    }
+    if(Local_uint32Cycles > Kernel_SwitchStats.MaxCycles)
+    {
+        Kernel_SwitchStats.MaxCycles = Local_uint32Cycles;
+    }
+    Kernel_SwitchStats.Count++;
+}
+#endif
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+/*context switch: r4-r11 of the old task go under its hardware frame on the process stack , the new task's are
+  popped the same way and the exception return unstacks the rest. KERNEL_MEASURE_SWITCH keeps the DWT entry stamp
+  in r1 (r0 pads the push to 8 bytes) and records the switch once the new context is in place*/
+__attribute__((naked)) void PendSV_Handler(void)
+{
+    __asm__ volatile
+    (
+#if KERNEL_MEASURE_SWITCH == 1
+        "ldr    r1, =" KERNEL_DWT_CYCCNT "      \n\t"
+        "ldr    r1, [r1]                    \n\t"
+#endif
+        "mrs    r0, psp                     \n\t"
+        "stmdb  r0!, {r4-r11}               \n\t"
+        "ldr    r3, =Kernel_pCurrent        \n\t"
+        "ldr    r2, [r3]                    \n\t"
+        "str    r0, [r2]                    \n\t"
+#if KERNEL_MEASURE_SWITCH == 1
+        "push   {r0, r1, r3, lr}            \n\t"
+        "bl     SKERNEL_VoidSwitchContext   \n\t"
+        "pop    {r0, r1, r3, lr}            \n\t"
+#else
+        "push   {r3, lr}                    \n\t"
+        "bl     SKERNEL_VoidSwitchContext   \n\t"
+        "pop    {r3, lr}                    \n\t"
+#endif
+        "ldr    r2, [r3]                    \n\t"
+        "ldr    r0, [r2]                    \n\t"
+        "ldmia  r0!, {r4-r11}               \n\t"
+        "msr    psp, r0                     \n\t"
+#if KERNEL_MEASURE_SWITCH == 1
+        "push   {r1, lr}                    \n\t"
+        "mov    r0, r1                      \n\t"
+        "bl     SKERNEL_VoidRecordSwitch    \n\t"
+        "pop    {r1, lr}                    \n\t"
+#endif
+        "bx     lr                          \n\t"
+    );
+}
+#endif
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidInit(void)
+* \Description     : free every task control block and create the idle task. call after SSWTIMER_VoidInit
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidInit(void)
+{
+    uint8 Local_uint8Itr;
+    KERNEL_TaskHandle_t Local_Idle;
+
+    for(Local_uint8Itr = 0; Local_uint8Itr < KERNEL_MAX_TASKS; Local_uint8Itr++)
+    {
+        Kernel_Tasks[Local_uint8Itr].State = KERNEL_STATE_FREE;
+        Kernel_Tasks[Local_uint8Itr].DelayTimer = SW_TIMER_INVALID_HANDLE;
+        Kernel_Tasks[Local_uint8Itr].StackRegion = STACK_INVALID_REGION;
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < KERNEL_PRIORITIES; Local_uint8Itr++)
+    {
+        Kernel_ReadyHead[Local_uint8Itr] = NULL;
+    }
+    Kernel_ReadyMask = 0;
+    Kernel_pCurrent = NULL;
+    Kernel_uint8Started = 0;
+#if KERNEL_MEASURE_SWITCH == 1
+    Kernel_SwitchStats.Count = 0;
+    Kernel_SwitchStats.MinCycles = 0;
+    Kernel_SwitchStats.MaxCycles = 0;
+    Kernel_SwitchStats.LastCycles = 0;
+#endif
+    /*priority reserved for it, so it is the only task ever run with nothing else ready*/
+    (void)SKERNEL_Std_ReturnTypeBuildTask(&Local_Idle,SKERNEL_VoidIdleTask,NULL,Kernel_IdleStack,KERNEL_IDLE_STACK_WORDS,
+                                          KERNEL_IDLE_PRIORITY);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SKERNEL_Std_ReturnTypeCreateTask(KERNEL_TaskHandle_t* Copy_pHandle , void (*Copy_pEntry)(void* Copy_pArg) ,
+*                                                                    void* Copy_pArg , uint32* Copy_pStack , uint32 Copy_uint32StackWords ,
+*                                                                    uint8 Copy_uint8Priority)
+* \Description     : build the initial frame of a task on its stack and make it ready. a task that returns from its
+*                    entry waits forever. may be called before or after SKERNEL_VoidStart
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_pEntry , Copy_pArg : task function and its argument , Copy_pStack , Copy_uint32StackWords :
+*                    KERNEL_STACK array and its size , uint8 Copy_uint8Priority : 0..30 , lower number = more urgent
+* \Parameters (out): KERNEL_TaskHandle_t* Copy_pHandle
+* \Return value:   : OK , N_OK no free block or timer , stack too small or invalid priority
+*******************************************************************************/
+Std_ReturnType SKERNEL_Std_ReturnTypeCreateTask(KERNEL_TaskHandle_t* Copy_pHandle , void (*Copy_pEntry)(void* Copy_pArg) ,
+                                                void* Copy_pArg , uint32* Copy_pStack , uint32 Copy_uint32StackWords ,
+                                                uint8 Copy_uint8Priority)
+{
+    /*KERNEL_IDLE_PRIORITY is reserved for the idle task of the init*/
+    if((Copy_pEntry == NULL) || (Copy_uint32StackWords < KERNEL_MIN_STACK_WORDS) || (Copy_uint8Priority >= KERNEL_IDLE_PRIORITY))
+    {
+        *Copy_pHandle = KERNEL_INVALID_TASK;
+        return N_OK;
+    }
+    return SKERNEL_Std_ReturnTypeBuildTask(Copy_pHandle,Copy_pEntry,Copy_pArg,Copy_pStack,Copy_uint32StackWords,Copy_uint8Priority);
+}
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidStart(void)
+* \Description     : start the time slice timer and switch to the most urgent task on the process stack , never
+*                    returns. the main stack stays in use by the handlers
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidStart(void)
+{
+    uint32 Local_uint32Saved;
+
+    /*least urgent: the switch never delays an interrupt and always runs after the one that asked for it*/
+    MNVIC_VoidSetSystemPriority(NVIC_EXC_PENDSV,15,15);
+
+    Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+    Kernel_pCurrent = Kernel_ReadyHead[__builtin_clz((unsigned int)Kernel_ReadyMask)];
+    Kernel_uint8Started = 1;
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    if(SSWTIMER_Std_ReturnTypeCreate(&Kernel_SliceTimer,SKERNEL_VoidSliceExpired,NULL) == OK)
+    {
+        (void)SSWTIMER_Std_ReturnTypeStart(Kernel_SliceTimer,KERNEL_TIME_SLICE_TICKS,KERNEL_TIME_SLICE_TICKS);
+    }
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+    /*run the first task straight from its initial frame: PSP above the frame , thread mode on PSP*/
+    __asm__ volatile
+    (
+        "mov    r3, %0                      \n\t"
+        "ldr    r0, [r3, #32]               \n\t"
+        "ldr    r1, [r3, #56]               \n\t"
+        "ldr    r2, [r3, #52]               \n\t"
+        "adds   r3, r3, #64                 \n\t"
+        "msr    psp, r3                     \n\t"
+        "movs   r3, #2                      \n\t"
+        "msr    control, r3                 \n\t"
+        "isb                                \n\t"
+        "mov    lr, r2                      \n\t"
+        "orr    r1, r1, #1                  \n\t"
+        "bx     r1                          \n\t"
+        :
+        : "r" (Kernel_pCurrent->StackPointer)
+        : "r0", "r1", "r2", "r3", "lr", "memory"
+    );
+#endif
+}
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidYield(void)
+* \Description     : hand the core to the next ready task of the same priority
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidYield(void)
+{
+    uint32 Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+
+    if(Kernel_ReadyHead[Kernel_pCurrent->Priority] == Kernel_pCurrent)
+    {
+        Kernel_ReadyHead[Kernel_pCurrent->Priority] = Kernel_pCurrent->Next;
+    }
+    KERNEL_PEND_SWITCH();
+    Critical_VoidExitBasepri(Local_uint32Saved);
+}
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidDelay(uint32 Copy_uint32Ticks)
+* \Description     : block the calling task for Copy_uint32Ticks ticks (0: yield) , task context only
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32 Copy_uint32Ticks
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidDelay(uint32 Copy_uint32Ticks)
+{
+    uint32 Local_uint32Saved;
+
+    if(Copy_uint32Ticks == 0)
+    {
+        SKERNEL_VoidYield();
+        return;
+    }
+    /*the timer callback runs at the DPC level , masked here: it cannot see the task before it is blocked*/
+    Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+    (void)SSWTIMER_Std_ReturnTypeStart(Kernel_pCurrent->DelayTimer,Copy_uint32Ticks,0);
+    SKERNEL_VoidBlockCurrent(KERNEL_STATE_DELAYED);
+    Critical_VoidExitBasepri(Local_uint32Saved);
+}
+
+/******************************************************************************
+* \Syntax          : void SKERNEL_VoidWait(void)
+* \Description     : block the calling task until SKERNEL_Std_ReturnTypeNotify , returns at once when a notification
+*                    arrived since the last wait , task context only
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SKERNEL_VoidWait(void)
+{
+    uint32 Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+
+    if(Kernel_pCurrent->Notified != 0)
+    {
+        Kernel_pCurrent->Notified = 0;
+    }
+    else
+    {
+        SKERNEL_VoidBlockCurrent(KERNEL_STATE_WAITING);
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SKERNEL_Std_ReturnTypeNotify(KERNEL_TaskHandle_t Copy_Task)
+* \Description     : wake a waiting task (or mark the notification for its next wait) , preempts the caller's task
+*                    when the woken one is more urgent. callable from ISRs up to KERNEL_LOCK_PRIORITY
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : KERNEL_TaskHandle_t Copy_Task
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid task
+*******************************************************************************/
+Std_ReturnType SKERNEL_Std_ReturnTypeNotify(KERNEL_TaskHandle_t Copy_Task)
+{
+    KERNEL_Task_t* Local_pTask;
+    uint32 Local_uint32Saved;
+    Std_ReturnType Local_Std_ReturnTypeState = N_OK;
+
+    if(Copy_Task >= KERNEL_MAX_TASKS)
+    {
+        return N_OK;
+    }
+    Local_pTask = &Kernel_Tasks[Copy_Task];
+    Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+    if(Local_pTask->State == KERNEL_STATE_WAITING)
+    {
+        Local_pTask->State = KERNEL_STATE_READY;
+        SKERNEL_VoidReadyInsert(Local_pTask);
+        SKERNEL_VoidPreemptCheck(Local_pTask);
+        Local_Std_ReturnTypeState = OK;
+    }
+    else if(Local_pTask->State != KERNEL_STATE_FREE)
+    {
+        Local_pTask->Notified = 1;
+        Local_Std_ReturnTypeState = OK;
+    }
+    else
+    {
+        /*free block: nothing to notify*/
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : KERNEL_TaskHandle_t SKERNEL_GetCurrentTask(void)
+* \Description     : task that owns the core (the one PendSV switched to last)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : KERNEL_TaskHandle_t , KERNEL_INVALID_TASK before SKERNEL_VoidStart
+*******************************************************************************/
+KERNEL_TaskHandle_t SKERNEL_GetCurrentTask(void)
+{
+    KERNEL_Task_t* Local_pCurrent = Kernel_pCurrent;
+
+    return (Local_pCurrent == NULL) ? KERNEL_INVALID_TASK : (KERNEL_TaskHandle_t)(Local_pCurrent - Kernel_Tasks);
+}
+
+/******************************************************************************
+* \Syntax          : uint32 SKERNEL_uint32GetStackHighWater(KERNEL_TaskHandle_t Copy_Task)
+* \Description     : deepest use of a task stack since its creation (KERNEL_STACK_MONITOR) , in bytes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : KERNEL_TaskHandle_t Copy_Task
+* \Parameters (out): None
+* \Return value:   : uint32 bytes , 0 invalid task or stack not monitored
+*******************************************************************************/
+uint32 SKERNEL_uint32GetStackHighWater(KERNEL_TaskHandle_t Copy_Task)
+{
+    if((Copy_Task >= KERNEL_MAX_TASKS) || (Kernel_Tasks[Copy_Task].StackRegion == STACK_INVALID_REGION))
+    {
+        return 0;
+    }
+    return SSTACK_uint32GetHighWater(Kernel_Tasks[Copy_Task].StackRegion);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SKERNEL_Std_ReturnTypeGetSwitchCycles(KERNEL_SwitchStats_t* Copy_pStats)
+* \Description     : DWT cycles spent in PendSV per context switch since SKERNEL_VoidInit (KERNEL_MEASURE_SWITCH)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): KERNEL_SwitchStats_t* Copy_pStats
+* \Return value:   : OK , N_OK no switch measured yet or the hook is off
+*******************************************************************************/
+Std_ReturnType SKERNEL_Std_ReturnTypeGetSwitchCycles(KERNEL_SwitchStats_t* Copy_pStats)
+{
+#if KERNEL_MEASURE_SWITCH == 1
+    /*PendSV is less urgent than the lock: the copy is never torn by a switch*/
+    uint32 Local_uint32Saved = Critical_uint32EnterBasepri(KERNEL_LOCK_THRESHOLD);
+
+    *Copy_pStats = Kernel_SwitchStats;
+    Critical_VoidExitBasepri(Local_uint32Saved);
+    return (Copy_pStats->Count == 0) ? N_OK : OK;
+#else
+    (void)Copy_pStats;
+    return N_OK;
+#endif
+}
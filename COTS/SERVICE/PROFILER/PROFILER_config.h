@@ -0,0 +1,31 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  PROFILER_config.h
+ *       Module:  PROFILER Module
+ *  Description:  Configuration header file for ISR profiler
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _PROFILER_CONFIG_H
+#define _PROFILER_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*1: profile the attached handlers , 0: release build, every profiler call compiles to nothing and
+  no code or data of the module is linked*/
+#define PROFILER_ENABLE             1
+
+/*number of handlers that can be profiled at the same time (max 32)*/
+#define PROFILER_MAX_HANDLERS       8
+
+/*software raised interrupts per measurement (SPROFILER_uint32MeasureEntry) , the minimum is reported*/
+#define PROFILER_MEASURE_RUNS       16
+/*polls waiting for a raised interrupt to run before the measurement gives up (IRQ disabled or masked)*/
+#define PROFILER_MEASURE_TIMEOUT    100000UL
+
+#endif
@@ -0,0 +1,178 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  PROFILER_interface.h
+ *       Module:  PROFILER Module
+ *  Description:  Interface header file for ISR profiler.
+ *                an attached vector is redirected (SRAM vector table) to a wrapper that times the original
+ *                handler with the DWT cycle counter: invocations , min/max/average cycles spent in the handler
+ *                itself (time of preempting profiled handlers is excluded) and entry latency from the moment the
+ *                interrupt was marked pending. records live in SPROFILER_Records so a debugger can read them
+ *                directly (gdb: p SPROFILER_Records) or SPROFILER_VoidDump prints them over any byte output.
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _PROFILER_INTERFACE_H
+#define _PROFILER_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+
+#include "PROFILER_config.h"
+#include "PROFILER_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*vector (exception) number of a peripheral IRQ (NVIC_InterruptType_t) and of a system exception (NVIC_SystemException_t)*/
+#define PROFILER_IRQ_VECTOR(IRQ)        (16 + (uint8)(IRQ))
+#define PROFILER_SYSTEM_VECTOR(EXC)     ((uint8)(EXC))
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint8           Vector;             /*0: free record*/
+    volatile uint32 Sequence;           /*odd while the wrapper updates the record*/
+    uint32          Count;
+    uint32          MinCycles;
+    uint32          MaxCycles;
+    uint64          TotalCycles;
+    uint32          LatencyCount;       /*invocations that had a pending mark*/
+    uint32          MinLatency;
+    uint32          MaxLatency;
+    uint64          TotalLatency;
+}PROFILER_Record_t;
+
+#if PROFILER_ENABLE == 1
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+extern PROFILER_Record_t SPROFILER_Records[PROFILER_MAX_HANDLERS];
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidInit(void)
+* \Description     : start the DWT cycle counter, call before the first attach
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SPROFILER_Std_ReturnTypeAttach(uint8 Copy_uint8Vector)
+* \Description     : wrap the handler currently installed for a vector. attach after the driver installed its own
+*                    handler , a later MNVIC_VoidAttachHandler on the vector removes the wrapper
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : PROFILER_IRQ_VECTOR(irq) or PROFILER_SYSTEM_VECTOR(exception)
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid vector , already attached or no free record
+*******************************************************************************/
+Std_ReturnType SPROFILER_Std_ReturnTypeAttach(uint8 Copy_uint8Vector);
+
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidMarkPending(uint8 Copy_uint8Vector)
+* \Description     : record "now" as the moment the vector became pending, call right before raising the interrupt
+*                    in software (SWIER , STIR , PendSV) or from a capture of the hardware event time.
+*                    the next entry of the handler measures its latency against this mark
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidMarkPending(uint8 Copy_uint8Vector);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SPROFILER_Std_ReturnTypeGetRecord(uint8 Copy_uint8Vector , PROFILER_Record_t* Copy_pRecord)
+* \Description     : consistent copy of a record, retried while the wrapper updates it (no interrupt masking)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector
+* \Parameters (out): PROFILER_Record_t* Copy_pRecord
+* \Return value:   : OK , N_OK vector not profiled
+*******************************************************************************/
+Std_ReturnType SPROFILER_Std_ReturnTypeGetRecord(uint8 Copy_uint8Vector , PROFILER_Record_t* Copy_pRecord);
+
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidDump(void (*Copy_pPutChar)(uint8 Copy_u8Data))
+* \Description     : print one line per record: vector count min max avg (cycles) lat_n lat_min lat_max lat_avg,
+*                    e.g. SPROFILER_VoidDump(MUSART1_voidSendData)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pPutChar : byte output
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidDump(void (*Copy_pPutChar)(uint8 Copy_u8Data));
+
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidProbe(void)
+* \Description     : latency probe: stores the cycle count it is entered at. install it as the handler under test ,
+*                    either straight in the vector table (MNVIC_VoidAttachHandler) or as a driver callback
+*                    (e.g. MEXTERNAL_INTERRUPT_VoidInterruptCallback) , then call SPROFILER_uint32MeasureEntry
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidProbe(void);
+
+/******************************************************************************
+* \Syntax          : uint32 SPROFILER_uint32MeasureEntry(uint8 Copy_uint8Vector)
+* \Description     : entry latency of a peripheral vector: sets it pending in the NVIC PROFILER_MEASURE_RUNS times and
+*                    returns the fewest cycles from the set pending call to SPROFILER_VoidProbe. the call and the probe
+*                    store are included and are the same for every way the probe is installed , so the difference of
+*                    two measurements is the exact cost of the dispatch in between.
+*                    the IRQ must be enabled with a priority above the caller's
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : PROFILER_IRQ_VECTOR(irq)
+* \Parameters (out): None
+* \Return value:   : uint32 cycles , 0 if the probe did not run (system vector , IRQ disabled or masked)
+*******************************************************************************/
+uint32 SPROFILER_uint32MeasureEntry(uint8 Copy_uint8Vector);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SPROFILER_Std_ReturnTypeMeasureHandler(uint8 Copy_uint8Vector , void (*Copy_pRaise)(void) , PROFILER_Record_t* Copy_pRecord)
+* \Description     : cycle count of a real handler: attaches the vector if it is not profiled yet , raises it
+*                    PROFILER_MEASURE_RUNS times (marked pending first , so the latency fields are filled too) and
+*                    copies the record. Copy_pRaise makes the peripheral request the interrupt (e.g. SWIER write , CAN
+*                    loopback frame) so the handler finds its flags set , NULL sets the vector pending in the NVIC.
+*                    run it once per build (make RAMFUNC=1 / RAMFUNC=0) to compare SRAM and flash placement
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : PROFILER_IRQ_VECTOR(irq) or PROFILER_SYSTEM_VECTOR(exception)
+*                    void (*Copy_pRaise)(void) : raises the interrupt once , NULL only for peripheral vectors
+* \Parameters (out): PROFILER_Record_t* Copy_pRecord
+* \Return value:   : OK , N_OK no record , no raise function for a system vector or the handler did not run
+*******************************************************************************/
+Std_ReturnType SPROFILER_Std_ReturnTypeMeasureHandler(uint8 Copy_uint8Vector , void (*Copy_pRaise)(void) , PROFILER_Record_t* Copy_pRecord);
+
+#else
+/*release build: calls vanish*/
+#define SPROFILER_VoidInit()
+#define SPROFILER_Std_ReturnTypeAttach(VECTOR)              (N_OK)
+#define SPROFILER_VoidMarkPending(VECTOR)
+#define SPROFILER_Std_ReturnTypeGetRecord(VECTOR,RECORD)    (N_OK)
+#define SPROFILER_VoidDump(PUTCHAR)
+#define SPROFILER_VoidProbe                                 ((void (*)(void))NULL)
+#define SPROFILER_uint32MeasureEntry(VECTOR)                (0UL)
+#define SPROFILER_Std_ReturnTypeMeasureHandler(VECTOR,RAISE,RECORD) (N_OK)
+#endif
+
+#endif
@@ -0,0 +1,30 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  PROFILER_private.h
+ *       Module:  PROFILER Module
+ *  Description:  Private header file for ISR profiler
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _PROFILER_PRIVATE_H
+#define _PROFILER_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*vector not profiled*/
+#define PROFILER_NO_SLOT            0xFF
+
+/*IPSR holds the number of the active exception*/
+#define PROFILER_ACTIVE_VECTOR(VAR) __asm__ volatile ("mrs %0, ipsr" : "=r" (VAR))
+#define PROFILER_IPSR_MASK          0x1FFUL
+
+#if (PROFILER_MAX_HANDLERS < 1) || (PROFILER_MAX_HANDLERS > 32)
+#error "PROFILER_MAX_HANDLERS must be 1..32"
+#endif
+
+#endif
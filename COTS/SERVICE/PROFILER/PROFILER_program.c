@@ -0,0 +1,447 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  PROFILER_program.c
+ *       Module:  PROFILER Module
+ *  Description:  implementaion C file for ISR profiler
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "PROFILER_interface.h"
+
+#if PROFILER_ENABLE == 1
+#include "../../LIB/Atomic.h"
+#include "../../MCAL/NVIC/NVIC_Interface.h"
+#include "../../MCAL/DWT/DWT_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+PROFILER_Record_t SPROFILER_Records[PROFILER_MAX_HANDLERS];
+
+/*vector -> record index , PROFILER_NO_SLOT when not profiled*/
+static uint8 profiler_slot[NVIC_VECTOR_COUNT] =
+{
+    [0 ... (NVIC_VECTOR_COUNT - 1)] = PROFILER_NO_SLOT
+};
+/*handler replaced by the wrapper*/
+static void (*profiler_handler[PROFILER_MAX_HANDLERS])(void);
+
+/*cycle stamp of the last pending mark of every record, valid while its bit is set in the mask*/
+static volatile uint32 profiler_pending_stamp[PROFILER_MAX_HANDLERS];
+static volatile uint32 profiler_pending_mask = 0;
+
+/*cycles spent in profiled handlers that preempted the running one (handlers nest strictly, so a single
+  accumulator saved/restored by every wrapper is enough)*/
+static volatile uint32 profiler_nested_cycles = 0;
+
+/*cycle count at the last entry of SPROFILER_VoidProbe and its entry count*/
+static volatile uint32 profiler_probe_stamp = 0;
+static volatile uint32 profiler_probe_count = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*common entry of every profiled vector, the active vector number selects the record*/
+static void SPROFILER_VoidWrapper(void)
+{
+    uint32 Local_uint32Entry = MDWT_CYCLE_COUNT();
+    uint32 Local_uint32Outer = profiler_nested_cycles;
+    uint32 Local_uint32Vector;
+    uint32 Local_uint32Cycles;
+    uint32 Local_uint32Latency = 0;
+    uint32 Local_uint32HasLatency;
+    uint8 Local_uint8Slot;
+    PROFILER_Record_t* Local_pRecord;
+
+    PROFILER_ACTIVE_VECTOR(Local_uint32Vector);
+    Local_uint8Slot = profiler_slot[Local_uint32Vector & PROFILER_IPSR_MASK];
+    Local_pRecord = &SPROFILER_Records[Local_uint8Slot];
+
+    /*consume the pending mark before the handler runs, it may raise its own vector again*/
+    Local_uint32HasLatency = Atomic_uint32FetchAnd(&profiler_pending_mask,~(1UL << Local_uint8Slot)) & (1UL << Local_uint8Slot);
+    if(Local_uint32HasLatency != 0)
+    {
+        Local_uint32Latency = Local_uint32Entry - profiler_pending_stamp[Local_uint8Slot];
+    }
+
+    profiler_nested_cycles = 0;
+    profiler_handler[Local_uint8Slot]();
+    Local_uint32Cycles = MDWT_CYCLE_COUNT() - Local_uint32Entry;
+    /*everything this handler took is charged as nested time to the handler it preempted*/
+    Local_uint32Outer += Local_uint32Cycles;
+    Local_uint32Cycles -= profiler_nested_cycles;
+    profiler_nested_cycles = Local_uint32Outer;
+
+    Local_pRecord->Sequence++;
+    ATOMIC_FENCE();
+    Local_pRecord->Count++;
+    Local_pRecord->TotalCycles += Local_uint32Cycles;
+    if(Local_uint32Cycles < Local_pRecord->MinCycles)
+    {
+        Local_pRecord->MinCycles = Local_uint32Cycles;
+    }
+    if(Local_uint32Cycles > Local_pRecord->MaxCycles)
+    {
+        Local_pRecord->MaxCycles = Local_uint32Cycles;
+    }
+    if(Local_uint32HasLatency != 0)
+    {
+        Local_pRecord->LatencyCount++;
+        Local_pRecord->TotalLatency += Local_uint32Latency;
+        if(Local_uint32Latency < Local_pRecord->MinLatency)
+        {
+            Local_pRecord->MinLatency = Local_uint32Latency;
+        }
+        if(Local_uint32Latency > Local_pRecord->MaxLatency)
+        {
+            Local_pRecord->MaxLatency = Local_uint32Latency;
+        }
+    }
+    ATOMIC_FENCE();
+    Local_pRecord->Sequence++;
+}
+
+/*64/32 division by shift and subtract, constant shifts only (no runtime library in the link)*/
+static uint32 SPROFILER_uint32Average(uint64 Copy_uint64Total , uint32 Copy_uint32Count)
+{
+    uint64 Local_uint64Remainder = 0;
+    uint64 Local_uint64Quotient = 0;
+    uint8 Local_uint8Itr;
+
+    if(Copy_uint32Count == 0)
+    {
+        return 0;
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < 64; Local_uint8Itr++)
+    {
+        Local_uint64Remainder = (Local_uint64Remainder << 1) | (Copy_uint64Total >> 63);
+        Copy_uint64Total <<= 1;
+        Local_uint64Quotient <<= 1;
+        if(Local_uint64Remainder >= Copy_uint32Count)
+        {
+            Local_uint64Remainder -= Copy_uint32Count;
+            Local_uint64Quotient |= 1U;
+        }
+    }
+    return (uint32)Local_uint64Quotient;
+}
+
+static void SPROFILER_VoidPutNumber(void (*Copy_pPutChar)(uint8 Copy_u8Data) , uint32 Copy_uint32Number)
+{
+    uint8 Local_uint8Digits[10];
+    uint8 Local_uint8Count = 0;
+
+    do
+    {
+        Local_uint8Digits[Local_uint8Count++] = (uint8)('0' + (Copy_uint32Number % 10));
+        Copy_uint32Number /= 10;
+    }while(Copy_uint32Number != 0);
+    while(Local_uint8Count != 0)
+    {
+        Copy_pPutChar(Local_uint8Digits[--Local_uint8Count]);
+    }
+    Copy_pPutChar(' ');
+}
+
+static uint8 SPROFILER_uint8Slot(uint8 Copy_uint8Vector)
+{
+    return (Copy_uint8Vector < NVIC_VECTOR_COUNT) ? profiler_slot[Copy_uint8Vector] : PROFILER_NO_SLOT;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidInit(void)
+* \Description     : start the DWT cycle counter, call before the first attach
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidInit(void)
+{
+    MDWT_VoidEnableCycleCounter();
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SPROFILER_Std_ReturnTypeAttach(uint8 Copy_uint8Vector)
+* \Description     : wrap the handler currently installed for a vector. attach after the driver installed its own
+*                    handler , a later MNVIC_VoidAttachHandler on the vector removes the wrapper
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : PROFILER_IRQ_VECTOR(irq) or PROFILER_SYSTEM_VECTOR(exception)
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid vector , already attached or no free record
+*******************************************************************************/
+Std_ReturnType SPROFILER_Std_ReturnTypeAttach(uint8 Copy_uint8Vector)
+{
+    uint8 Local_uint8Slot;
+    PROFILER_Record_t* Local_pRecord;
+
+    /*reset vector and stack pointer are not handlers, HardFault/NMI are not patched*/
+    if((Copy_uint8Vector < NVIC_EXC_MEMMANAGE) || (Copy_uint8Vector >= NVIC_VECTOR_COUNT) ||
+       (profiler_slot[Copy_uint8Vector] != PROFILER_NO_SLOT))
+    {
+        return N_OK;
+    }
+    for(Local_uint8Slot = 0; Local_uint8Slot < PROFILER_MAX_HANDLERS; Local_uint8Slot++)
+    {
+        if(SPROFILER_Records[Local_uint8Slot].Vector == 0)
+        {
+            break;
+        }
+    }
+    if(Local_uint8Slot == PROFILER_MAX_HANDLERS)
+    {
+        return N_OK;
+    }
+    Local_pRecord = &SPROFILER_Records[Local_uint8Slot];
+    Local_pRecord->Vector = Copy_uint8Vector;
+    Local_pRecord->MinCycles = 0xFFFFFFFFUL;
+    Local_pRecord->MinLatency = 0xFFFFFFFFUL;
+    profiler_handler[Local_uint8Slot] = MNVIC_pGetVectorHandler(Copy_uint8Vector);
+    profiler_slot[Copy_uint8Vector] = Local_uint8Slot;
+
+    /*wrapper goes live only when its tables are complete*/
+    if(Copy_uint8Vector < 16)
+    {
+        MNVIC_VoidAttachSystemHandler((NVIC_SystemException_t)Copy_uint8Vector,SPROFILER_VoidWrapper);
+    }
+    else
+    {
+        MNVIC_VoidAttachHandler((NVIC_InterruptType_t)(Copy_uint8Vector - 16),SPROFILER_VoidWrapper);
+    }
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidMarkPending(uint8 Copy_uint8Vector)
+* \Description     : record "now" as the moment the vector became pending, call right before raising the interrupt
+*                    in software (SWIER , STIR , PendSV) or from a capture of the hardware event time.
+*                    the next entry of the handler measures its latency against this mark
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidMarkPending(uint8 Copy_uint8Vector)
+{
+    uint8 Local_uint8Slot = SPROFILER_uint8Slot(Copy_uint8Vector);
+
+    if(Local_uint8Slot == PROFILER_NO_SLOT)
+    {
+        return;
+    }
+    /*a second mark before the handler ran keeps the first one: latency counts from the oldest request*/
+    if((profiler_pending_mask & (1UL << Local_uint8Slot)) == 0)
+    {
+        profiler_pending_stamp[Local_uint8Slot] = MDWT_CYCLE_COUNT();
+        Atomic_VoidSetBits(&profiler_pending_mask,1UL << Local_uint8Slot);
+    }
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SPROFILER_Std_ReturnTypeGetRecord(uint8 Copy_uint8Vector , PROFILER_Record_t* Copy_pRecord)
+* \Description     : consistent copy of a record, retried while the wrapper updates it (no interrupt masking)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector
+* \Parameters (out): PROFILER_Record_t* Copy_pRecord
+* \Return value:   : OK , N_OK vector not profiled
+*******************************************************************************/
+Std_ReturnType SPROFILER_Std_ReturnTypeGetRecord(uint8 Copy_uint8Vector , PROFILER_Record_t* Copy_pRecord)
+{
+    uint8 Local_uint8Slot = SPROFILER_uint8Slot(Copy_uint8Vector);
+    PROFILER_Record_t* Local_pRecord;
+    uint32 Local_uint32Sequence;
+
+    if(Local_uint8Slot == PROFILER_NO_SLOT)
+    {
+        return N_OK;
+    }
+    Local_pRecord = &SPROFILER_Records[Local_uint8Slot];
+    do
+    {
+        Local_uint32Sequence = Local_pRecord->Sequence;
+        ATOMIC_FENCE();
+        Copy_pRecord->Vector = Local_pRecord->Vector;
+        Copy_pRecord->Count = Local_pRecord->Count;
+        Copy_pRecord->MinCycles = Local_pRecord->MinCycles;
+        Copy_pRecord->MaxCycles = Local_pRecord->MaxCycles;
+        Copy_pRecord->TotalCycles = Local_pRecord->TotalCycles;
+        Copy_pRecord->LatencyCount = Local_pRecord->LatencyCount;
+        Copy_pRecord->MinLatency = Local_pRecord->MinLatency;
+        Copy_pRecord->MaxLatency = Local_pRecord->MaxLatency;
+        Copy_pRecord->TotalLatency = Local_pRecord->TotalLatency;
+        ATOMIC_FENCE();
+    }while(((Local_uint32Sequence & 1U) != 0) || (Local_uint32Sequence != Local_pRecord->Sequence));
+    Copy_pRecord->Sequence = Local_uint32Sequence;
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidDump(void (*Copy_pPutChar)(uint8 Copy_u8Data))
+* \Description     : print one line per record: vector count min max avg (cycles) lat_n lat_min lat_max lat_avg,
+*                    e.g. SPROFILER_VoidDump(MUSART1_voidSendData)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pPutChar : byte output
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidDump(void (*Copy_pPutChar)(uint8 Copy_u8Data))
+{
+    uint8 Local_uint8Itr;
+    PROFILER_Record_t Local_Record;
+
+    for(Local_uint8Itr = 0; Local_uint8Itr < PROFILER_MAX_HANDLERS; Local_uint8Itr++)
+    {
+        if((SPROFILER_Records[Local_uint8Itr].Vector == 0) ||
+           (SPROFILER_Std_ReturnTypeGetRecord(SPROFILER_Records[Local_uint8Itr].Vector,&Local_Record) != OK))
+        {
+            continue;
+        }
+        SPROFILER_VoidPutNumber(Copy_pPutChar,Local_Record.Vector);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,Local_Record.Count);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,(Local_Record.Count != 0) ? Local_Record.MinCycles : 0);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,Local_Record.MaxCycles);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,SPROFILER_uint32Average(Local_Record.TotalCycles,Local_Record.Count));
+        SPROFILER_VoidPutNumber(Copy_pPutChar,Local_Record.LatencyCount);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,(Local_Record.LatencyCount != 0) ? Local_Record.MinLatency : 0);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,Local_Record.MaxLatency);
+        SPROFILER_VoidPutNumber(Copy_pPutChar,SPROFILER_uint32Average(Local_Record.TotalLatency,Local_Record.LatencyCount));
+        Copy_pPutChar('\r');
+        Copy_pPutChar('\n');
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void SPROFILER_VoidProbe(void)
+* \Description     : latency probe: stores the cycle count it is entered at. install it as the handler under test ,
+*                    either straight in the vector table (MNVIC_VoidAttachHandler) or as a driver callback
+*                    (e.g. MEXTERNAL_INTERRUPT_VoidInterruptCallback) , then call SPROFILER_uint32MeasureEntry
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SPROFILER_VoidProbe(void)
+{
+    /*first load of the function: nothing but the return address push comes before it*/
+    profiler_probe_stamp = MDWT_CYCLE_COUNT();
+    profiler_probe_count++;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 SPROFILER_uint32MeasureEntry(uint8 Copy_uint8Vector)
+* \Description     : entry latency of a peripheral vector: sets it pending in the NVIC PROFILER_MEASURE_RUNS times and
+*                    returns the fewest cycles from the set pending call to SPROFILER_VoidProbe. the call and the probe
+*                    store are included and are the same for every way the probe is installed , so the difference of
+*                    two measurements is the exact cost of the dispatch in between.
+*                    the IRQ must be enabled with a priority above the caller's
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : PROFILER_IRQ_VECTOR(irq)
+* \Parameters (out): None
+* \Return value:   : uint32 cycles , 0 if the probe did not run (system vector , IRQ disabled or masked)
+*******************************************************************************/
+uint32 SPROFILER_uint32MeasureEntry(uint8 Copy_uint8Vector)
+{
+    uint32 Local_uint32Best = 0xFFFFFFFFUL;
+    uint32 Local_uint32Count;
+    uint32 Local_uint32Start;
+    uint32 Local_uint32Wait;
+    uint8 Local_uint8Run;
+
+    if((Copy_uint8Vector < 16) || (Copy_uint8Vector >= NVIC_VECTOR_COUNT))
+    {
+        return 0;
+    }
+    for(Local_uint8Run = 0; Local_uint8Run < PROFILER_MEASURE_RUNS; Local_uint8Run++)
+    {
+        Local_uint32Count = profiler_probe_count;
+        Local_uint32Start = MDWT_CYCLE_COUNT();
+        MNVIC_VoidSetPendingInterrupt((NVIC_InterruptType_t)(Copy_uint8Vector - 16));
+        for(Local_uint32Wait = PROFILER_MEASURE_TIMEOUT; (profiler_probe_count == Local_uint32Count) && (Local_uint32Wait != 0); Local_uint32Wait--);
+        if(profiler_probe_count == Local_uint32Count)
+        {
+            return 0;
+        }
+        /*the first runs pay for cold prefetch and flash wait states, the minimum is the entry path itself*/
+        if((profiler_probe_stamp - Local_uint32Start) < Local_uint32Best)
+        {
+            Local_uint32Best = profiler_probe_stamp - Local_uint32Start;
+        }
+    }
+    return Local_uint32Best;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SPROFILER_Std_ReturnTypeMeasureHandler(uint8 Copy_uint8Vector , void (*Copy_pRaise)(void) , PROFILER_Record_t* Copy_pRecord)
+* \Description     : cycle count of a real handler: attaches the vector if it is not profiled yet , raises it
+*                    PROFILER_MEASURE_RUNS times (marked pending first , so the latency fields are filled too) and
+*                    copies the record. Copy_pRaise makes the peripheral request the interrupt (e.g. SWIER write , CAN
+*                    loopback frame) so the handler finds its flags set , NULL sets the vector pending in the NVIC.
+*                    run it once per build (make RAMFUNC=1 / RAMFUNC=0) to compare SRAM and flash placement
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : uint8 Copy_uint8Vector : PROFILER_IRQ_VECTOR(irq) or PROFILER_SYSTEM_VECTOR(exception)
+*                    void (*Copy_pRaise)(void) : raises the interrupt once , NULL only for peripheral vectors
+* \Parameters (out): PROFILER_Record_t* Copy_pRecord
+* \Return value:   : OK , N_OK no record , no raise function for a system vector or the handler did not run
+*******************************************************************************/
+Std_ReturnType SPROFILER_Std_ReturnTypeMeasureHandler(uint8 Copy_uint8Vector , void (*Copy_pRaise)(void) , PROFILER_Record_t* Copy_pRecord)
+{
+    /*volatile: the count is bumped by the wrapper while this function polls it*/
+    volatile PROFILER_Record_t* Local_pRecord;
+    uint32 Local_uint32Count;
+    uint32 Local_uint32Wait;
+    uint8 Local_uint8Slot;
+    uint8 Local_uint8Run;
+
+    if((Copy_pRaise == NULL) && ((Copy_uint8Vector < 16) || (Copy_uint8Vector >= NVIC_VECTOR_COUNT)))
+    {
+        return N_OK;
+    }
+    /*already attached is fine: the runs add to the existing record*/
+    SPROFILER_Std_ReturnTypeAttach(Copy_uint8Vector);
+    Local_uint8Slot = SPROFILER_uint8Slot(Copy_uint8Vector);
+    if(Local_uint8Slot == PROFILER_NO_SLOT)
+    {
+        return N_OK;
+    }
+    Local_pRecord = &SPROFILER_Records[Local_uint8Slot];
+    for(Local_uint8Run = 0; Local_uint8Run < PROFILER_MEASURE_RUNS; Local_uint8Run++)
+    {
+        Local_uint32Count = Local_pRecord->Count;
+        SPROFILER_VoidMarkPending(Copy_uint8Vector);
+        if(Copy_pRaise == NULL)
+        {
+            MNVIC_VoidSetPendingInterrupt((NVIC_InterruptType_t)(Copy_uint8Vector - 16));
+        }
+        else
+        {
+            Copy_pRaise();
+        }
+        for(Local_uint32Wait = PROFILER_MEASURE_TIMEOUT; (Local_pRecord->Count == Local_uint32Count) && (Local_uint32Wait != 0); Local_uint32Wait--);
+        if(Local_pRecord->Count == Local_uint32Count)
+        {
+            return N_OK;
+        }
+    }
+    return SPROFILER_Std_ReturnTypeGetRecord(Copy_uint8Vector,Copy_pRecord);
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SCHED_config.h
+ *       Module:  SCHED Module
+ *  Description:  Configuration header file for cooperative task scheduler
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SCHED_CONFIG_H
+#define _SCHED_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*static task table: SCHED_TASK(function , priority), priority 0..31 and unique, lower number = more urgent.
+  the priority is also the task id used to post events. a build may bring its own table (e.g. the host benchmark)*/
+#ifndef SCHED_TASKS
+#define SCHED_TASKS                 { SCHED_TASK(App_VoidBlinkTask, 10) }
+#endif
+
+/*per task CPU accounting (runs , total and longest run in cycles) and idle time
+  Options: 1 enabled , 0 disabled*/
+#define SCHED_CPU_STATS             1
+
+/*idle with nothing ready: 1 tickless sleep until the next software timer (SSWTIMER_VoidIdle) , 0 plain WFI*/
+#define SCHED_TICKLESS_IDLE         1
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*task functions listed in SCHED_TASKS*/
+void App_VoidBlinkTask(uint32 Copy_uint32Events);
+
+#endif
@@ -0,0 +1,115 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SCHED_interface.h
+ *       Module:  SCHED Module
+ *  Description:  Interface header file for cooperative task scheduler.
+ *                run to completion tasks from a static table (SCHED_TASKS), one per priority. ISRs , timer
+ *                callbacks and tasks post event bits to a task lock-free , the task becomes ready and the main
+ *                loop runs the most urgent ready task (CLZ of the ready bitmap , O(1)) with the events it got.
+ *                a task is never preempted by another task , only by interrupts. with nothing ready the core
+ *                sleeps. builds on Linux too (SSCHED_uint8RunOnce drives it from a benchmark harness).
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SCHED_INTERFACE_H
+#define _SCHED_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../LIB/Atomic.h"
+
+#include "SCHED_config.h"
+#include "SCHED_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint32 Runs;
+    uint32 MaxCycles;                   /*longest single run*/
+    uint64 TotalCycles;                 /*includes interrupts taken while the task ran*/
+}SCHED_TaskStats_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSCHED_Std_ReturnTypeInit(void)
+* \Description     : load SCHED_TASKS , no task ready. SSWTIMER_VoidInit first when SCHED_TICKLESS_IDLE is 1
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK a priority out of range or used twice (that entry is skipped)
+*******************************************************************************/
+Std_ReturnType SSCHED_Std_ReturnTypeInit(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSCHED_Std_ReturnTypePostEvent(uint8 Copy_uint8Task , uint32 Copy_uint32Events)
+* \Description     : OR event bits into a task and make it ready , lock-free (callable from any ISR priority).
+*                    events posted again before the task runs are merged
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Task : task priority , uint32 Copy_uint32Events : non zero event bits
+* \Parameters (out): None
+* \Return value:   : OK , N_OK no such task or no event
+*******************************************************************************/
+Std_ReturnType SSCHED_Std_ReturnTypePostEvent(uint8 Copy_uint8Task , uint32 Copy_uint32Events);
+
+/******************************************************************************
+* \Syntax          : uint8 SSCHED_uint8RunOnce(void)
+* \Description     : run the most urgent ready task once with the events it collected
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : 1 a task was selected , 0 nothing ready
+*******************************************************************************/
+uint8 SSCHED_uint8RunOnce(void);
+
+/******************************************************************************
+* \Syntax          : void SSCHED_VoidRun(void)
+* \Description     : main loop: run ready tasks , most urgent first , and sleep when none is ready (the ready check
+*                    and the sleep are atomic so a post from an ISR is never missed). never returns on target
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSCHED_VoidRun(void);
+
+#if SCHED_CPU_STATS == 1
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSCHED_Std_ReturnTypeGetStats(uint8 Copy_uint8Task , SCHED_TaskStats_t* Copy_pStats)
+* \Description     : CPU accounting of a task , consistent when read from a task
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Task
+* \Parameters (out): SCHED_TaskStats_t* Copy_pStats
+* \Return value:   : OK , N_OK no such task
+*******************************************************************************/
+Std_ReturnType SSCHED_Std_ReturnTypeGetStats(uint8 Copy_uint8Task , SCHED_TaskStats_t* Copy_pStats);
+
+/******************************************************************************
+* \Syntax          : uint64 SSCHED_uint64GetIdleUs(void)
+* \Description     : microseconds spent asleep in SSCHED_VoidRun on the SysTick timebase (the cycle counter stops
+*                    in sleep) , load = 1 - idle / elapsed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint64 idle microseconds
+*******************************************************************************/
+uint64 SSCHED_uint64GetIdleUs(void);
+#endif
+
+#endif
@@ -0,0 +1,57 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SCHED_private.h
+ *       Module:  SCHED Module
+ *  Description:  Private header file for cooperative task scheduler
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SCHED_PRIVATE_H
+#define _SCHED_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define SCHED_MAX_PRIORITIES        32
+
+/*priority p is bit 31-p of the ready mask: CLZ of the mask is the most urgent ready priority*/
+#define SCHED_READY_BIT(PRIO)       (0x80000000UL >> (PRIO))
+
+/*entry of SCHED_TASKS*/
+#define SCHED_TASK(FUNCTION,PRIO)   {(FUNCTION), (PRIO)}
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+#define SCHED_TIMESTAMP()           MDWT_CYCLE_COUNT()
+#define SCHED_IDLE_TIMESTAMP()      MSYSTICK_uint64GetTimeUs()
+#define SCHED_WFI()                 __asm__ volatile ("dsb\n\twfi\n\tisb" ::: "memory")
+#else
+/*host build (Linux benchmarks): the harness supplies the time base and idle returns at once*/
+uint32 SSCHED_uint32HostTimestamp(void);
+#define SCHED_TIMESTAMP()           SSCHED_uint32HostTimestamp()
+#define SCHED_IDLE_TIMESTAMP()      0
+#define SCHED_WFI()
+#endif
+
+/*sleep with nothing ready (called with PRIMASK set)*/
+#if (SCHED_TICKLESS_IDLE == 1) && (ATOMIC_TARGET_CORTEX_M == 1)
+#define SCHED_IDLE()                SSWTIMER_VoidIdle()
+#else
+#define SCHED_IDLE()                SCHED_WFI()
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef void (*SCHED_TaskFunction_t)(uint32 Copy_uint32Events);
+
+typedef struct
+{
+    SCHED_TaskFunction_t Function;
+    uint8 Priority;
+}SCHED_TaskCfg_t;
+
+#endif
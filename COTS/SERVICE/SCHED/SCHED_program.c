@@ -0,0 +1,235 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SCHED_program.c
+ *       Module:  SCHED Module
+ *  Description:  implementaion C file for cooperative task scheduler
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "SCHED_interface.h"
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+#include "../../MCAL/DWT/DWT_interface.h"
+#include "../../MCAL/SYSTick/SYSTick_interface.h"
+#include "../SW_TIMER/SW_TIMER_interface.h"
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static const SCHED_TaskCfg_t SCHED_TaskTable[] = SCHED_TASKS;
+
+/*task of every priority , NULL: none*/
+static SCHED_TaskFunction_t SCHED_Tasks[SCHED_MAX_PRIORITIES];
+/*events posted and not yet taken by every task*/
+static volatile uint32 SCHED_Events[SCHED_MAX_PRIORITIES];
+static volatile uint32 SCHED_ReadyMask = 0;
+
+#if SCHED_CPU_STATS == 1
+static SCHED_TaskStats_t SCHED_Stats[SCHED_MAX_PRIORITIES];
+static uint64 SCHED_IdleUs = 0;
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSCHED_Std_ReturnTypeInit(void)
+* \Description     : load SCHED_TASKS , no task ready. SSWTIMER_VoidInit first when SCHED_TICKLESS_IDLE is 1
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK a priority out of range or used twice (that entry is skipped)
+*******************************************************************************/
+Std_ReturnType SSCHED_Std_ReturnTypeInit(void)
+{
+    uint8 Local_uint8Itr;
+    uint8 Local_uint8Priority;
+    Std_ReturnType Local_Std_ReturnTypeState = OK;
+
+    SCHED_ReadyMask = 0;
+    for(Local_uint8Itr = 0; Local_uint8Itr < SCHED_MAX_PRIORITIES; Local_uint8Itr++)
+    {
+        SCHED_Tasks[Local_uint8Itr] = NULL;
+        SCHED_Events[Local_uint8Itr] = 0;
+#if SCHED_CPU_STATS == 1
+        SCHED_Stats[Local_uint8Itr].Runs = 0;
+        SCHED_Stats[Local_uint8Itr].MaxCycles = 0;
+        SCHED_Stats[Local_uint8Itr].TotalCycles = 0;
+#endif
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < (sizeof(SCHED_TaskTable) / sizeof(SCHED_TaskTable[0])); Local_uint8Itr++)
+    {
+        Local_uint8Priority = SCHED_TaskTable[Local_uint8Itr].Priority;
+        if((Local_uint8Priority >= SCHED_MAX_PRIORITIES) || (SCHED_Tasks[Local_uint8Priority] != NULL))
+        {
+            Local_Std_ReturnTypeState = N_OK;
+            continue;
+        }
+        SCHED_Tasks[Local_uint8Priority] = SCHED_TaskTable[Local_uint8Itr].Function;
+    }
+#if ATOMIC_TARGET_CORTEX_M == 1
+    MDWT_VoidEnableCycleCounter();
+#endif
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSCHED_Std_ReturnTypePostEvent(uint8 Copy_uint8Task , uint32 Copy_uint32Events)
+* \Description     : OR event bits into a task and make it ready , lock-free (callable from any ISR priority).
+*                    events posted again before the task runs are merged
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Task : task priority , uint32 Copy_uint32Events : non zero event bits
+* \Parameters (out): None
+* \Return value:   : OK , N_OK no such task or no event
+*******************************************************************************/
+Std_ReturnType SSCHED_Std_ReturnTypePostEvent(uint8 Copy_uint8Task , uint32 Copy_uint32Events)
+{
+    if((Copy_uint8Task >= SCHED_MAX_PRIORITIES) || (SCHED_Tasks[Copy_uint8Task] == NULL) || (Copy_uint32Events == 0))
+    {
+        return N_OK;
+    }
+    /*events first: the scheduler never sees the ready bit without them*/
+    (void)Atomic_uint32FetchOr(&SCHED_Events[Copy_uint8Task],Copy_uint32Events);
+    Atomic_VoidSetBits(&SCHED_ReadyMask,SCHED_READY_BIT(Copy_uint8Task));
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : uint8 SSCHED_uint8RunOnce(void)
+* \Description     : run the most urgent ready task once with the events it collected
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : 1 a task was selected , 0 nothing ready
+*******************************************************************************/
+uint8 SSCHED_uint8RunOnce(void)
+{
+    uint32 Local_uint32Ready = Atomic_uint32LoadAcquire(&SCHED_ReadyMask);
+    uint32 Local_uint32Events;
+    uint8 Local_uint8Priority;
+#if SCHED_CPU_STATS == 1
+    uint32 Local_uint32Start;
+    uint32 Local_uint32Cycles;
+#endif
+
+    if(Local_uint32Ready == 0)
+    {
+        return 0;
+    }
+    /*one CLZ instruction on the target*/
+    Local_uint8Priority = (uint8)__builtin_clz((unsigned int)Local_uint32Ready);
+    /*ready bit before the events: a post in between sets it again and is seen on the next pass*/
+    Atomic_VoidClearBits(&SCHED_ReadyMask,SCHED_READY_BIT(Local_uint8Priority));
+    Local_uint32Events = Atomic_uint32Exchange(&SCHED_Events[Local_uint8Priority],0);
+    if(Local_uint32Events != 0)
+    {
+#if SCHED_CPU_STATS == 1
+        Local_uint32Start = SCHED_TIMESTAMP();
+        SCHED_Tasks[Local_uint8Priority](Local_uint32Events);
+        Local_uint32Cycles = SCHED_TIMESTAMP() - Local_uint32Start;
+        SCHED_Stats[Local_uint8Priority].Runs++;
+        SCHED_Stats[Local_uint8Priority].TotalCycles += Local_uint32Cycles;
+        if(Local_uint32Cycles > SCHED_Stats[Local_uint8Priority].MaxCycles)
+        {
+            SCHED_Stats[Local_uint8Priority].MaxCycles = Local_uint32Cycles;
+        }
+#else
+        SCHED_Tasks[Local_uint8Priority](Local_uint32Events);
+#endif
+    }
+    return 1;
+}
+
+/******************************************************************************
+* \Syntax          : void SSCHED_VoidRun(void)
+* \Description     : main loop: run ready tasks , most urgent first , and sleep when none is ready (the ready check
+*                    and the sleep are atomic so a post from an ISR is never missed). never returns on target
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSCHED_VoidRun(void)
+{
+    uint32 Local_uint32Saved;
+#if SCHED_CPU_STATS == 1
+    uint64 Local_uint64Start;
+#endif
+
+    for(;;)
+    {
+        if(SSCHED_uint8RunOnce() != 0)
+        {
+            continue;
+        }
+        Local_uint32Saved = Critical_uint32EnterAll();
+        if(SCHED_ReadyMask == 0)
+        {
+#if SCHED_CPU_STATS == 1
+            Local_uint64Start = SCHED_IDLE_TIMESTAMP();
+            SCHED_IDLE();
+            SCHED_IdleUs += SCHED_IDLE_TIMESTAMP() - Local_uint64Start;
+#else
+            SCHED_IDLE();
+#endif
+        }
+        /*the interrupt that woke the core runs here*/
+        Critical_VoidExitAll(Local_uint32Saved);
+#if ATOMIC_TARGET_CORTEX_M == 0
+        /*host build: no interrupt can make a task ready*/
+        if(SCHED_ReadyMask == 0)
+        {
+            return;
+        }
+#endif
+    }
+}
+
+#if SCHED_CPU_STATS == 1
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSCHED_Std_ReturnTypeGetStats(uint8 Copy_uint8Task , SCHED_TaskStats_t* Copy_pStats)
+* \Description     : CPU accounting of a task , consistent when read from a task
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Task
+* \Parameters (out): SCHED_TaskStats_t* Copy_pStats
+* \Return value:   : OK , N_OK no such task
+*******************************************************************************/
+Std_ReturnType SSCHED_Std_ReturnTypeGetStats(uint8 Copy_uint8Task , SCHED_TaskStats_t* Copy_pStats)
+{
+    if((Copy_uint8Task >= SCHED_MAX_PRIORITIES) || (SCHED_Tasks[Copy_uint8Task] == NULL))
+    {
+        return N_OK;
+    }
+    *Copy_pStats = SCHED_Stats[Copy_uint8Task];
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : uint64 SSCHED_uint64GetIdleUs(void)
+* \Description     : microseconds spent asleep in SSCHED_VoidRun on the SysTick timebase (the cycle counter stops
+*                    in sleep) , load = 1 - idle / elapsed
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint64 idle microseconds
+*******************************************************************************/
+uint64 SSCHED_uint64GetIdleUs(void)
+{
+    return SCHED_IdleUs;
+}
+#endif
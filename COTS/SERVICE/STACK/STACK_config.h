@@ -0,0 +1,37 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  STACK_config.h
+ *       Module:  STACK Module
+ *  Description:  Configuration header file for stack monitor
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _STACK_CONFIG_H
+#define _STACK_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*word written over unused stack at boot (main stack) and on task creation (kernel stacks)*/
+#define STACK_PAINT_PATTERN         0xA5A5A5A5UL
+
+/*lowest bytes of every monitored stack that must keep the pattern , a write into them is reported as an
+  overflow before the stack runs into the data below it (multiple of 4)*/
+#define STACK_GUARD_BYTES           64
+
+/*monitored stacks: the main stack plus one per kernel task*/
+#define STACK_MAX_REGIONS           9
+
+/*most urgent NVIC group priority allowed to register a stack (1..15) , a kernel task created from such a handler
+  takes its region with this priority and below masked through BASEPRI*/
+#define STACK_LOCK_PRIORITY         1
+
+/*SysTick ticks between two guard checks from the SW_TIMER wheel , 0: no periodic check (call
+  SSTACK_Std_ReturnTypeCheck from the idle loop instead)*/
+#define STACK_CHECK_PERIOD_TICKS    100
+
+#endif
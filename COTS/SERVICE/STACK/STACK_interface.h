@@ -0,0 +1,132 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  STACK_interface.h
+ *       Module:  STACK Module
+ *  Description:  Interface header file for stack monitor.
+ *                unused stack is painted with STACK_PAINT_PATTERN , the high-water mark of a stack is the deepest
+ *                word that lost the pattern. the lowest STACK_GUARD_BYTES of every stack are a guard zone checked
+ *                periodically from the SW_TIMER wheel (SysTick) or from the idle loop.
+ *                region 0 is the main stack (.stack in the linker script) painted by Rest_Handler before main.
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _STACK_INTERFACE_H
+#define _STACK_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+#include "../../LIB/Atomic.h"
+
+#include "STACK_config.h"
+#include "STACK_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define STACK_MAIN_REGION           0
+#define STACK_INVALID_REGION        0xFF
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidPaintMainStack(void)
+* \Description     : paint the main stack from its bottom up to just under the current stack pointer.
+*                    called by Rest_Handler , uses no .data or .bss
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidPaintMainStack(void);
+
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidPaint(uint32* Copy_pBottom , uint32 Copy_uint32Words)
+* \Description     : paint a stack that is not in use yet (task stack before its first frame is built)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32* Copy_pBottom : lowest word , uint32 Copy_uint32Words : stack size
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidPaint(uint32* Copy_pBottom , uint32 Copy_uint32Words);
+
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidInit(void)
+* \Description     : register the main stack as region 0 and start the periodic guard check
+*                    (STACK_CHECK_PERIOD_TICKS). call after SSWTIMER_VoidInit and before the kernel creates tasks
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSTACK_Std_ReturnTypeRegister(uint32* Copy_pBottom , uint32 Copy_uint32Words ,
+*                                                                 uint8* Copy_pRegion)
+* \Description     : monitor a painted stack (high-water mark and guard zone). callable up to
+*                    STACK_LOCK_PRIORITY
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32* Copy_pBottom : lowest word , uint32 Copy_uint32Words : stack size
+* \Parameters (out): uint8* Copy_pRegion : region id , STACK_INVALID_REGION on failure
+* \Return value:   : OK , N_OK table full or stack smaller than the guard zone
+*******************************************************************************/
+Std_ReturnType SSTACK_Std_ReturnTypeRegister(uint32* Copy_pBottom , uint32 Copy_uint32Words , uint8* Copy_pRegion);
+
+/******************************************************************************
+* \Syntax          : uint32 SSTACK_uint32GetHighWater(uint8 Copy_uint8Region)
+* \Description     : deepest use of a stack since it was painted , in bytes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Region
+* \Parameters (out): None
+* \Return value:   : uint32 bytes used at the peak , 0 unknown region
+*******************************************************************************/
+uint32 SSTACK_uint32GetHighWater(uint8 Copy_uint8Region);
+
+/******************************************************************************
+* \Syntax          : uint32 SSTACK_uint32GetSize(uint8 Copy_uint8Region)
+* \Description     : size of a monitored stack in bytes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Region
+* \Parameters (out): None
+* \Return value:   : uint32 bytes , 0 unknown region
+*******************************************************************************/
+uint32 SSTACK_uint32GetSize(uint8 Copy_uint8Region);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSTACK_Std_ReturnTypeCheck(void)
+* \Description     : verify the guard zone of every region , the overflow handler runs for each damaged one
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK a guard zone was written
+*******************************************************************************/
+Std_ReturnType SSTACK_Std_ReturnTypeCheck(void);
+
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidSetOverflowHandler(void (*Copy_pHandler)(uint8 Copy_uint8Region))
+* \Description     : action on a damaged guard zone (log , reset ...). without a handler the check records the
+*                    region in SSTACK_uint8OverflowRegion and stops there for the debugger
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pHandler : NULL restores the default
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidSetOverflowHandler(void (*Copy_pHandler)(uint8 Copy_uint8Region));
+
+#endif
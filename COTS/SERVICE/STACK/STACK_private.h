@@ -0,0 +1,48 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  STACK_private.h
+ *       Module:  STACK Module
+ *  Description:  Private header file for stack monitor
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _STACK_PRIVATE_H
+#define _STACK_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define STACK_GUARD_WORDS           (STACK_GUARD_BYTES / 4)
+
+/*words left unpainted under the current stack pointer when the main stack is painted from the running code*/
+#define STACK_PAINT_MARGIN_WORDS    8
+
+#if ATOMIC_TARGET_CORTEX_M == 1
+#define STACK_READ_SP(VAR)          __asm__ volatile ("mov %0, sp" : "=r" (VAR))
+#else
+/*host build: the address of a local stands for the stack pointer*/
+#define STACK_READ_SP(VAR)          ((VAR) = (uint32)&(VAR))
+#endif
+
+#if ((STACK_GUARD_BYTES % 4) != 0) || (STACK_GUARD_BYTES < 4)
+#error "STACK_GUARD_BYTES must be a non zero multiple of 4"
+#endif
+
+#if (STACK_MAX_REGIONS < 1) || (STACK_MAX_REGIONS > 254)
+#error "STACK_MAX_REGIONS must be 1..254"
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct
+{
+    uint32* Bottom;                     /*lowest address , the stack grows down towards it*/
+    uint32  Words;
+}STACK_Region_t;
+
+#endif
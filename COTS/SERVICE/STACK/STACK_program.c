@@ -0,0 +1,262 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  STACK_program.c
+ *       Module:  STACK Module
+ *  Description:  implementaion C file for stack monitor
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "STACK_interface.h"
+#include "../../MCAL/NVIC/NVIC_Interface.h"
+#include "../SW_TIMER/SW_TIMER_interface.h"
+
+/*BASEPRI value masking STACK_LOCK_PRIORITY and every less urgent interrupt*/
+#define STACK_LOCK_THRESHOLD        NVIC_ENCODE_PRIORITY(NVIC_PRIORITY_GROUPING,STACK_LOCK_PRIORITY,0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*main stack bounds from the linker script*/
+extern uint32 _S_stack;
+extern uint32 _stak_top;
+
+/*region of the last damaged guard zone , STACK_INVALID_REGION while none was seen*/
+volatile uint8 SSTACK_uint8OverflowRegion = STACK_INVALID_REGION;
+
+static STACK_Region_t stack_regions[STACK_MAX_REGIONS];
+static volatile uint8 stack_region_count = 0;
+static void (*stack_overflow_handler)(uint8 Copy_uint8Region) = NULL;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*SW_TIMER callback (DPC level)*/
+static void SSTACK_VoidPeriodicCheck(void* Copy_pArg)
+{
+    (void)Copy_pArg;
+    (void)SSTACK_Std_ReturnTypeCheck();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidPaintMainStack(void)
+* \Description     : paint the main stack from its bottom up to just under the current stack pointer.
+*                    called by Rest_Handler , uses no .data or .bss
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidPaintMainStack(void)
+{
+    uint32 Local_uint32Sp;
+    uint32* Local_pWord = &_S_stack;
+    uint32* Local_pEnd;
+
+    STACK_READ_SP(Local_uint32Sp);
+    Local_pEnd = (uint32*)(Local_uint32Sp & ~3UL) - STACK_PAINT_MARGIN_WORDS;
+    while(Local_pWord < Local_pEnd)
+    {
+        *Local_pWord++ = STACK_PAINT_PATTERN;
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidPaint(uint32* Copy_pBottom , uint32 Copy_uint32Words)
+* \Description     : paint a stack that is not in use yet (task stack before its first frame is built)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32* Copy_pBottom : lowest word , uint32 Copy_uint32Words : stack size
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidPaint(uint32* Copy_pBottom , uint32 Copy_uint32Words)
+{
+    while(Copy_uint32Words-- != 0)
+    {
+        *Copy_pBottom++ = STACK_PAINT_PATTERN;
+    }
+}
+
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidInit(void)
+* \Description     : register the main stack as region 0 and start the periodic guard check
+*                    (STACK_CHECK_PERIOD_TICKS). call after SSWTIMER_VoidInit and before the kernel creates tasks
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidInit(void)
+{
+    uint8 Local_uint8Region;
+#if STACK_CHECK_PERIOD_TICKS != 0
+    SW_TIMER_Handle_t Local_Timer;
+#endif
+
+    stack_region_count = 0;
+    (void)SSTACK_Std_ReturnTypeRegister(&_S_stack,(uint32)(&_stak_top - &_S_stack),&Local_uint8Region);
+#if STACK_CHECK_PERIOD_TICKS != 0
+    if(SSWTIMER_Std_ReturnTypeCreate(&Local_Timer,SSTACK_VoidPeriodicCheck,NULL) == OK)
+    {
+        (void)SSWTIMER_Std_ReturnTypeStart(Local_Timer,STACK_CHECK_PERIOD_TICKS,STACK_CHECK_PERIOD_TICKS);
+    }
+#endif
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSTACK_Std_ReturnTypeRegister(uint32* Copy_pBottom , uint32 Copy_uint32Words ,
+*                                                                 uint8* Copy_pRegion)
+* \Description     : monitor a painted stack (high-water mark and guard zone). callable up to
+*                    STACK_LOCK_PRIORITY
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint32* Copy_pBottom : lowest word , uint32 Copy_uint32Words : stack size
+* \Parameters (out): uint8* Copy_pRegion : region id , STACK_INVALID_REGION on failure
+* \Return value:   : OK , N_OK table full or stack smaller than the guard zone
+*******************************************************************************/
+Std_ReturnType SSTACK_Std_ReturnTypeRegister(uint32* Copy_pBottom , uint32 Copy_uint32Words , uint8* Copy_pRegion)
+{
+    uint32 Local_uint32Saved;
+    uint8 Local_uint8Region;
+
+    *Copy_pRegion = STACK_INVALID_REGION;
+    if((Copy_pBottom == NULL) || (Copy_uint32Words <= STACK_GUARD_WORDS))
+    {
+        return N_OK;
+    }
+    /*tasks created after the start register from any priority: slot taken , filled and counted in one section*/
+    Local_uint32Saved = Critical_uint32EnterBasepri(STACK_LOCK_THRESHOLD);
+    Local_uint8Region = stack_region_count;
+    if(Local_uint8Region >= STACK_MAX_REGIONS)
+    {
+        Critical_VoidExitBasepri(Local_uint32Saved);
+        return N_OK;
+    }
+    stack_regions[Local_uint8Region].Bottom = Copy_pBottom;
+    stack_regions[Local_uint8Region].Words = Copy_uint32Words;
+    /*the periodic check may run right after: the entry is complete before it is counted*/
+    ATOMIC_FENCE();
+    stack_region_count = Local_uint8Region + 1;
+    Critical_VoidExitBasepri(Local_uint32Saved);
+    *Copy_pRegion = Local_uint8Region;
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 SSTACK_uint32GetHighWater(uint8 Copy_uint8Region)
+* \Description     : deepest use of a stack since it was painted , in bytes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Region
+* \Parameters (out): None
+* \Return value:   : uint32 bytes used at the peak , 0 unknown region
+*******************************************************************************/
+uint32 SSTACK_uint32GetHighWater(uint8 Copy_uint8Region)
+{
+    const uint32* Local_pWord;
+    uint32 Local_uint32Untouched = 0;
+
+    if(Copy_uint8Region >= stack_region_count)
+    {
+        return 0;
+    }
+    /*scan up from the bottom: the first word without the pattern is the deepest one ever written*/
+    Local_pWord = stack_regions[Copy_uint8Region].Bottom;
+    while((Local_uint32Untouched < stack_regions[Copy_uint8Region].Words) && (*Local_pWord++ == STACK_PAINT_PATTERN))
+    {
+        Local_uint32Untouched++;
+    }
+    return (stack_regions[Copy_uint8Region].Words - Local_uint32Untouched) * 4;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 SSTACK_uint32GetSize(uint8 Copy_uint8Region)
+* \Description     : size of a monitored stack in bytes
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : uint8 Copy_uint8Region
+* \Parameters (out): None
+* \Return value:   : uint32 bytes , 0 unknown region
+*******************************************************************************/
+uint32 SSTACK_uint32GetSize(uint8 Copy_uint8Region)
+{
+    if(Copy_uint8Region >= stack_region_count)
+    {
+        return 0;
+    }
+    return stack_regions[Copy_uint8Region].Words * 4;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSTACK_Std_ReturnTypeCheck(void)
+* \Description     : verify the guard zone of every region , the overflow handler runs for each damaged one
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : OK , N_OK a guard zone was written
+*******************************************************************************/
+Std_ReturnType SSTACK_Std_ReturnTypeCheck(void)
+{
+    Std_ReturnType Local_Std_ReturnTypeState = OK;
+    const uint32* Local_pWord;
+    uint8 Local_uint8Count = stack_region_count;
+    uint8 Local_uint8Region;
+    uint8 Local_uint8Itr;
+
+    for(Local_uint8Region = 0; Local_uint8Region < Local_uint8Count; Local_uint8Region++)
+    {
+        Local_pWord = stack_regions[Local_uint8Region].Bottom;
+        for(Local_uint8Itr = 0; Local_uint8Itr < STACK_GUARD_WORDS; Local_uint8Itr++)
+        {
+            if(Local_pWord[Local_uint8Itr] != STACK_PAINT_PATTERN)
+            {
+                break;
+            }
+        }
+        if(Local_uint8Itr == STACK_GUARD_WORDS)
+        {
+            continue;
+        }
+        Local_Std_ReturnTypeState = N_OK;
+        SSTACK_uint8OverflowRegion = Local_uint8Region;
+        if(stack_overflow_handler != NULL)
+        {
+            stack_overflow_handler(Local_uint8Region);
+        }
+        else
+        {
+            /*guard zone reached: stop here for the debugger before the data below is corrupted further*/
+            while(1);
+        }
+    }
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : void SSTACK_VoidSetOverflowHandler(void (*Copy_pHandler)(uint8 Copy_uint8Region))
+* \Description     : action on a damaged guard zone (log , reset ...). without a handler the check records the
+*                    region in SSTACK_uint8OverflowRegion and stops there for the debugger
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : Copy_pHandler : NULL restores the default
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSTACK_VoidSetOverflowHandler(void (*Copy_pHandler)(uint8 Copy_uint8Region))
+{
+    stack_overflow_handler = Copy_pHandler;
+}
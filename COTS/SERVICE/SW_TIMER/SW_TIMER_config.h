@@ -0,0 +1,32 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SW_TIMER_config.h
+ *       Module:  SW_TIMER Module
+ *  Description:  Configuration header file for software timer service
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SW_TIMER_CONFIG_H
+#define _SW_TIMER_CONFIG_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*number of timers in the static pool (max 65534) , a build may set its own (e.g. the host test with 10000)*/
+#ifndef SW_TIMER_POOL_SIZE
+#define SW_TIMER_POOL_SIZE          32
+#endif
+
+/*DPC level whose interrupt advances the wheel and runs the expiry callbacks*/
+#define SW_TIMER_DPC_LEVEL          1
+
+/*most urgent NVIC group priority allowed to call the timer functions (1..15), the wheel is updated with
+  every interrupt of this priority and below masked through BASEPRI for a few instructions.
+  the DPC level above must not be more urgent than this*/
+#define SW_TIMER_LOCK_PRIORITY      1
+
+#endif
@@ -0,0 +1,140 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SW_TIMER_interface.h
+ *       Module:  SW_TIMER Module
+ *  Description:  Interface header file for software timer service.
+ *                one shot and periodic timers from a static pool on a hierarchical timing wheel driven by the
+ *                SysTick timebase: start , stop and expiry are O(1) whatever the number of timers and the
+ *                SysTick interrupt only posts a DPC, the wheel advances and the callbacks run in the
+ *                SW_TIMER_DPC_LEVEL interrupt. times are in ticks (milliseconds with MSYSTICK_VoidStartTimebase).
+ *                the service owns the SysTick callback slot.
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SW_TIMER_INTERFACE_H
+#define _SW_TIMER_INTERFACE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../LIB/Std_Types.h"
+#include "../../LIB/Bit_Math.h"
+
+#include "SW_TIMER_config.h"
+#include "SW_TIMER_private.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define SW_TIMER_INVALID_HANDLE     0xFFFF
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*index of a timer in the pool*/
+typedef uint16 SW_TIMER_Handle_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SSWTIMER_VoidInit(void)
+* \Description     : build the free pool , empty the wheel and take the SysTick callback.
+*                    call after MSYSTICK_VoidStartTimebase and SDPC_VoidInit
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSWTIMER_VoidInit(void);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeCreate(SW_TIMER_Handle_t* Copy_pHandle ,
+*                                                                  void (*Copy_pCallback)(void* Copy_pArg) , void* Copy_pArg)
+* \Description     : take a stopped timer from the pool and bind its expiry callback
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_pCallback : runs in the DPC level interrupt on expiry , void* Copy_pArg : its argument
+* \Parameters (out): SW_TIMER_Handle_t* Copy_pHandle
+* \Return value:   : OK , N_OK pool empty or NULL callback
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeCreate(SW_TIMER_Handle_t* Copy_pHandle ,
+                                             void (*Copy_pCallback)(void* Copy_pArg) , void* Copy_pArg);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeStart(SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay ,
+*                                                                 uint32 Copy_uint32Period)
+* \Description     : arm a timer to expire Copy_uint32Delay ticks from now (0: next tick), then every Copy_uint32Period
+*                    ticks without drift (0: one shot). starting an armed timer restarts it
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay , uint32 Copy_uint32Period
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid handle
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeStart(SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay , uint32 Copy_uint32Period);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeStop(SW_TIMER_Handle_t Copy_Handle)
+* \Description     : disarm a timer , its callback does not run afterwards unless it is already running
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid handle
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeStop(SW_TIMER_Handle_t Copy_Handle);
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeDelete(SW_TIMER_Handle_t Copy_Handle)
+* \Description     : stop a timer and give it back to the pool , the handle becomes invalid
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid handle
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeDelete(SW_TIMER_Handle_t Copy_Handle);
+
+/******************************************************************************
+* \Syntax          : uint8 SSWTIMER_uint8IsActive(SW_TIMER_Handle_t Copy_Handle)
+* \Description     : armed state of a timer (a one shot timer is disarmed right before its callback runs)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle
+* \Parameters (out): None
+* \Return value:   : 1 armed , 0 stopped or invalid handle
+*******************************************************************************/
+uint8 SSWTIMER_uint8IsActive(SW_TIMER_Handle_t Copy_Handle);
+
+/******************************************************************************
+* \Syntax          : uint32 SSWTIMER_uint32GetIdleTicks(void)
+* \Description     : ticks from now until the wheel has work (an expiry or a cascade of an occupied slot)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 ticks , 0 work due now , 0xFFFFFFFF no timer armed
+*******************************************************************************/
+uint32 SSWTIMER_uint32GetIdleTicks(void);
+
+/******************************************************************************
+* \Syntax          : void SSWTIMER_VoidIdle(void)
+* \Description     : tickless idle for the main loop once it has nothing to do: sleep with SysTick stretched to the
+*                    next wheel event (up to the SysTick range when no timer is armed) , returns after any interrupt.
+*                    the decision and the sleep are atomic (PRIMASK) so a timer started by an interrupt in between
+*                    is never overslept
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSWTIMER_VoidIdle(void);
+
+#endif
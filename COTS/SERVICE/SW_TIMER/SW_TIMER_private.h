@@ -0,0 +1,58 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SW_TIMER_private.h
+ *       Module:  SW_TIMER Module
+ *  Description:  Private header file for software timer service
+---------------------------------------------------------------------------------------------------------------------*/
+#ifndef _SW_TIMER_PRIVATE_H
+#define _SW_TIMER_PRIVATE_H
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*4 levels of 64 slots: level n slot covers 64^n ticks , the wheel spans 2^24 ticks (4.6 hours at 1 kHZ),
+  longer timers wait in the last slot of the top level and are placed again when it cascades*/
+#define SW_TIMER_SLOT_BITS          6
+#define SW_TIMER_SLOTS              (1UL << SW_TIMER_SLOT_BITS)
+#define SW_TIMER_SLOT_MASK          (SW_TIMER_SLOTS - 1)
+#define SW_TIMER_LEVELS             4
+#define SW_TIMER_RANGE              (1UL << (SW_TIMER_SLOT_BITS * SW_TIMER_LEVELS))
+
+/*slot of an expiry tick on a level*/
+#define SW_TIMER_SLOT(TICK,LEVEL)   ((uint8)(((TICK) >> (SW_TIMER_SLOT_BITS * (LEVEL))) & SW_TIMER_SLOT_MASK))
+
+#define SW_TIMER_STATE_FREE         0
+#define SW_TIMER_STATE_IDLE         1
+#define SW_TIMER_STATE_ARMED        2
+
+#if (SW_TIMER_POOL_SIZE < 1) || (SW_TIMER_POOL_SIZE > 65534)
+#error "SW_TIMER_POOL_SIZE must be 1..65534"
+#endif
+
+#if (SW_TIMER_LOCK_PRIORITY < 1) || (SW_TIMER_LOCK_PRIORITY > 15)
+#error "SW_TIMER_LOCK_PRIORITY must be 1..15 (BASEPRI 0 masks nothing)"
+#endif
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+typedef struct SW_Timer
+{
+    struct SW_Timer* Next;              /*slot list while armed , free list while free*/
+    struct SW_Timer* Prev;
+    uint64 Expiry;                      /*absolute tick*/
+    uint32 Period;                      /*0: one shot*/
+    void (*Callback)(void* Copy_pArg);
+    void* Arg;
+    uint8 Level;
+    uint8 Slot;
+    uint8 State;
+}SW_Timer_t;
+
+#endif
@@ -0,0 +1,563 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SW_TIMER_program.c
+ *       Module:  SW_TIMER Module
+ *  Description:  implementaion C file for software timer service
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include "../../MCAL/SYSTick/SYSTick_interface.h"
+#include "../../MCAL/NVIC/NVIC_Interface.h"
+#include "../../LIB/Atomic.h"
+#include "../DPC/DPC_interface.h"
+#include "SW_TIMER_interface.h"
+
+/*BASEPRI value masking SW_TIMER_LOCK_PRIORITY and every less urgent interrupt*/
+#define SW_TIMER_LOCK_THRESHOLD     NVIC_ENCODE_PRIORITY(NVIC_PRIORITY_GROUPING,SW_TIMER_LOCK_PRIORITY,0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static SW_Timer_t SWTimer_Pool[SW_TIMER_POOL_SIZE];
+static SW_Timer_t* SWTimer_FreeList = NULL;
+
+/*slot lists of every level and one occupancy bit per slot*/
+static SW_Timer_t* SWTimer_Wheel[SW_TIMER_LEVELS][SW_TIMER_SLOTS];
+static uint32 SWTimer_Occupied[SW_TIMER_LEVELS][SW_TIMER_SLOTS / 32];
+
+/*last tick the wheel has processed , written under the lock only*/
+static volatile uint64 SWTimer_WheelTick = 0;
+static volatile uint32 SWTimer_ArmedCount = 0;
+
+static DPC_Item_t SWTimer_TickItem;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*put an armed timer in the slot of its expiry relative to the wheel tick (lock held).
+  Copy_uint8DueNow: a timer due at the wheel tick joins the slot being expired (cascade) instead of the next one*/
+static void SSWTIMER_VoidLink(SW_Timer_t* Copy_pTimer , uint8 Copy_uint8DueNow)
+{
+    uint64 Local_uint64Expiry = Copy_pTimer->Expiry;
+    uint32 Local_uint32Delta;
+    uint8 Local_uint8Level = 0;
+    uint8 Local_uint8Slot;
+
+    if((Local_uint64Expiry == SWTimer_WheelTick) && (Copy_uint8DueNow == 1))
+    {
+        /*delta 0 , level 0 slot of the current tick*/
+    }
+    else if(Local_uint64Expiry <= SWTimer_WheelTick)
+    {
+        /*already due: the next tick*/
+        Local_uint64Expiry = SWTimer_WheelTick + 1;
+    }
+    else if((Local_uint64Expiry - SWTimer_WheelTick) >= SW_TIMER_RANGE)
+    {
+        /*beyond the wheel: last slot of the top level , placed again on its cascade*/
+        Local_uint64Expiry = SWTimer_WheelTick + SW_TIMER_RANGE - 1;
+    }
+    Local_uint32Delta = (uint32)(Local_uint64Expiry - SWTimer_WheelTick);
+    while(Local_uint32Delta >= (1UL << (SW_TIMER_SLOT_BITS * (Local_uint8Level + 1))))
+    {
+        Local_uint8Level++;
+    }
+    /*the wheel spans 2^24 ticks: the low word of the expiry selects the slot*/
+    Local_uint8Slot = SW_TIMER_SLOT((uint32)Local_uint64Expiry,Local_uint8Level);
+
+    Copy_pTimer->Level = Local_uint8Level;
+    Copy_pTimer->Slot = Local_uint8Slot;
+    Copy_pTimer->Prev = NULL;
+    Copy_pTimer->Next = SWTimer_Wheel[Local_uint8Level][Local_uint8Slot];
+    if(Copy_pTimer->Next != NULL)
+    {
+        Copy_pTimer->Next->Prev = Copy_pTimer;
+    }
+    SWTimer_Wheel[Local_uint8Level][Local_uint8Slot] = Copy_pTimer;
+    SWTimer_Occupied[Local_uint8Level][Local_uint8Slot >> 5] |= (1UL << (Local_uint8Slot & 31));
+}
+
+/*take an armed timer out of its slot (lock held)*/
+static void SSWTIMER_VoidUnlink(SW_Timer_t* Copy_pTimer)
+{
+    if(Copy_pTimer->Prev != NULL)
+    {
+        Copy_pTimer->Prev->Next = Copy_pTimer->Next;
+    }
+    else
+    {
+        SWTimer_Wheel[Copy_pTimer->Level][Copy_pTimer->Slot] = Copy_pTimer->Next;
+        if(Copy_pTimer->Next == NULL)
+        {
+            SWTimer_Occupied[Copy_pTimer->Level][Copy_pTimer->Slot >> 5] &= ~(1UL << (Copy_pTimer->Slot & 31));
+        }
+    }
+    if(Copy_pTimer->Next != NULL)
+    {
+        Copy_pTimer->Next->Prev = Copy_pTimer->Prev;
+    }
+}
+
+static uint8 SSWTIMER_uint8SlotOccupied(uint8 Copy_uint8Level , uint8 Copy_uint8Slot)
+{
+    return (uint8)READ_BIT(SWTimer_Occupied[Copy_uint8Level][Copy_uint8Slot >> 5],Copy_uint8Slot & 31);
+}
+
+static SW_Timer_t* SSWTIMER_pGetTimer(SW_TIMER_Handle_t Copy_Handle)
+{
+    if((Copy_Handle >= SW_TIMER_POOL_SIZE) || (SWTimer_Pool[Copy_Handle].State == SW_TIMER_STATE_FREE))
+    {
+        return NULL;
+    }
+    return &SWTimer_Pool[Copy_Handle];
+}
+
+/*steps (1..64) from the current slot of a level to its next occupied slot , 0 when the level is empty*/
+static uint8 SSWTIMER_uint8NextSlot(uint8 Copy_uint8Level , uint8 Copy_uint8Current)
+{
+    uint8 Local_uint8Start = (uint8)((Copy_uint8Current + 1) & SW_TIMER_SLOT_MASK);
+    uint8 Local_uint8Word = Local_uint8Start >> 5;
+    uint32 Local_uint32Bits = SWTimer_Occupied[Copy_uint8Level][Local_uint8Word] & (0xFFFFFFFFUL << (Local_uint8Start & 31));
+    uint8 Local_uint8Slot;
+
+    if(Local_uint32Bits == 0)
+    {
+        Local_uint8Word ^= 1;
+        Local_uint32Bits = SWTimer_Occupied[Copy_uint8Level][Local_uint8Word];
+        if(Local_uint32Bits == 0)
+        {
+            /*wrapped back to the start word: the slots below the start*/
+            Local_uint8Word ^= 1;
+            Local_uint32Bits = SWTimer_Occupied[Copy_uint8Level][Local_uint8Word] & ~(0xFFFFFFFFUL << (Local_uint8Start & 31));
+            if(Local_uint32Bits == 0)
+            {
+                return 0;
+            }
+        }
+    }
+    Local_uint8Slot = (uint8)((Local_uint8Word << 5) + __builtin_ctzl(Local_uint32Bits));
+    return (uint8)(((Local_uint8Slot - Copy_uint8Current - 1) & SW_TIMER_SLOT_MASK) + 1);
+}
+
+/*ticks from the wheel tick to the next tick that expires or cascades an occupied slot , 0 for an empty wheel.
+  four bitmap scans whatever the number of timers (lock held)*/
+static uint32 SSWTIMER_uint32TicksToNextEvent(void)
+{
+    uint32 Local_uint32Tick = (uint32)SWTimer_WheelTick;
+    uint32 Local_uint32Best = 0;
+    uint32 Local_uint32Delta;
+    uint8 Local_uint8Level;
+    uint8 Local_uint8Shift;
+    uint8 Local_uint8Steps;
+
+    for(Local_uint8Level = 0; Local_uint8Level < SW_TIMER_LEVELS; Local_uint8Level++)
+    {
+        Local_uint8Steps = SSWTIMER_uint8NextSlot(Local_uint8Level,SW_TIMER_SLOT(Local_uint32Tick,Local_uint8Level));
+        if(Local_uint8Steps == 0)
+        {
+            continue;
+        }
+        /*a level n slot is reached when the tick enters its 64^n block*/
+        Local_uint8Shift = SW_TIMER_SLOT_BITS * Local_uint8Level;
+        Local_uint32Delta = (((Local_uint32Tick >> Local_uint8Shift) + Local_uint8Steps) << Local_uint8Shift) - Local_uint32Tick;
+        if((Local_uint32Best == 0) || (Local_uint32Delta < Local_uint32Best))
+        {
+            Local_uint32Best = Local_uint32Delta;
+        }
+    }
+    return Local_uint32Best;
+}
+
+/*move the timers of a higher level slot down to the levels of their remaining time.
+  one timer per lock so a long slot never holds the interrupts off , stops at once if a start
+  resynchronized the wheel in between (Copy_uint32Tick no longer current)*/
+static void SSWTIMER_VoidCascade(uint8 Copy_uint8Level , uint8 Copy_uint8Slot , uint32 Copy_uint32Tick)
+{
+    SW_Timer_t* Local_pTimer;
+    uint32 Local_uint32Saved;
+
+    for(;;)
+    {
+        Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+        Local_pTimer = SWTimer_Wheel[Copy_uint8Level][Copy_uint8Slot];
+        if((Local_pTimer == NULL) || ((uint32)SWTimer_WheelTick != Copy_uint32Tick))
+        {
+            Critical_VoidExitBasepri(Local_uint32Saved);
+            break;
+        }
+        SSWTIMER_VoidUnlink(Local_pTimer);
+        SSWTIMER_VoidLink(Local_pTimer,1);
+        Critical_VoidExitBasepri(Local_uint32Saved);
+    }
+}
+
+/*run every timer of the current level 0 slot , periodic ones are armed again before their callback*/
+static void SSWTIMER_VoidExpire(uint8 Copy_uint8Slot , uint32 Copy_uint32Tick)
+{
+    SW_Timer_t* Local_pTimer;
+    void (*Local_pCallback)(void* Copy_pArg);
+    void* Local_pArg;
+    uint32 Local_uint32Saved;
+
+    for(;;)
+    {
+        Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+        Local_pTimer = SWTimer_Wheel[0][Copy_uint8Slot];
+        if((Local_pTimer == NULL) || ((uint32)SWTimer_WheelTick != Copy_uint32Tick))
+        {
+            Critical_VoidExitBasepri(Local_uint32Saved);
+            break;
+        }
+        SSWTIMER_VoidUnlink(Local_pTimer);
+        if(Local_pTimer->Period != 0)
+        {
+            /*from the due tick , not from now: no drift*/
+            Local_pTimer->Expiry += Local_pTimer->Period;
+            SSWTIMER_VoidLink(Local_pTimer,0);
+        }
+        else
+        {
+            Local_pTimer->State = SW_TIMER_STATE_IDLE;
+            SWTimer_ArmedCount--;
+        }
+        /*copied under the lock: the timer may be restarted or deleted once it is released*/
+        Local_pCallback = Local_pTimer->Callback;
+        Local_pArg = Local_pTimer->Arg;
+        Critical_VoidExitBasepri(Local_uint32Saved);
+
+        Local_pCallback(Local_pArg);
+    }
+}
+
+/*DPC: advance the wheel up to the timebase , jumping from one occupied slot to the next so the work is constant
+  per event (plus the timers it moves) however many ticks passed , e.g. after a tickless sleep*/
+static void SSWTIMER_VoidProcess(void* Copy_pArg)
+{
+    uint64 Local_uint64Now = MSYSTICK_uint64GetTickCount();
+    uint32 Local_uint32Tick;
+    uint32 Local_uint32Next;
+    uint32 Local_uint32Saved;
+    uint8 Local_uint8Level;
+    uint8 Local_uint8Slot;
+
+    (void)Copy_pArg;
+    for(;;)
+    {
+        Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+        if(SWTimer_ArmedCount == 0)
+        {
+            /*empty wheel: jump instead of stepping through the idle ticks*/
+            SWTimer_WheelTick = Local_uint64Now;
+        }
+        if(SWTimer_WheelTick >= Local_uint64Now)
+        {
+            Critical_VoidExitBasepri(Local_uint32Saved);
+            break;
+        }
+        Local_uint32Next = SSWTIMER_uint32TicksToNextEvent();
+        if((Local_uint32Next == 0) || ((Local_uint64Now - SWTimer_WheelTick) < Local_uint32Next))
+        {
+            /*nothing happens up to now: the skipped ticks only held empty slots*/
+            SWTimer_WheelTick = Local_uint64Now;
+            Critical_VoidExitBasepri(Local_uint32Saved);
+            break;
+        }
+        SWTimer_WheelTick += Local_uint32Next;
+        Local_uint32Tick = (uint32)SWTimer_WheelTick;
+        Critical_VoidExitBasepri(Local_uint32Saved);
+
+        /*a level n slot is emptied when the slots of all lower levels wrap to 0*/
+        for(Local_uint8Level = 1; Local_uint8Level < SW_TIMER_LEVELS; Local_uint8Level++)
+        {
+            if(SW_TIMER_SLOT(Local_uint32Tick,Local_uint8Level - 1) != 0)
+            {
+                break;
+            }
+            Local_uint8Slot = SW_TIMER_SLOT(Local_uint32Tick,Local_uint8Level);
+            if(SSWTIMER_uint8SlotOccupied(Local_uint8Level,Local_uint8Slot))
+            {
+                SSWTIMER_VoidCascade(Local_uint8Level,Local_uint8Slot,Local_uint32Tick);
+            }
+        }
+        Local_uint8Slot = SW_TIMER_SLOT(Local_uint32Tick,0);
+        if(SSWTIMER_uint8SlotOccupied(0,Local_uint8Slot))
+        {
+            SSWTIMER_VoidExpire(Local_uint8Slot,Local_uint32Tick);
+        }
+    }
+}
+
+/*SysTick callback: only hand the work to the DPC level while a timer is armed*/
+static void SSWTIMER_VoidTick(void)
+{
+    if(SWTimer_ArmedCount != 0)
+    {
+        (void)SDPC_Std_ReturnTypePost(SW_TIMER_DPC_LEVEL,&SWTimer_TickItem);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+/******************************************************************************
+* \Syntax          : void SSWTIMER_VoidInit(void)
+* \Description     : build the free pool , empty the wheel and take the SysTick callback.
+*                    call after MSYSTICK_VoidStartTimebase and SDPC_VoidInit
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSWTIMER_VoidInit(void)
+{
+    uint32 Local_uint32Itr;
+    uint8 Local_uint8Level;
+
+    SWTimer_FreeList = NULL;
+    for(Local_uint32Itr = SW_TIMER_POOL_SIZE; Local_uint32Itr > 0; Local_uint32Itr--)
+    {
+        SWTimer_Pool[Local_uint32Itr - 1].State = SW_TIMER_STATE_FREE;
+        SWTimer_Pool[Local_uint32Itr - 1].Next = SWTimer_FreeList;
+        SWTimer_FreeList = &SWTimer_Pool[Local_uint32Itr - 1];
+    }
+    for(Local_uint8Level = 0; Local_uint8Level < SW_TIMER_LEVELS; Local_uint8Level++)
+    {
+        for(Local_uint32Itr = 0; Local_uint32Itr < SW_TIMER_SLOTS; Local_uint32Itr++)
+        {
+            SWTimer_Wheel[Local_uint8Level][Local_uint32Itr] = NULL;
+        }
+        for(Local_uint32Itr = 0; Local_uint32Itr < (SW_TIMER_SLOTS / 32); Local_uint32Itr++)
+        {
+            SWTimer_Occupied[Local_uint8Level][Local_uint32Itr] = 0;
+        }
+    }
+    SWTimer_ArmedCount = 0;
+    SWTimer_WheelTick = MSYSTICK_uint64GetTickCount();
+
+    SDPC_VoidInitItem(&SWTimer_TickItem,SSWTIMER_VoidProcess,NULL);
+    MSYSTICK_VoidSetCallBack(SSWTIMER_VoidTick);
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeCreate(SW_TIMER_Handle_t* Copy_pHandle ,
+*                                                                  void (*Copy_pCallback)(void* Copy_pArg) , void* Copy_pArg)
+* \Description     : take a stopped timer from the pool and bind its expiry callback
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : Copy_pCallback : runs in the DPC level interrupt on expiry , void* Copy_pArg : its argument
+* \Parameters (out): SW_TIMER_Handle_t* Copy_pHandle
+* \Return value:   : OK , N_OK pool empty or NULL callback
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeCreate(SW_TIMER_Handle_t* Copy_pHandle ,
+                                             void (*Copy_pCallback)(void* Copy_pArg) , void* Copy_pArg)
+{
+    SW_Timer_t* Local_pTimer;
+    uint32 Local_uint32Saved;
+
+    *Copy_pHandle = SW_TIMER_INVALID_HANDLE;
+    if(Copy_pCallback == NULL)
+    {
+        return N_OK;
+    }
+    Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+    Local_pTimer = SWTimer_FreeList;
+    if(Local_pTimer != NULL)
+    {
+        SWTimer_FreeList = Local_pTimer->Next;
+        Local_pTimer->Callback = Copy_pCallback;
+        Local_pTimer->Arg = Copy_pArg;
+        Local_pTimer->Period = 0;
+        Local_pTimer->State = SW_TIMER_STATE_IDLE;
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    if(Local_pTimer == NULL)
+    {
+        return N_OK;
+    }
+    *Copy_pHandle = (SW_TIMER_Handle_t)(Local_pTimer - SWTimer_Pool);
+    return OK;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeStart(SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay ,
+*                                                                 uint32 Copy_uint32Period)
+* \Description     : arm a timer to expire Copy_uint32Delay ticks from now (0: next tick), then every Copy_uint32Period
+*                    ticks without drift (0: one shot). starting an armed timer restarts it
+* \Sync\Async      : Asynchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay , uint32 Copy_uint32Period
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid handle
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeStart(SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay , uint32 Copy_uint32Period)
+{
+    SW_Timer_t* Local_pTimer;
+    uint64 Local_uint64Now = MSYSTICK_uint64GetTickCount();
+    uint32 Local_uint32Saved;
+    Std_ReturnType Local_Std_ReturnTypeState = N_OK;
+
+    Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+    Local_pTimer = SSWTIMER_pGetTimer(Copy_Handle);
+    if(Local_pTimer != NULL)
+    {
+        if(Local_pTimer->State == SW_TIMER_STATE_ARMED)
+        {
+            SSWTIMER_VoidUnlink(Local_pTimer);
+        }
+        else
+        {
+            if(SWTimer_ArmedCount == 0)
+            {
+                /*the wheel stood still while empty: bring it to now so the timer is placed on a short level*/
+                SWTimer_WheelTick = Local_uint64Now;
+            }
+            Local_pTimer->State = SW_TIMER_STATE_ARMED;
+            SWTimer_ArmedCount++;
+        }
+        /*delay 0 is the next tick: stored as such , the periods count from the tick it really runs at*/
+        Local_pTimer->Expiry = Local_uint64Now + ((Copy_uint32Delay == 0) ? 1 : Copy_uint32Delay);
+        Local_pTimer->Period = Copy_uint32Period;
+        SSWTIMER_VoidLink(Local_pTimer,0);
+        Local_Std_ReturnTypeState = OK;
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeStop(SW_TIMER_Handle_t Copy_Handle)
+* \Description     : disarm a timer , its callback does not run afterwards unless it is already running
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid handle
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeStop(SW_TIMER_Handle_t Copy_Handle)
+{
+    SW_Timer_t* Local_pTimer;
+    uint32 Local_uint32Saved;
+    Std_ReturnType Local_Std_ReturnTypeState = N_OK;
+
+    Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+    Local_pTimer = SSWTIMER_pGetTimer(Copy_Handle);
+    if(Local_pTimer != NULL)
+    {
+        if(Local_pTimer->State == SW_TIMER_STATE_ARMED)
+        {
+            SSWTIMER_VoidUnlink(Local_pTimer);
+            Local_pTimer->State = SW_TIMER_STATE_IDLE;
+            SWTimer_ArmedCount--;
+        }
+        Local_Std_ReturnTypeState = OK;
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : Std_ReturnType SSWTIMER_Std_ReturnTypeDelete(SW_TIMER_Handle_t Copy_Handle)
+* \Description     : stop a timer and give it back to the pool , the handle becomes invalid
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle
+* \Parameters (out): None
+* \Return value:   : OK , N_OK invalid handle
+*******************************************************************************/
+Std_ReturnType SSWTIMER_Std_ReturnTypeDelete(SW_TIMER_Handle_t Copy_Handle)
+{
+    SW_Timer_t* Local_pTimer;
+    uint32 Local_uint32Saved;
+    Std_ReturnType Local_Std_ReturnTypeState = N_OK;
+
+    Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+    Local_pTimer = SSWTIMER_pGetTimer(Copy_Handle);
+    if(Local_pTimer != NULL)
+    {
+        if(Local_pTimer->State == SW_TIMER_STATE_ARMED)
+        {
+            SSWTIMER_VoidUnlink(Local_pTimer);
+            SWTimer_ArmedCount--;
+        }
+        Local_pTimer->State = SW_TIMER_STATE_FREE;
+        Local_pTimer->Next = SWTimer_FreeList;
+        SWTimer_FreeList = Local_pTimer;
+        Local_Std_ReturnTypeState = OK;
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    return Local_Std_ReturnTypeState;
+}
+
+/******************************************************************************
+* \Syntax          : uint8 SSWTIMER_uint8IsActive(SW_TIMER_Handle_t Copy_Handle)
+* \Description     : armed state of a timer (a one shot timer is disarmed right before its callback runs)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : SW_TIMER_Handle_t Copy_Handle
+* \Parameters (out): None
+* \Return value:   : 1 armed , 0 stopped or invalid handle
+*******************************************************************************/
+uint8 SSWTIMER_uint8IsActive(SW_TIMER_Handle_t Copy_Handle)
+{
+    return ((Copy_Handle < SW_TIMER_POOL_SIZE) && (SWTimer_Pool[Copy_Handle].State == SW_TIMER_STATE_ARMED)) ? 1 : 0;
+}
+
+/******************************************************************************
+* \Syntax          : uint32 SSWTIMER_uint32GetIdleTicks(void)
+* \Description     : ticks from now until the wheel has work (an expiry or a cascade of an occupied slot)
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : uint32 ticks , 0 work due now , 0xFFFFFFFF no timer armed
+*******************************************************************************/
+uint32 SSWTIMER_uint32GetIdleTicks(void)
+{
+    uint64 Local_uint64Now = MSYSTICK_uint64GetTickCount();
+    uint64 Local_uint64Next;
+    uint32 Local_uint32Saved;
+    uint32 Local_uint32Ticks = 0xFFFFFFFFUL;
+
+    Local_uint32Saved = Critical_uint32EnterBasepri(SW_TIMER_LOCK_THRESHOLD);
+    if(SWTimer_ArmedCount != 0)
+    {
+        Local_uint64Next = SWTimer_WheelTick + SSWTIMER_uint32TicksToNextEvent();
+        Local_uint32Ticks = (Local_uint64Next > Local_uint64Now) ? (uint32)(Local_uint64Next - Local_uint64Now) : 0;
+    }
+    Critical_VoidExitBasepri(Local_uint32Saved);
+
+    return Local_uint32Ticks;
+}
+
+/******************************************************************************
+* \Syntax          : void SSWTIMER_VoidIdle(void)
+* \Description     : tickless idle for the main loop once it has nothing to do: sleep with SysTick stretched to the
+*                    next wheel event (up to the SysTick range when no timer is armed) , returns after any interrupt.
+*                    the decision and the sleep are atomic (PRIMASK) so a timer started by an interrupt in between
+*                    is never overslept
+* \Sync\Async      : Synchronous
+* \Reentrancy      : Non Reentrant
+* \Parameters (in) : None
+* \Parameters (out): None
+* \Return value:   : None
+*******************************************************************************/
+void SSWTIMER_VoidIdle(void)
+{
+    uint32 Local_uint32Saved = Critical_uint32EnterAll();
+
+    MSYSTICK_VoidSleepTicks(SSWTIMER_uint32GetIdleTicks());
+    Critical_VoidExitAll(Local_uint32Saved);
+}
@@ -1,19 +1,54 @@
 #include "COTS/MCAL/RCC/RCC_interface.h"
 #include "COTS/MCAL/GPIO/GPIO_interface.h"
+#include "COTS/MCAL/NVIC/NVIC_Interface.h"
+#include "COTS/MCAL/SYSTick/SYSTick_interface.h"
+#include "COTS/MCAL/UART/UART_interface.h"
+#include "COTS/SERVICE/DPC/DPC_interface.h"
+#include "COTS/SERVICE/SW_TIMER/SW_TIMER_interface.h"
+#include "COTS/SERVICE/SCHED/SCHED_interface.h"
+#include "COTS/SERVICE/FAULT/FAULT_interface.h"
 
-int main(void)
+#define APP_BLINK_TASK      10
+#define APP_EVENT_TOGGLE    0x01
+
+/*timer callback (DPC level): only hand the work to the task*/
+static void Blink(void* Copy_pArg)
 {
-    MRCC_voidInitSysClock();
-    MRCC_voidEnableClock(RCC_APB2,PERIPHERAL_EN_IOPA);
-    MGPIO_VoidSetPinMode_TYPE(_GPIOA_PORT,pin0,OUTPUT_SPEED_10MHZ_PUSHPULL);
-    unsigned int c=0;
-        
-    while (1)
+    (void)Copy_pArg;
+    SSCHED_Std_ReturnTypePostEvent(APP_BLINK_TASK,APP_EVENT_TOGGLE);
+}
+
+void App_VoidBlinkTask(uint32 Copy_uint32Events)
+{
+    if(Copy_uint32Events & APP_EVENT_TOGGLE)
     {
         MGPIO_VoidTogglePinValue(_GPIOA_PORT,pin0);
-        while (c++<10000);
-        c=0;
     }
-    
+}
+
+int main(void)
+{
+    SW_TIMER_Handle_t Local_BlinkTimer;
+
+    SFAULT_VoidInit();
+    MRCC_Std_ReturnTypeInitSysClock();
+    MRCC_VoidInitClocks();
+    MGPIO_VoidSetPinMode_TYPE(_GPIOA_PORT,pin0,OUTPUT_SPEED_10MHZ_PUSHPULL);
+
+    MNVIC_VoidInitPriorities();
+    MSYSTICK_VoidStartTimebase();
+    /*faults captured before the last reset*/
+    MUSART1_voidInit();
+    MUSART1_voidEnable();
+    (void)SFAULT_uint8Report(MUSART1_voidSendData);
+    SDPC_VoidInit();
+    SSWTIMER_VoidInit();
+    SSCHED_Std_ReturnTypeInit();
+    SSWTIMER_Std_ReturnTypeCreate(&Local_BlinkTimer,Blink,NULL);
+    SSWTIMER_Std_ReturnTypeStart(Local_BlinkTimer,500,500);
+
+    /*runs the ready tasks , sleeps tickless until the next timer otherwise*/
+    SSCHED_VoidRun();
+
     return 0;
 }
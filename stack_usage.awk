@@ -0,0 +1,102 @@
+# stack_usage.awk "Hossam Ahmed"
+# worst case stack per call chain from the gcc call graph files (-fstack-usage -fcallgraph-info=su):
+#   awk -f stack_usage.awk *.ci | sort -nr
+# one line per root (function no other function calls: main , handlers , callbacks):
+#   <bytes> <root> > <callee> > ...  [flags]
+# flags: recursion (cycle cut) , indirect (a call through a pointer is not counted) ,
+#        unknown (callee without stack information , e.g. a library function) , dynamic (alloca / VLA)
+# interrupts add their own chains on top of the interrupted one (8 words of exception frame per nested level)
+
+/^node:/ {
+	title = field($0, "title")
+	label = field($0, "label")
+	if (match(label, /[0-9]+ bytes/)) {
+		bytes = substr(label, RSTART, RLENGTH) + 0
+		if (!(title in size) || bytes > size[title])
+			size[title] = bytes
+		if (label ~ /dynamic/)
+			dynamic[title] = 1
+	}
+	name[title] = label
+	sub(/\\n.*/, "", name[title])
+}
+
+/^edge:/ {
+	from = field($0, "sourcename")
+	to = field($0, "targetname")
+	if (!((from, to) in edge)) {
+		edge[from, to] = 1
+		calls[from] = calls[from] SUBSEP to
+		called[to] = 1
+	}
+}
+
+# value of key: "..." on a VCG line
+function field(line, key,    start, rest) {
+	start = index(line, key ": \"")
+	if (start == 0)
+		return ""
+	rest = substr(line, start + length(key) + 3)
+	return substr(rest, 1, index(rest, "\"") - 1)
+}
+
+# worst stack below node n , its chain in path[n] and its flags in flags[n]
+function worst(n,    list, count, i, c, w, best, bestc) {
+	if (n in done)
+		return total[n]
+	if (visiting[n]) {
+		recursive[n] = 1
+		return 0
+	}
+	visiting[n] = 1
+	best = 0
+	bestc = ""
+	flags[n] = ""
+	count = split(calls[n], list, SUBSEP)
+	for (i = 2; i <= count; i++) {
+		c = list[i]
+		if (c == "__indirect_call") {
+			flags[n] = flags[n] " indirect"
+			continue
+		}
+		if (!(c in size))
+			flags[n] = flags[n] " unknown"
+		w = worst(c)
+		flags[n] = flags[n] flags[c]
+		if (w > best || bestc == "") {
+			best = w
+			bestc = c
+		}
+	}
+	if (n in recursive)
+		flags[n] = flags[n] " recursion"
+	if (n in dynamic)
+		flags[n] = flags[n] " dynamic"
+	total[n] = size[n] + best
+	path[n] = name[n] ((bestc == "") ? "" : " > " path[bestc])
+	visiting[n] = 0
+	done[n] = 1
+	return total[n]
+}
+
+# keep each flag once
+function uniq(s,    list, count, i, seen, out) {
+	count = split(s, list, " ")
+	out = ""
+	for (i = 1; i <= count; i++) {
+		if (!(list[i] in seen)) {
+			seen[list[i]] = 1
+			out = out " " list[i]
+		}
+	}
+	return (out == "") ? "" : "  [" substr(out, 2) "]"
+}
+
+END {
+	for (n in size) {
+		if (n in called)
+			continue
+		w = worst(n)
+		print w, path[n] uniq(flags[n])
+	}
+}
@@ -1,50 +1,270 @@
-// startup.c  
+// startup.c
 #include "COTS/LIB/Std_Types.h"
+#include "COTS/MCAL/NVIC/NVIC_Interface.h"
+#include "COTS/MCAL/DWT/DWT_interface.h"
+#include "COTS/SERVICE/STACK/STACK_interface.h"
+
+int main(void);
 void Rest_Handler() ;
+
+/* vector table position of an IRQ */
+#define IRQ_VECTOR(IRQ)		(16 + (IRQ))
+
+/* exception number (IPSR) of the last unhandled interrupt, IRQ number = value - 16 */
+volatile uint32 Default_uint32Vector;
+
 void Default_Handler(){
-	Rest_Handler();
+	uint32 Local_uint32Ipsr;
+	__asm__ volatile ("mrs %0, ipsr" : "=r" (Local_uint32Ipsr));
+	Default_uint32Vector = Local_uint32Ipsr;
+	/* interrupt enabled without a handler: stop here for the debugger */
+	while(1);
 }
+
+/* system exceptions */
 void NMI_Handler() __attribute__((weak,alias("Default_Handler")));
 void H_fault_Handler() __attribute__((weak,alias("Default_Handler")));
 void MM_Fault_Handler() __attribute__((weak,alias("Default_Handler")));
 void Bus_Fault() __attribute__((weak,alias("Default_Handler")));
 void Usage_Fault_Handler() __attribute__((weak,alias("Default_Handler")));
+void SVC_Handler() __attribute__((weak,alias("Default_Handler")));
+void DebugMon_Handler() __attribute__((weak,alias("Default_Handler")));
+void PendSV_Handler() __attribute__((weak,alias("Default_Handler")));
+void SysTick_Handler() __attribute__((weak,alias("Default_Handler")));
+
+/* peripheral interrupts, a driver overrides one by defining a function with the same name */
+void WWDG_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void PVD_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TAMPER_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void RTC_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void FLASH_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void RCC_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI0_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI1_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI4_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel1_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel4_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel5_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel6_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA1_Channel7_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void ADC1_2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void USB_HP_CAN_TX_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void USB_LP_CAN_RX0_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void CAN_RX1_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void CAN_SCE_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI9_5_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM1_BRK_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM1_UP_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM1_TRG_COM_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM1_CC_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM4_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void I2C1_EV_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void I2C1_ER_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void I2C2_EV_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void I2C2_ER_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void SPI1_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void SPI2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void USART1_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void USART2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void USART3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void EXTI15_10_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void RTCAlarm_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void USBWakeUp_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM8_BRK_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM8_UP_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM8_TRG_COM_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM8_CC_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void ADC3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void FSMC_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void SDIO_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM5_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void SPI3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void UART4_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void UART5_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM6_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void TIM7_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA2_Channel1_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA2_Channel2_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA2_Channel3_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+void DMA2_Channel4_5_IRQHandler() __attribute__((weak,alias("Default_Handler")));
+
 extern uint32 _stak_top;
-uint32 vectors[] __attribute__((section(".vectors")))={
-	(uint32) &_stak_top, 
-	(uint32) &Rest_Handler,
-	(uint32) &NMI_Handler,
-	(uint32) &H_fault_Handler ,
-	(uint32) &MM_Fault_Handler,
-	(uint32) &Bus_Fault ,
-	(uint32) &Usage_Fault_Handler
+
+/* every IRQ entry is placed by its NVIC_InterruptType_t value, so the table and the NVIC driver can not drift apart */
+void (* const vectors[])(void) __attribute__((section(".vectors")))={
+	[0]  = (void (*)(void)) &_stak_top,
+	[1]  = Rest_Handler,
+	[2]  = NMI_Handler,
+	[3]  = H_fault_Handler,
+	[4]  = MM_Fault_Handler,
+	[5]  = Bus_Fault,
+	[6]  = Usage_Fault_Handler,
+	/* 7..10 reserved */
+	[11] = SVC_Handler,
+	[12] = DebugMon_Handler,
+	/* 13 reserved */
+	[14] = PendSV_Handler,
+	[15] = SysTick_Handler,
+
+	[IRQ_VECTOR(WWDG)]            = WWDG_IRQHandler,
+	[IRQ_VECTOR(EXTI16)]          = PVD_IRQHandler,
+	[IRQ_VECTOR(EXTI21)]          = TAMPER_IRQHandler,
+	[IRQ_VECTOR(EXTI22)]          = RTC_IRQHandler,
+	[IRQ_VECTOR(FLASH)]           = FLASH_IRQHandler,
+	[IRQ_VECTOR(RCC_INT)]         = RCC_IRQHandler,
+	[IRQ_VECTOR(EXTI0)]           = EXTI0_IRQHandler,
+	[IRQ_VECTOR(EXTI1)]           = EXTI1_IRQHandler,
+	[IRQ_VECTOR(EXTI2)]           = EXTI2_IRQHandler,
+	[IRQ_VECTOR(EXTI3)]           = EXTI3_IRQHandler,
+	[IRQ_VECTOR(EXTI4)]           = EXTI4_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL1)]   = DMA1_Channel1_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL2)]   = DMA1_Channel2_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL3)]   = DMA1_Channel3_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL4)]   = DMA1_Channel4_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL5)]   = DMA1_Channel5_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL6)]   = DMA1_Channel6_IRQHandler,
+	[IRQ_VECTOR(DMA1_CHANNEL7)]   = DMA1_Channel7_IRQHandler,
+	[IRQ_VECTOR(ADC)]             = ADC1_2_IRQHandler,
+	[IRQ_VECTOR(USB_HP_CAN_TX)]   = USB_HP_CAN_TX_IRQHandler,
+	[IRQ_VECTOR(USB_LP_CAN_RX0)]  = USB_LP_CAN_RX0_IRQHandler,
+	[IRQ_VECTOR(CAN_RX1)]         = CAN_RX1_IRQHandler,
+	[IRQ_VECTOR(CAN_SCE)]         = CAN_SCE_IRQHandler,
+	[IRQ_VECTOR(EXTI9_5)]         = EXTI9_5_IRQHandler,
+	[IRQ_VECTOR(TIM1_BRK)]        = TIM1_BRK_IRQHandler,
+	[IRQ_VECTOR(TIM1_UP)]         = TIM1_UP_IRQHandler,
+	[IRQ_VECTOR(TIM1_TRG_COM)]    = TIM1_TRG_COM_IRQHandler,
+	[IRQ_VECTOR(TIM1_CC)]         = TIM1_CC_IRQHandler,
+	[IRQ_VECTOR(TIM2)]            = TIM2_IRQHandler,
+	[IRQ_VECTOR(TIM3)]            = TIM3_IRQHandler,
+	[IRQ_VECTOR(TIM4)]            = TIM4_IRQHandler,
+	[IRQ_VECTOR(I2C1_EV)]         = I2C1_EV_IRQHandler,
+	[IRQ_VECTOR(I2C1_ER)]         = I2C1_ER_IRQHandler,
+	[IRQ_VECTOR(I2C2_EV)]         = I2C2_EV_IRQHandler,
+	[IRQ_VECTOR(I2C2_ER)]         = I2C2_ER_IRQHandler,
+	[IRQ_VECTOR(SPI1)]            = SPI1_IRQHandler,
+	[IRQ_VECTOR(SPI2)]            = SPI2_IRQHandler,
+	[IRQ_VECTOR(USART1)]          = USART1_IRQHandler,
+	[IRQ_VECTOR(USART2)]          = USART2_IRQHandler,
+	[IRQ_VECTOR(USART3)]          = USART3_IRQHandler,
+	[IRQ_VECTOR(EXTI15_10)]       = EXTI15_10_IRQHandler,
+	[IRQ_VECTOR(RTC_ALARM)]       = RTCAlarm_IRQHandler,
+	[IRQ_VECTOR(USB_WAKEUP)]      = USBWakeUp_IRQHandler,
+	[IRQ_VECTOR(TIM8_BRK)]        = TIM8_BRK_IRQHandler,
+	[IRQ_VECTOR(TIM8_UP)]         = TIM8_UP_IRQHandler,
+	[IRQ_VECTOR(TIM8_TRG_COM)]    = TIM8_TRG_COM_IRQHandler,
+	[IRQ_VECTOR(TIM8_CC)]         = TIM8_CC_IRQHandler,
+	[IRQ_VECTOR(ADC3)]            = ADC3_IRQHandler,
+	[IRQ_VECTOR(FSMC)]            = FSMC_IRQHandler,
+	[IRQ_VECTOR(SDIO)]            = SDIO_IRQHandler,
+	[IRQ_VECTOR(TIM5)]            = TIM5_IRQHandler,
+	[IRQ_VECTOR(SPI3)]            = SPI3_IRQHandler,
+	[IRQ_VECTOR(UART4)]           = UART4_IRQHandler,
+	[IRQ_VECTOR(UART5)]           = UART5_IRQHandler,
+	[IRQ_VECTOR(TIM6)]            = TIM6_IRQHandler,
+	[IRQ_VECTOR(TIM7)]            = TIM7_IRQHandler,
+	[IRQ_VECTOR(DMA2_CHANNEL1)]   = DMA2_Channel1_IRQHandler,
+	[IRQ_VECTOR(DMA2_CHANNEL2)]   = DMA2_Channel2_IRQHandler,
+	[IRQ_VECTOR(DMA2_CHANNEL3)]   = DMA2_Channel3_IRQHandler,
+	[IRQ_VECTOR(DMA2_CHANNEL4_5)] = DMA2_Channel4_5_IRQHandler
 };
-extern uint32 _E_text;
-extern uint32 _S_data;
-extern uint32 _E_data;
-extern uint32 _S_bss;
-extern uint32 _E_bss;
-void Rest_Handler()
+
+/* layout checks against the NVIC driver */
+_Static_assert(NVIC_IRQ_COUNT == 60, "STM32F103 has 60 interrupt positions");
+_Static_assert(sizeof(vectors) / sizeof(vectors[0]) == IRQ_VECTOR(NVIC_IRQ_COUNT), "vector table must cover every IRQ");
+_Static_assert(EXTI0 == 6 && EXTI9_5 == 23 && EXTI15_10 == 40 && USART1 == 37 && USB_LP_CAN_RX0 == 20,
+			   "NVIC_InterruptType_t does not match the reference manual");
+
+/* init tables built by the linker script in flash: {load address , run address , words} per copied region and
+   {run address , words} per zeroed region. a new RAM section is set up by adding one entry to the table */
+typedef struct
+{
+	const uint32* Load;
+	uint32*       Run;
+	uint32        Words;
+}Startup_CopyRegion_t;
+
+typedef struct
+{
+	uint32*       Run;
+	uint32        Words;
+}Startup_ZeroRegion_t;
+
+extern const Startup_CopyRegion_t _S_copy_table[];
+extern const Startup_CopyRegion_t _E_copy_table[];
+extern const Startup_ZeroRegion_t _S_zero_table[];
+extern const Startup_ZeroRegion_t _E_zero_table[];
+
+/* core cycles from reset entry to the call of main (DWT cycle counter), read it with the debugger or print it */
+volatile uint32 Startup_uint32BootCycles;
+
+/* 4 words per iteration with one LDM/STM pair , then the remaining words one by one.
+   the project is built without optimisation so the burst is written out instead of left to the compiler */
+static void Startup_VoidCopyWords(uint32* Copy_pDestination , const uint32* Copy_pSource , uint32 Copy_uint32Words)
 {
-	// copy .data from flash to sram
-	int i ;
-	uint32 data_size = (uint8*)&_E_data - (uint8*)&_S_data ;
-	uint8*  P_src =(uint8*)&_E_text;
-	uint8* P_dst = (uint8*)&_S_data;
-	for ( i = 0; i < data_size; ++i)
+	while(Copy_uint32Words >= 4)
 	{
-		*((uint8*)P_dst++)=*((uint8*)P_src++);
+		__asm__ volatile ("ldmia %0!, {r2-r5} \n\t"
+						  "stmia %1!, {r2-r5}"
+						  : "+r" (Copy_pSource) , "+r" (Copy_pDestination)
+						  :
+						  : "r2" , "r3" , "r4" , "r5" , "memory");
+		Copy_uint32Words -= 4;
 	}
-	// init the .bss with zero
-	uint32 bss_size = (uint8*)&_E_bss - (uint8*)&_S_bss ;
-	P_dst = (uint8*)&_S_bss;
-	for ( i = 0; i < bss_size; ++i)
+	while(Copy_uint32Words-- != 0)
 	{
-		*((uint8*)P_dst++)=(uint8)0;
+		*Copy_pDestination++ = *Copy_pSource++;
 	}
-	main();
 }
 
+static void Startup_VoidZeroWords(uint32* Copy_pDestination , uint32 Copy_uint32Words)
+{
+	while(Copy_uint32Words >= 4)
+	{
+		__asm__ volatile ("movs r2, #0 \n\t"
+						  "movs r3, #0 \n\t"
+						  "movs r4, #0 \n\t"
+						  "movs r5, #0 \n\t"
+						  "stmia %0!, {r2-r5}"
+						  : "+r" (Copy_pDestination)
+						  :
+						  : "r2" , "r3" , "r4" , "r5" , "memory");
+		Copy_uint32Words -= 4;
+	}
+	while(Copy_uint32Words-- != 0)
+	{
+		*Copy_pDestination++ = 0;
+	}
+}
 
+void Rest_Handler()
+{
+	const Startup_CopyRegion_t* Local_pCopy;
+	const Startup_ZeroRegion_t* Local_pZero;
+	uint32 Local_uint32Start;
+
+	/* nothing here may touch .data or .bss before they are set up */
+	MDWT_VoidEnableCycleCounter();
+	Local_uint32Start = MDWT_CYCLE_COUNT();
 
+	// copy .data (and every other initialised RAM region) from flash to sram
+	for(Local_pCopy = _S_copy_table; Local_pCopy < _E_copy_table; Local_pCopy++)
+	{
+		Startup_VoidCopyWords(Local_pCopy->Run , Local_pCopy->Load , Local_pCopy->Words);
+	}
+	// init the .bss (and every other zeroed RAM region) with zero
+	for(Local_pZero = _S_zero_table; Local_pZero < _E_zero_table; Local_pZero++)
+	{
+		Startup_VoidZeroWords(Local_pZero->Run , Local_pZero->Words);
+	}
+	// paint the unused main stack for the high-water mark and the guard zone check
+	SSTACK_VoidPaintMainStack();
 
+	Startup_uint32BootCycles = MDWT_CYCLE_COUNT() - Local_uint32Start;
+	main();
+}
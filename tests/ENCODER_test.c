@@ -0,0 +1,253 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  ENCODER_test.c
+ *       Module:  ENCODER Module
+ *  Description:  host replay of a recorded quadrature edge sequence through HENCODER_VoidUpdate (make -C tests).
+ *                encoder 0 runs a 100k edges/s profile forward , stopped and backward with contact bounce ,
+ *                encoder 1 the same rate with single dropped samples (missed edges).
+ *                checks final positions , illegal transition counts and the velocity of every 10ms window
+ *                and reports the host decode time per edge and the target cycle budget per edge.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#undef NULL
+
+#include "COTS/HAL/ENCODER/ENCODER_interface.h"
+#include "COTS/MCAL/External_Interrupt/External_Interrupt_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_EDGE_RATE              100000UL
+#define TEST_MAX_EDGES              400000UL
+/*velocity read by the control loop every 10 ticks (10ms)*/
+#define TEST_VELOCITY_PERIOD        10UL
+/*steady state velocity tolerance: 1%*/
+#define TEST_VELOCITY_TOLERANCE     (TEST_EDGE_RATE / 100UL)
+#define TEST_DROPPED_EDGES          25UL
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*one recorded edge: time and the port input register sampled by the EXTI ISR*/
+typedef struct
+{
+    uint32 TimeUs;
+    uint32 Idr;
+    uint8  Encoder;
+}Test_Edge_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static const ENCODER_Channels_t Test_Channels[ENCODER_NUM] = ENCODER_CHANNELS;
+/*forward gray sequence 00 -> 01 -> 11 -> 10 , state = (A << 1) | B*/
+static const uint8 Test_Gray[4] = {0 , 1 , 3 , 2};
+
+static Test_Edge_t Test_Recording[TEST_MAX_EDGES];
+static uint32 Test_uint32EdgeCount = 0;
+static uint8  Test_uint8Phase[ENCODER_NUM];
+static uint32 Test_uint32Tick = 0;
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*the decoder is driven directly , the hardware calls of the module are stubbed*/
+uint32 MSYSTICK_uint32GetTickCount(void)
+{
+    return Test_uint32Tick;
+}
+Std_ReturnType MRCC_Std_ReturnTypeGetClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+{
+    return OK;
+}
+void MGPIO_VoidSetPinMode_TYPE(GPIO_Num Copy_u8Port , GPIO_PinNum Copy_u8Pin , GPIO_PinModeType Copy_u8Mode){}
+void MEXTERNAL_INTERRUPT_VoidSetPort(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,EXTERNAL_INTERRUPT_PORTS_t Copy_uint8InterruptPort){}
+void MEXTERNAL_INTERRUPT_VoidSetTriggerType(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,EXTERNAL_INTERRUPT_Trigger_type_t Copy_uint8Interruptrigger){}
+void MEXTERNAL_INTERRUPT_VoidInterruptCallback(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber,void (*callback)(void)){}
+void MEXTERNAL_INTERRUPT_VoidEnableInterrupt(EXTERNAL_InterruptNumber_t Copy_uint8InterruptNumber){}
+
+static uint32 Test_uint32Idr(uint8 Copy_uint8Encoder , uint8 Copy_uint8State)
+{
+    /*other port bits toggle too: the decoder must only look at its two pins*/
+    uint32 Local_uint32Idr = (Test_uint32EdgeCount * 0x9E3779B1UL) & 0xFFFFUL;
+    Local_uint32Idr &= ~((1UL << Test_Channels[Copy_uint8Encoder].PinA) | (1UL << Test_Channels[Copy_uint8Encoder].PinB));
+    Local_uint32Idr |= (uint32)((Copy_uint8State >> 1) & 1U) << Test_Channels[Copy_uint8Encoder].PinA;
+    Local_uint32Idr |= (uint32)(Copy_uint8State & 1U) << Test_Channels[Copy_uint8Encoder].PinB;
+    return Local_uint32Idr;
+}
+
+static void Test_VoidRecord(uint32 Copy_uint32TimeUs , uint8 Copy_uint8Encoder , uint8 Copy_uint8State)
+{
+    if(Test_uint32EdgeCount < TEST_MAX_EDGES)
+    {
+        Test_Recording[Test_uint32EdgeCount].TimeUs = Copy_uint32TimeUs;
+        Test_Recording[Test_uint32EdgeCount].Idr = Test_uint32Idr(Copy_uint8Encoder,Copy_uint8State);
+        Test_Recording[Test_uint32EdgeCount].Encoder = Copy_uint8Encoder;
+        Test_uint32EdgeCount++;
+    }
+}
+
+/*constant speed segment: Copy_sint32Edges edges (sign = direction) at Copy_uint32Rate edges/s , returns end time*/
+static uint32 Test_uint32Move(uint8 Copy_uint8Encoder , uint32 Copy_uint32StartUs , sint32 Copy_sint32Edges ,
+                              uint32 Copy_uint32Rate , uint32 Copy_uint32BounceEvery , uint32 Copy_uint32DropEvery)
+{
+    uint32 Local_uint32Edges = (Copy_sint32Edges < 0) ? (uint32)(-Copy_sint32Edges) : (uint32)Copy_sint32Edges;
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32TimeUs = Copy_uint32StartUs;
+    for(Local_uint32Itr = 1; Local_uint32Itr <= Local_uint32Edges; Local_uint32Itr++)
+    {
+        uint8 Local_uint8Previous = Test_uint8Phase[Copy_uint8Encoder];
+        Local_uint32TimeUs = Copy_uint32StartUs + (uint32)(((uint64)Local_uint32Itr * 1000000ULL) / Copy_uint32Rate);
+        Test_uint8Phase[Copy_uint8Encoder] = (Local_uint8Previous + ((Copy_sint32Edges < 0) ? 3U : 1U)) & 3U;
+        if((Copy_uint32DropEvery != 0) && ((Local_uint32Itr % Copy_uint32DropEvery) == (Copy_uint32DropEvery / 2)))
+        {
+            /*the ISR of this edge never ran: the next sample shows both channels changed*/
+            continue;
+        }
+        Test_VoidRecord(Local_uint32TimeUs,Copy_uint8Encoder,Test_Gray[Test_uint8Phase[Copy_uint8Encoder]]);
+        if((Copy_uint32BounceEvery != 0) && ((Local_uint32Itr % Copy_uint32BounceEvery) == 0))
+        {
+            /*contact bounce: back to the previous state and forward again within 1us*/
+            Test_VoidRecord(Local_uint32TimeUs,Copy_uint8Encoder,Test_Gray[Local_uint8Previous]);
+            Test_VoidRecord(Local_uint32TimeUs + 1,Copy_uint8Encoder,Test_Gray[Test_uint8Phase[Copy_uint8Encoder]]);
+        }
+    }
+    return Local_uint32TimeUs;
+}
+
+static uint64 Test_uint64NowNs(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC,&Local_Time);
+    return ((uint64)Local_Time.tv_sec * 1000000000ULL) + (uint64)Local_Time.tv_nsec;
+}
+
+static sint32 Test_sint32Abs(sint32 Copy_sint32Value)
+{
+    return (Copy_sint32Value < 0) ? -Copy_sint32Value : Copy_sint32Value;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    uint32 Local_uint32TimeUs;
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32NextSample = TEST_VELOCITY_PERIOD;
+    uint32 Local_uint32Cruise = 0;
+    uint32 Local_uint32Stopped = 0;
+    sint32 Local_sint32MaxError = 0;
+    uint64 Local_uint64Ns;
+
+    /*encoder 0: forward 0.5s , stop 0.3s , backward 0.3s , forward 0.2s at a quarter of the rate
+      expected 50000 - 30000 + 5000 counts , every bounce cancels out*/
+    Local_uint32TimeUs = Test_uint32Move(0,0,50000,TEST_EDGE_RATE,997,0);
+    Local_uint32TimeUs = Test_uint32Move(0,Local_uint32TimeUs + 300000UL,-30000,TEST_EDGE_RATE,0,0);
+    (void)Test_uint32Move(0,Local_uint32TimeUs,5000,TEST_EDGE_RATE / 4,0,0);
+    /*encoder 1 in a second recording pass: one missed edge in every 1000 loses 2 counts and counts one error*/
+    (void)Test_uint32Move(1,0,(sint32)(TEST_DROPPED_EDGES * 1000UL),TEST_EDGE_RATE,0,1000);
+
+    /*replay in time order: the recording of encoder 1 interleaves with encoder 0*/
+    {
+        uint32 Local_uint32First1 = 0;
+        while((Local_uint32First1 < Test_uint32EdgeCount) && (Test_Recording[Local_uint32First1].Encoder == 0)) Local_uint32First1++;
+        /*merge the two sorted halves into the order the ISRs would have seen them*/
+        {
+            static Test_Edge_t Local_Merged[TEST_MAX_EDGES];
+            uint32 Local_uint32A = 0;
+            uint32 Local_uint32B = Local_uint32First1;
+            uint32 Local_uint32Out = 0;
+            while(Local_uint32Out < Test_uint32EdgeCount)
+            {
+                if((Local_uint32B >= Test_uint32EdgeCount) ||
+                   ((Local_uint32A < Local_uint32First1) && (Test_Recording[Local_uint32A].TimeUs <= Test_Recording[Local_uint32B].TimeUs)))
+                {
+                    Local_Merged[Local_uint32Out++] = Test_Recording[Local_uint32A++];
+                }
+                else
+                {
+                    Local_Merged[Local_uint32Out++] = Test_Recording[Local_uint32B++];
+                }
+            }
+            for(Local_uint32Itr = 0; Local_uint32Itr < Test_uint32EdgeCount; Local_uint32Itr++) Test_Recording[Local_uint32Itr] = Local_Merged[Local_uint32Itr];
+        }
+    }
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < Test_uint32EdgeCount; Local_uint32Itr++)
+    {
+        const Test_Edge_t* Local_pEdge = &Test_Recording[Local_uint32Itr];
+        /*control loop runs at its tick boundaries before the edges of the next tick*/
+        while((Local_pEdge->TimeUs / 1000UL) >= Local_uint32NextSample)
+        {
+            sint32 Local_sint32Velocity;
+            Test_uint32Tick = Local_uint32NextSample;
+            Local_sint32Velocity = HENCODER_sint32GetVelocity(0);
+            /*steady state windows of each segment , the first window of a segment starts from standstill*/
+            if((Test_uint32Tick > 20) && (Test_uint32Tick <= 500))
+            {
+                TEST_CHECK(Test_sint32Abs(Local_sint32Velocity - (sint32)TEST_EDGE_RATE) <= (sint32)TEST_VELOCITY_TOLERANCE);
+                if(Test_sint32Abs(Local_sint32Velocity - (sint32)TEST_EDGE_RATE) > Local_sint32MaxError)
+                {
+                    Local_sint32MaxError = Test_sint32Abs(Local_sint32Velocity - (sint32)TEST_EDGE_RATE);
+                }
+                Local_uint32Cruise++;
+            }
+            else if((Test_uint32Tick > (500 + ENCODER_STOP_TIMEOUT_TICKS + TEST_VELOCITY_PERIOD)) && (Test_uint32Tick <= 800))
+            {
+                TEST_CHECK(Local_sint32Velocity == 0);
+                Local_uint32Stopped++;
+            }
+            else if((Test_uint32Tick > 820) && (Test_uint32Tick <= 1100))
+            {
+                TEST_CHECK(Test_sint32Abs(Local_sint32Velocity + (sint32)TEST_EDGE_RATE) <= (sint32)TEST_VELOCITY_TOLERANCE);
+                Local_uint32Cruise++;
+            }
+            else{}
+            Local_uint32NextSample += TEST_VELOCITY_PERIOD;
+        }
+        Test_uint32Tick = Local_pEdge->TimeUs / 1000UL;
+        HENCODER_VoidUpdate(Local_pEdge->Encoder,Local_pEdge->Idr,Test_uint32Tick);
+    }
+
+    TEST_CHECK(HENCODER_sint32GetPosition(0) == (50000 - 30000 + 5000));
+    TEST_CHECK(HENCODER_uint32GetErrorCount(0) == 0);
+    TEST_CHECK(HENCODER_sint32GetPosition(1) == (sint32)((TEST_DROPPED_EDGES * 1000UL) - (2UL * TEST_DROPPED_EDGES)));
+    TEST_CHECK(HENCODER_uint32GetErrorCount(1) == TEST_DROPPED_EDGES);
+    TEST_CHECK(Local_uint32Cruise > 70);
+    TEST_CHECK(Local_uint32Stopped > 15);
+
+    printf("ENCODER: %lu recorded edges at %lu edges/s , positions %ld / %ld , errors %lu / %lu , worst velocity error %ld counts/s\n",
+           Test_uint32EdgeCount,TEST_EDGE_RATE,(long)HENCODER_sint32GetPosition(0),(long)HENCODER_sint32GetPosition(1),
+           HENCODER_uint32GetErrorCount(0),HENCODER_uint32GetErrorCount(1),(long)Local_sint32MaxError);
+
+    /*decode cost: replay the whole recording again , positions move on from where they are*/
+    Local_uint64Ns = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < Test_uint32EdgeCount; Local_uint32Itr++)
+    {
+        HENCODER_VoidUpdate(Test_Recording[Local_uint32Itr].Encoder,Test_Recording[Local_uint32Itr].Idr,Test_Recording[Local_uint32Itr].TimeUs / 1000UL);
+    }
+    Local_uint64Ns = Test_uint64NowNs() - Local_uint64Ns;
+
+    printf("  host decode %lu ns/edge , target budget per edge at %lu edges/s: 8MHZ %lu , 24MHZ %lu , 72MHZ %lu cycles\n",
+           (uint32)(Local_uint64Ns / Test_uint32EdgeCount),TEST_EDGE_RATE,
+           8000000UL / TEST_EDGE_RATE,24000000UL / TEST_EDGE_RATE,72000000UL / TEST_EDGE_RATE);
+
+    printf("ENCODER: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
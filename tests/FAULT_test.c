@@ -0,0 +1,304 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  FAULT_test.c
+ *       Module:  FAULT Module
+ *  Description:  host test of the fault capture and report (make -C tests). the SCB page (0xE000E000) is mapped at
+ *                its target address and the RAM between _S_data and _stak_top is a block defined here , the test
+ *                builds exception frames in it and calls SFAULT_VoidCapture as the naked handlers do. the reset
+ *                requested through AIRCR is played by a timer signal that jumps back out of the final loop.
+ *                capture : registers , frame and stack words of the record , requested reset , history kept over
+ *                          the reset , frames partly or wholly outside the RAM read as 0 without touching them.
+ *                history : oldest record overwritten , records by age , a damaged record or log header refused ,
+ *                          random RAM at power on cleared by the init and by a capture before the init.
+ *                report  : exact text of a record , only records since the last report , damaged ones skipped.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#undef NULL
+
+/*target word sizes: uint32 is 32 bits as on the Cortex-M3 , the SCB registers are 4 bytes apart*/
+#define STD_TYPES_H
+typedef unsigned char         uint8;
+typedef unsigned short        uint16;
+typedef unsigned int          uint32;
+typedef signed char           sint8;
+typedef signed short          sint16;
+typedef signed int            sint32;
+typedef unsigned long long    uint64;
+typedef signed long long      sint64;
+typedef enum
+{
+    N_OK,
+    OK,
+}Std_ReturnType;
+#define NULL                    ((void*)0)
+
+/*the capture entry point of the naked handlers is called directly*/
+#include "COTS/SERVICE/FAULT/FAULT_program.c"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_REGISTER_PAGE          0xE000E000UL
+#define TEST_REGISTER_PAGE_SIZE     0x1000UL
+/*words of RAM between _S_data and _stak_top*/
+#define TEST_RAM_WORDS              256
+#define TEST_ABOVE_WORDS            32
+#define TEST_EXC_RETURN_MSP         0xFFFFFFF9UL
+#define TEST_EXC_RETURN_PSP         0xFFFFFFFDUL
+#define TEST_REPORT_SIZE            4096U
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+#define TEST_STRING(X)              #X
+#define TEST_XSTRING(X)             TEST_STRING(X)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*the linker script symbols: _S_data starts the RAM that may hold a stack , _stak_top ends it*/
+__asm__
+(
+    ".bss                                       \n\t"
+    ".balign 8                                  \n\t"
+    ".globl _S_data                             \n\t"
+    "_S_data:                                   \n\t"
+    "Test_uint32Ram:                            \n\t"
+    ".space " TEST_XSTRING(TEST_RAM_WORDS) " * 4   \n\t"
+    ".globl _stak_top                           \n\t"
+    "_stak_top:                                 \n\t"
+    "Test_uint32AboveRam:                       \n\t"
+    ".space " TEST_XSTRING(TEST_ABOVE_WORDS) " * 4    \n\t"
+    ".text                                      \n\t"
+);
+extern uint32 Test_uint32Ram[TEST_RAM_WORDS];
+/*words past _stak_top , never read by the capture*/
+extern uint32 Test_uint32AboveRam[TEST_ABOVE_WORDS];
+
+static sigjmp_buf Test_Reset;
+static uint32 Test_uint32Resets = 0;
+static char Test_charReport[TEST_REPORT_SIZE];
+static uint32 Test_uint32ReportLength = 0;
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*the reset: leave the loop at the end of the capture*/
+static void Test_VoidResetSignal(int Copy_intSignal)
+{
+    siglongjmp(Test_Reset,1);
+}
+
+/*fault with the frame at Copy_pFrame , returns after the reset the capture asked for*/
+static void Test_VoidFault(uint32* Copy_pFrame , uint32 Copy_uint32ExcReturn)
+{
+    struct itimerval Local_Timer = {{0 , 0} , {0 , 2000}};
+
+    if(sigsetjmp(Test_Reset,1) == 0)
+    {
+        setitimer(ITIMER_REAL,&Local_Timer,NULL);
+        SFAULT_VoidCapture(Copy_pFrame,Copy_uint32ExcReturn);
+    }
+    Test_uint32Resets++;
+}
+
+/*frame r0 r1 r2 r3 r12 lr pc xpsr numbered after Copy_uint32Seed , words above it Copy_uint32Seed + 0x100 + i*/
+static void Test_VoidBuildFrame(uint32* Copy_pFrame , uint32 Copy_uint32Words , uint32 Copy_uint32Seed)
+{
+    uint32 Local_uint32Itr;
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < Copy_uint32Words; Local_uint32Itr++)
+    {
+        Copy_pFrame[Local_uint32Itr] = (Local_uint32Itr < FAULT_FRAME_WORDS) ? (Copy_uint32Seed + Local_uint32Itr) :
+                                                                               (Copy_uint32Seed + 0x100 + Local_uint32Itr);
+    }
+}
+
+static void Test_VoidPutChar(uint8 Copy_u8Data)
+{
+    if(Test_uint32ReportLength < (TEST_REPORT_SIZE - 1))
+    {
+        Test_charReport[Test_uint32ReportLength++] = (char)Copy_u8Data;
+        Test_charReport[Test_uint32ReportLength] = '\0';
+    }
+}
+
+static uint32 Test_uint32CountText(const char* Copy_pText)
+{
+    const char* Local_pAt = Test_charReport;
+    uint32 Local_uint32Count = 0;
+
+    while((Local_pAt = strstr(Local_pAt,Copy_pText)) != NULL)
+    {
+        Local_uint32Count++;
+        Local_pAt++;
+    }
+    return Local_uint32Count;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    struct sigaction Local_Action = {0};
+    uint32* Local_pRam = Test_uint32Ram;
+    uint32* Local_pFrame;
+    FAULT_Record_t Local_Record;
+    uint32 Local_uint32Itr;
+
+    if(mmap((void*)TEST_REGISTER_PAGE,TEST_REGISTER_PAGE_SIZE,PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED,-1,0) != (void*)TEST_REGISTER_PAGE)
+    {
+        printf("FAULT: cannot map the SCB page\n");
+        return 1;
+    }
+    Local_Action.sa_handler = Test_VoidResetSignal;
+    sigaction(SIGALRM,&Local_Action,NULL);
+
+    /*power on: random .noinit RAM , the init starts an empty history and enables the handlers*/
+    memset(&SFAULT_Log,0x5A,sizeof(SFAULT_Log));
+    SFAULT_VoidInit();
+    TEST_CHECK(SFAULT_uint32GetCount() == 0);
+    TEST_CHECK((FAULT_SCB_SHCSR & (FAULT_SHCSR_MEMFAULTENA | FAULT_SHCSR_BUSFAULTENA | FAULT_SHCSR_USGFAULTENA)) ==
+               (FAULT_SHCSR_MEMFAULTENA | FAULT_SHCSR_BUSFAULTENA | FAULT_SHCSR_USGFAULTENA));
+#if FAULT_TRAP_DIV_BY_ZERO == 1
+    TEST_CHECK((FAULT_SCB_CCR & FAULT_CCR_DIV_0_TRP) != 0);
+#else
+    TEST_CHECK((FAULT_SCB_CCR & FAULT_CCR_DIV_0_TRP) == 0);
+#endif
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == N_OK);
+    TEST_CHECK(SFAULT_uint8Report(Test_VoidPutChar) == 0);
+    TEST_CHECK(Test_uint32ReportLength == 0);
+
+    /*precise bus fault forced to HardFault in IRQ 21 (vector 0x25) on the task stack*/
+    Local_pFrame = Local_pRam + 64;
+    Test_VoidBuildFrame(Local_pFrame,FAULT_FRAME_WORDS + FAULT_STACK_DUMP_WORDS,0x10);
+    Local_pFrame[5] = 0x08001235;
+    Local_pFrame[6] = 0x08000420;
+    Local_pFrame[7] = 0x21000025;
+    FAULT_SCB_CFSR = 0x00008200;
+    FAULT_SCB_HFSR = 0x40000000;
+    FAULT_SCB_MMFAR = 0xE000EDF8;
+    FAULT_SCB_BFAR = 0x40013804;
+    FAULT_SCB_ICSR = 3;
+    FAULT_SCB_AIRCR = 0xFA050500;
+    Test_VoidFault(Local_pFrame,TEST_EXC_RETURN_PSP);
+    TEST_CHECK(Test_uint32Resets == 1);
+    TEST_CHECK(FAULT_SCB_AIRCR == (FAULT_AIRCR_VECTKEY | 0x500 | FAULT_AIRCR_SYSRESETREQ));
+    /*the history survives the reset*/
+    SFAULT_VoidInit();
+    TEST_CHECK(SFAULT_uint32GetCount() == 1);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == OK);
+    TEST_CHECK(Local_Record.Sequence == 1);
+    TEST_CHECK((Local_Record.FaultVector == 3) && (Local_Record.ActiveVector == 0x25));
+    TEST_CHECK((Local_Record.Cfsr == 0x8200) && (Local_Record.Hfsr == 0x40000000));
+    TEST_CHECK((Local_Record.Mmfar == 0xE000EDF8) && (Local_Record.Bfar == 0x40013804));
+    TEST_CHECK(Local_Record.ExcReturn == TEST_EXC_RETURN_PSP);
+    TEST_CHECK(Local_Record.StackPointer == (uint32)(unsigned long)Local_pFrame);
+    TEST_CHECK(memcmp(Local_Record.Frame,Local_pFrame,sizeof(Local_Record.Frame)) == 0);
+    TEST_CHECK(memcmp(Local_Record.Stack,Local_pFrame + FAULT_FRAME_WORDS,sizeof(Local_Record.Stack)) == 0);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(1,&Local_Record) == N_OK);
+
+    /*report: the exact line of the record , then nothing new*/
+    TEST_CHECK(SFAULT_uint8Report(Test_VoidPutChar) == 1);
+    {
+        char Local_charExpected[512];
+
+        snprintf(Local_charExpected,sizeof(Local_charExpected),
+                 "FAULT 00000001 00000003 00000025 08000420 08001235 21000025 00000010 00000011 00000012 00000013 "
+                 "00000014 00008200 40000000 e000edf8 40013804 %08x fffffffd \r\n"
+                 "STACK 00000118 00000119 0000011a 0000011b 0000011c 0000011d 0000011e 0000011f 00000120 00000121 "
+                 "00000122 00000123 00000124 00000125 00000126 00000127 \r\n",(uint32)(unsigned long)Local_pFrame);
+        TEST_CHECK(strcmp(Test_charReport,Local_charExpected) == 0);
+    }
+    Test_uint32ReportLength = 0;
+    Test_charReport[0] = '\0';
+    TEST_CHECK(SFAULT_uint8Report(Test_VoidPutChar) == 0);
+    TEST_CHECK(Test_uint32ReportLength == 0);
+
+    /*frame straddling the top of the RAM: the words past _stak_top read as 0 , a wild or unaligned stack pointer
+      reads nothing (a dereference would fault the test)*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_ABOVE_WORDS; Local_uint32Itr++)
+    {
+        Test_uint32AboveRam[Local_uint32Itr] = 0xDEADBEEF;
+    }
+    Local_pFrame = Local_pRam + TEST_RAM_WORDS - 4;
+    Test_VoidBuildFrame(Local_pFrame,4,0x20);
+    Test_VoidFault(Local_pFrame,TEST_EXC_RETURN_MSP);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == OK);
+    TEST_CHECK((Local_Record.Frame[0] == 0x20) && (Local_Record.Frame[3] == 0x23));
+    TEST_CHECK((Local_Record.Frame[4] == 0) && (Local_Record.Frame[7] == 0) && (Local_Record.ActiveVector == 0));
+    TEST_CHECK((Local_Record.Stack[0] == 0) && (Local_Record.Stack[FAULT_STACK_DUMP_WORDS - 1] == 0));
+    Test_VoidFault((uint32*)0x10,TEST_EXC_RETURN_MSP);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == OK);
+    TEST_CHECK((Local_Record.StackPointer == 0x10) && (Local_Record.Frame[0] == 0) && (Local_Record.Stack[0] == 0));
+    Test_VoidFault((uint32*)((uint8*)(Local_pRam + 64) + 2),TEST_EXC_RETURN_MSP);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == OK);
+    TEST_CHECK((Local_Record.Frame[0] == 0) && (Local_Record.Frame[7] == 0));
+
+    /*history: 6 faults in 4 records , the newest at age 0*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < 2; Local_uint32Itr++)
+    {
+        Local_pFrame = Local_pRam + 16;
+        Test_VoidBuildFrame(Local_pFrame,FAULT_FRAME_WORDS + FAULT_STACK_DUMP_WORDS,0x1000 * (Local_uint32Itr + 5));
+        Test_VoidFault(Local_pFrame,TEST_EXC_RETURN_MSP);
+    }
+    TEST_CHECK(SFAULT_uint32GetCount() == 6);
+    for(Local_uint32Itr = 0; Local_uint32Itr < FAULT_HISTORY_SIZE; Local_uint32Itr++)
+    {
+        TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(Local_uint32Itr,&Local_Record) == OK);
+        TEST_CHECK(Local_Record.Sequence == (6 - Local_uint32Itr));
+    }
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(FAULT_HISTORY_SIZE,&Local_Record) == N_OK);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == OK);
+    TEST_CHECK(Local_Record.Frame[0] == 0x6000);
+
+    /*a damaged record is refused and skipped: faults 2..6 are unreported , fault 2 was overwritten , 4 is damaged*/
+    SFAULT_Log.Records[(4 - 1) % FAULT_HISTORY_SIZE].Stack[0] ^= 1;
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(2,&Local_Record) == N_OK);
+    TEST_CHECK(SFAULT_uint8Report(Test_VoidPutChar) == 3);
+    TEST_CHECK(Test_uint32CountText("FAULT ") == 3);
+    TEST_CHECK(Test_uint32CountText("STACK ") == 3);
+    TEST_CHECK(strstr(Test_charReport,"FAULT 00000003 ") == Test_charReport);
+    TEST_CHECK(strstr(Test_charReport,"FAULT 00000004 ") == NULL);
+    TEST_CHECK(strstr(Test_charReport,"FAULT 00000006 ") != NULL);
+    TEST_CHECK(SFAULT_uint8Report(Test_VoidPutChar) == 0);
+
+    /*a damaged log header reads as empty , the init starts a new history*/
+    SFAULT_Log.Count++;
+    TEST_CHECK(SFAULT_uint32GetCount() == 0);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == N_OK);
+    TEST_CHECK(SFAULT_uint8Report(Test_VoidPutChar) == 0);
+    SFAULT_VoidInit();
+    TEST_CHECK(SFAULT_uint32GetCount() == 0);
+
+    /*a fault before the init after a power on: the capture starts the history itself*/
+    memset(&SFAULT_Log,0xA5,sizeof(SFAULT_Log));
+    Local_pFrame = Local_pRam + 32;
+    Test_VoidBuildFrame(Local_pFrame,FAULT_FRAME_WORDS + FAULT_STACK_DUMP_WORDS,0x7000);
+    Test_VoidFault(Local_pFrame,TEST_EXC_RETURN_MSP);
+    TEST_CHECK(SFAULT_uint32GetCount() == 1);
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(0,&Local_Record) == OK);
+    TEST_CHECK((Local_Record.Sequence == 1) && (Local_Record.Frame[0] == 0x7000));
+    TEST_CHECK(SFAULT_Std_ReturnTypeGetRecord(1,&Local_Record) == N_OK);
+    TEST_CHECK(Test_uint32Resets == 7);
+
+    printf("FAULT: %lu faults captured and reset , %u records kept\n",(unsigned long)Test_uint32Resets,FAULT_HISTORY_SIZE);
+    printf("FAULT: %s (%u failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,303 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  KERNEL_test.c
+ *       Module:  KERNEL Module
+ *  Description:  host model of the preemptive kernel (make -C tests): the switch decision runs at once instead of
+ *                in PendSV and no stacks are switched , so every call below returns with the task the core would
+ *                run next in SKERNEL_GetCurrentTask. SW_TIMER , STACK and NVIC are stubbed here , the test fires
+ *                the delay and slice timers itself.
+ *                selection : most urgent ready task first , round robin inside one priority on yield and on the
+ *                            slice timer , idle task only with nothing else ready.
+ *                blocking  : delay and wait take the task out , the delay timer and notify bring it back and
+ *                            preempt a less urgent task only , a notify before the wait is not lost.
+ *                creation  : initial exception frame , stack painted then registered , invalid arguments and a
+ *                            full pool refused.
+ *                switch    : cycle record of the PendSV hook against a mapped DWT page , and host ns per
+ *                            yield between two tasks of one priority.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#include <sys/mman.h>
+#undef NULL
+
+/*the PendSV cycle hook is built in , the record function is called directly*/
+#define KERNEL_MEASURE_SWITCH       1
+
+/*the task control blocks and ready rings are checked directly*/
+#include "COTS/SERVICE/KERNEL/KERNEL_program.c"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_STACK_WORDS            64U
+#define TEST_TIMERS                 16U
+#define TEST_DWT_PAGE               0xE0001000UL
+#define TEST_DWT_PAGE_SIZE          0x1000UL
+#define TEST_BENCH_LOOPS            10000000UL
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*SW_TIMER stub: callbacks of the created timers and the last start of each*/
+static void (*Test_pTimerCallback[TEST_TIMERS])(void* Copy_pArg);
+static void* Test_pTimerArg[TEST_TIMERS];
+static uint32 Test_uint32TimerDelay[TEST_TIMERS];
+static uint32 Test_uint32TimerPeriod[TEST_TIMERS];
+static uint32 Test_uint32Timers = 0;
+
+/*STACK stub*/
+static uint32* Test_pPainted = NULL;
+static uint32 Test_uint32PaintedWords = 0;
+static uint32 Test_uint32Regions = 0;
+
+/*NVIC stub*/
+static sint32 Test_sint32Exception = -1;
+static uint8 Test_uint8Group = 0;
+static uint8 Test_uint8Sub = 0;
+
+static uint32 Test_uint32Stacks[KERNEL_MAX_TASKS][TEST_STACK_WORDS] __attribute__((aligned(8)));
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+Std_ReturnType SSWTIMER_Std_ReturnTypeCreate(SW_TIMER_Handle_t* Copy_pHandle , void (*Copy_pCallback)(void* Copy_pArg) ,
+                                             void* Copy_pArg)
+{
+    if(Test_uint32Timers == TEST_TIMERS)
+    {
+        return N_OK;
+    }
+    Test_pTimerCallback[Test_uint32Timers] = Copy_pCallback;
+    Test_pTimerArg[Test_uint32Timers] = Copy_pArg;
+    *Copy_pHandle = (SW_TIMER_Handle_t)Test_uint32Timers;
+    Test_uint32Timers++;
+    return OK;
+}
+
+Std_ReturnType SSWTIMER_Std_ReturnTypeStart(SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay , uint32 Copy_uint32Period)
+{
+    Test_uint32TimerDelay[Copy_Handle] = Copy_uint32Delay;
+    Test_uint32TimerPeriod[Copy_Handle] = Copy_uint32Period;
+    return OK;
+}
+
+void SSTACK_VoidPaint(uint32* Copy_pBottom , uint32 Copy_uint32Words)
+{
+    uint32 Local_uint32Itr;
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < Copy_uint32Words; Local_uint32Itr++)
+    {
+        Copy_pBottom[Local_uint32Itr] = STACK_PAINT_PATTERN;
+    }
+    Test_pPainted = Copy_pBottom;
+    Test_uint32PaintedWords = Copy_uint32Words;
+}
+
+Std_ReturnType SSTACK_Std_ReturnTypeRegister(uint32* Copy_pBottom , uint32 Copy_uint32Words , uint8* Copy_pRegion)
+{
+    *Copy_pRegion = (uint8)Test_uint32Regions++;
+    return OK;
+}
+
+/*region id + 100 so the kernel is seen to pass its own region*/
+uint32 SSTACK_uint32GetHighWater(uint8 Copy_uint8Region)
+{
+    return (uint32)Copy_uint8Region + 100;
+}
+
+void MNVIC_VoidSetSystemPriority(NVIC_SystemException_t Copy_Exception , uint8 Copy_uint8Group , uint8 Copy_uint8Sub)
+{
+    Test_sint32Exception = (sint32)Copy_Exception;
+    Test_uint8Group = Copy_uint8Group;
+    Test_uint8Sub = Copy_uint8Sub;
+}
+
+static void Test_VoidEntry(void* Copy_pArg)
+{
+}
+
+static uint64 Test_uint64NowNs(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC,&Local_Time);
+    return ((uint64)Local_Time.tv_sec * 1000000000ULL) + (uint64)Local_Time.tv_nsec;
+}
+
+static void Test_VoidReset(void)
+{
+    Test_uint32Timers = 0;
+    Test_uint32Regions = 0;
+    SKERNEL_VoidInit();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    KERNEL_TaskHandle_t Local_A;
+    KERNEL_TaskHandle_t Local_B;
+    KERNEL_TaskHandle_t Local_C;
+    KERNEL_TaskHandle_t Local_Handle;
+    KERNEL_SwitchStats_t Local_Stats;
+    uint32* Local_pFrame;
+    uint32 Local_uint32SliceTimer;
+    uint32 Local_uint32Itr;
+    uint64 Local_uint64Start;
+    uint64 Local_uint64Elapsed;
+
+    /*selection: idle is task 0 at the least urgent priority , A and B share priority 5 , C is less urgent*/
+    Test_VoidReset();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == KERNEL_INVALID_TASK);
+    TEST_CHECK(Kernel_Tasks[0].Priority == KERNEL_IDLE_PRIORITY);
+    TEST_CHECK(Kernel_ReadyMask == KERNEL_READY_BIT(KERNEL_IDLE_PRIORITY));
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_A,Test_VoidEntry,(void*)0x1234,Test_uint32Stacks[1],TEST_STACK_WORDS,5) == OK);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_B,Test_VoidEntry,NULL,Test_uint32Stacks[2],TEST_STACK_WORDS,5) == OK);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_C,Test_VoidEntry,NULL,Test_uint32Stacks[3],TEST_STACK_WORDS,10) == OK);
+    /*not started: creation never switches*/
+    TEST_CHECK(SKERNEL_GetCurrentTask() == KERNEL_INVALID_TASK);
+    SKERNEL_VoidStart();
+    Local_uint32SliceTimer = Test_uint32Timers - 1;
+    TEST_CHECK(Test_sint32Exception == (sint32)NVIC_EXC_PENDSV);
+    TEST_CHECK((Test_uint8Group == 15) && (Test_uint8Sub == 15));
+    TEST_CHECK(Test_uint32TimerDelay[Local_uint32SliceTimer] == KERNEL_TIME_SLICE_TICKS);
+    TEST_CHECK(Test_uint32TimerPeriod[Local_uint32SliceTimer] == KERNEL_TIME_SLICE_TICKS);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+    SKERNEL_VoidYield();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_B);
+    SKERNEL_VoidYield();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+    Test_pTimerCallback[Local_uint32SliceTimer](NULL);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_B);
+    Test_pTimerCallback[Local_uint32SliceTimer](NULL);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+
+    /*blocking: A and B wait , C delays , the core goes to idle*/
+    SKERNEL_VoidWait();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_B);
+    TEST_CHECK(Kernel_Tasks[Local_A].State == KERNEL_STATE_WAITING);
+    SKERNEL_VoidWait();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_C);
+    TEST_CHECK((Kernel_ReadyMask & KERNEL_READY_BIT(5)) == 0);
+    /*the only task of its priority: a slice end keeps it*/
+    Test_pTimerCallback[Local_uint32SliceTimer](NULL);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_C);
+    SKERNEL_VoidDelay(7);
+    TEST_CHECK(Test_uint32TimerDelay[Kernel_Tasks[Local_C].DelayTimer] == 7);
+    TEST_CHECK(Test_uint32TimerPeriod[Kernel_Tasks[Local_C].DelayTimer] == 0);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == 0);
+    TEST_CHECK(Kernel_ReadyMask == KERNEL_READY_BIT(KERNEL_IDLE_PRIORITY));
+    /*a notify of a delayed task is kept for its next wait , it does not end the delay*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(Local_C) == OK);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == 0);
+    Test_pTimerCallback[Kernel_Tasks[Local_C].DelayTimer](Test_pTimerArg[Kernel_Tasks[Local_C].DelayTimer]);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_C);
+    /*a late delay callback of a task that is not delayed changes nothing*/
+    Test_pTimerCallback[Kernel_Tasks[Local_C].DelayTimer](Test_pTimerArg[Kernel_Tasks[Local_C].DelayTimer]);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_C);
+    SKERNEL_VoidWait();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_C);
+    TEST_CHECK(Kernel_Tasks[Local_C].Notified == 0);
+    /*a late delay callback does not wake a waiting task either , only the notify does*/
+    SKERNEL_VoidWait();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == 0);
+    Test_pTimerCallback[Kernel_Tasks[Local_C].DelayTimer](Test_pTimerArg[Kernel_Tasks[Local_C].DelayTimer]);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == 0);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(Local_C) == OK);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_C);
+    /*A preempts C , B becomes ready behind A without preempting it*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(Local_A) == OK);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(Local_B) == OK);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+    SKERNEL_VoidYield();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_B);
+    /*notify before the wait: the wait returns at once*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(Local_B) == OK);
+    SKERNEL_VoidWait();
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_B);
+    /*delay 0 is a yield*/
+    SKERNEL_VoidDelay(0);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(KERNEL_MAX_TASKS) == N_OK);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeNotify(KERNEL_MAX_TASKS - 1) == N_OK);
+
+    /*creation: frame of A under the top of its stack , r4-r11 below the hardware frame*/
+    Local_pFrame = Kernel_Tasks[Local_A].StackPointer;
+    TEST_CHECK(Local_pFrame == &Test_uint32Stacks[1][TEST_STACK_WORDS - KERNEL_HW_FRAME_WORDS - KERNEL_SW_FRAME_WORDS]);
+    TEST_CHECK(Local_pFrame[KERNEL_SW_FRAME_WORDS + 0] == 0x1234);
+    TEST_CHECK(Local_pFrame[KERNEL_SW_FRAME_WORDS + 5] == (uint32)SKERNEL_VoidTaskExit);
+    TEST_CHECK(Local_pFrame[KERNEL_SW_FRAME_WORDS + 6] == ((uint32)Test_VoidEntry & ~1UL));
+    TEST_CHECK(Local_pFrame[KERNEL_SW_FRAME_WORDS + 7] == KERNEL_INITIAL_XPSR);
+    TEST_CHECK(Local_pFrame[0] == 0);
+    /*painted whole before the frame , the words under the frame keep the pattern*/
+    TEST_CHECK(Test_uint32Stacks[1][0] == STACK_PAINT_PATTERN);
+    TEST_CHECK(Test_uint32Stacks[1][TEST_STACK_WORDS - KERNEL_HW_FRAME_WORDS - KERNEL_SW_FRAME_WORDS - 1] == STACK_PAINT_PATTERN);
+    TEST_CHECK((Test_pPainted == Test_uint32Stacks[3]) && (Test_uint32PaintedWords == TEST_STACK_WORDS));
+    TEST_CHECK(SKERNEL_uint32GetStackHighWater(Local_A) == (uint32)Kernel_Tasks[Local_A].StackRegion + 100);
+    TEST_CHECK(SKERNEL_uint32GetStackHighWater(KERNEL_MAX_TASKS) == 0);
+    TEST_CHECK(SKERNEL_uint32GetStackHighWater(KERNEL_MAX_TASKS - 1) == 0);
+    /*invalid arguments*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,NULL,NULL,Test_uint32Stacks[4],TEST_STACK_WORDS,5) == N_OK);
+    TEST_CHECK(Local_Handle == KERNEL_INVALID_TASK);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,Test_VoidEntry,NULL,Test_uint32Stacks[4],KERNEL_MIN_STACK_WORDS - 1,5) == N_OK);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,Test_VoidEntry,NULL,Test_uint32Stacks[4],TEST_STACK_WORDS,KERNEL_PRIORITIES) == N_OK);
+    /*the idle priority is reserved for the idle task of the init*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,Test_VoidEntry,NULL,Test_uint32Stacks[4],TEST_STACK_WORDS,KERNEL_IDLE_PRIORITY) == N_OK);
+    TEST_CHECK(Local_Handle == KERNEL_INVALID_TASK);
+    /*a more urgent task created after the start runs at once , the pool then runs out*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,Test_VoidEntry,NULL,Test_uint32Stacks[4],TEST_STACK_WORDS,1) == OK);
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_Handle);
+    for(Local_uint32Itr = 5; Local_uint32Itr < KERNEL_MAX_TASKS; Local_uint32Itr++)
+    {
+        TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,Test_VoidEntry,NULL,Test_uint32Stacks[Local_uint32Itr],TEST_STACK_WORDS,20) == OK);
+    }
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_Handle,Test_VoidEntry,NULL,Test_uint32Stacks[0],TEST_STACK_WORDS,20) == N_OK);
+    TEST_CHECK(Local_Handle == KERNEL_INVALID_TASK);
+
+    /*switch hook: nothing recorded yet , then three switches of 70 , 60 and 90 cycles*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeGetSwitchCycles(&Local_Stats) == N_OK);
+    TEST_CHECK(mmap((void*)TEST_DWT_PAGE,TEST_DWT_PAGE_SIZE,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED,-1,0) == (void*)TEST_DWT_PAGE);
+    DWT->CYCCNT = 1000;
+    SKERNEL_VoidRecordSwitch(930);
+    DWT->CYCCNT = 2000;
+    SKERNEL_VoidRecordSwitch(1940);
+    DWT->CYCCNT = 3000;
+    SKERNEL_VoidRecordSwitch(2910);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeGetSwitchCycles(&Local_Stats) == OK);
+    TEST_CHECK(Local_Stats.Count == 3);
+    TEST_CHECK(Local_Stats.MinCycles == 60);
+    TEST_CHECK(Local_Stats.MaxCycles == 90);
+    TEST_CHECK(Local_Stats.LastCycles == 90);
+    Test_VoidReset();
+    TEST_CHECK(SKERNEL_Std_ReturnTypeGetSwitchCycles(&Local_Stats) == N_OK);
+
+    /*host cost of a yield between two tasks of one priority (lock , ring rotation , CLZ selection)*/
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_A,Test_VoidEntry,NULL,Test_uint32Stacks[1],TEST_STACK_WORDS,5) == OK);
+    TEST_CHECK(SKERNEL_Std_ReturnTypeCreateTask(&Local_B,Test_VoidEntry,NULL,Test_uint32Stacks[2],TEST_STACK_WORDS,5) == OK);
+    SKERNEL_VoidStart();
+    Local_uint64Start = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_BENCH_LOOPS; Local_uint32Itr++)
+    {
+        SKERNEL_VoidYield();
+    }
+    Local_uint64Elapsed = Test_uint64NowNs() - Local_uint64Start;
+    TEST_CHECK(SKERNEL_GetCurrentTask() == Local_A);
+    printf("KERNEL: %lu yields , %lu ns/yield (host model)\n",TEST_BENCH_LOOPS,(uint32)(Local_uint64Elapsed / TEST_BENCH_LOOPS));
+
+    printf("KERNEL: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
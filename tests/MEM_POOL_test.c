@@ -0,0 +1,290 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  MEM_POOL_test.c
+ *       Module:  Memory Pool
+ *  Description:  host test of the static allocators of Mem_Pool.h (make -C tests).
+ *                arena : aligned start inside an unaligned region , exhaustion , the .heap region of the linker
+ *                        script (_S_heap , _E_heap defined here).
+ *                pool  : free map of 70 blocks (partial last map word) and of 1024 blocks (full summary) , every
+ *                        block handed out once and inside the pool , double free , foreign and unaligned addresses
+ *                        refused , a random alloc/free sequence checked against a shadow map , statistics.
+ *                bump  : aligned allocations , full region , mark and reset back to the mark , reset 0 and a mark
+ *                        above the fill level , statistics.
+ *                cost  : host ns per pool alloc + free pair with the pool half full.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#undef NULL
+
+#include "COTS/LIB/Mem_Pool.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_STORAGE_WORDS          4096U
+#define TEST_SMALL_BLOCKS           70U
+#define TEST_SMALL_SIZE             13U         /*rounded up to 16*/
+#define TEST_RANDOM_STEPS           200000UL
+#define TEST_BENCH_LOOPS            10000000UL
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*the .heap region of the linker script: 4 KB between _S_heap and _E_heap*/
+__asm__
+(
+    ".bss                                       \n\t"
+    ".balign 8                                  \n\t"
+    ".globl _S_heap                             \n\t"
+    "_S_heap:                                   \n\t"
+    ".space 4096                                \n\t"
+    ".globl _E_heap                             \n\t"
+    "_E_heap:                                   \n\t"
+    ".space 8                                   \n\t"
+    ".text                                      \n\t"
+);
+
+static uint64 Test_uint64Storage[TEST_STORAGE_WORDS];
+static void* Test_pBlocks[MEM_POOL_MAX_BLOCKS];
+static uint8 Test_uint8Taken[MEM_POOL_MAX_BLOCKS];
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+static uint64 Test_uint64NowNs(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC,&Local_Time);
+    return ((uint64)Local_Time.tv_sec * 1000000000ULL) + (uint64)Local_Time.tv_nsec;
+}
+
+/*index of a block address , MEM_POOL_MAX_BLOCKS when it is not a block start inside the pool*/
+static uint32 Test_uint32BlockIndex(const Mem_Pool_t* Copy_pPool , const void* Copy_pBlock)
+{
+    uint32 Local_uint32Offset = (uint32)((const uint8*)Copy_pBlock - Copy_pPool->Base);
+
+    if(((const uint8*)Copy_pBlock < Copy_pPool->Base) || ((Local_uint32Offset % Copy_pPool->BlockSize) != 0) ||
+       ((Local_uint32Offset / Copy_pPool->BlockSize) >= Copy_pPool->Blocks))
+    {
+        return MEM_POOL_MAX_BLOCKS;
+    }
+    return Local_uint32Offset / Copy_pPool->BlockSize;
+}
+
+/*take every block: each one once , inside the pool , then the pool is empty*/
+static void Test_VoidDrain(Mem_Pool_t* Copy_pPool)
+{
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32Index;
+    uint32 Local_uint32Repeated = 0;
+    uint32 Local_uint32Outside = 0;
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < MEM_POOL_MAX_BLOCKS; Local_uint32Itr++)
+    {
+        Test_uint8Taken[Local_uint32Itr] = 0;
+    }
+    for(Local_uint32Itr = 0; Local_uint32Itr < Copy_pPool->Blocks; Local_uint32Itr++)
+    {
+        Test_pBlocks[Local_uint32Itr] = Mem_pPoolAlloc(Copy_pPool);
+        Local_uint32Index = Test_uint32BlockIndex(Copy_pPool,Test_pBlocks[Local_uint32Itr]);
+        if(Local_uint32Index == MEM_POOL_MAX_BLOCKS)
+        {
+            Local_uint32Outside++;
+        }
+        else if(Test_uint8Taken[Local_uint32Index] != 0)
+        {
+            Local_uint32Repeated++;
+        }
+        else
+        {
+            Test_uint8Taken[Local_uint32Index] = 1;
+        }
+    }
+    TEST_CHECK(Local_uint32Outside == 0);
+    TEST_CHECK(Local_uint32Repeated == 0);
+    TEST_CHECK(Mem_pPoolAlloc(Copy_pPool) == NULL);
+    TEST_CHECK(Copy_pPool->Summary == 0);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    Mem_Arena_t Local_Arena;
+    Mem_Arena_t Local_Heap;
+    Mem_Pool_t Local_Pool;
+    Mem_Bump_t Local_Bump;
+    Mem_Stats_t Local_Stats;
+    uint8* Local_pFirst;
+    uint8* Local_pSecond;
+    uint8* Local_pThird;
+    uint32 Local_uint32Mark;
+    uint32 Local_uint32Index;
+    uint32 Local_uint32InUse = 0;
+    uint32 Local_uint32Mismatch = 0;
+    uint32 Local_uint32Itr;
+    uint64 Local_uint64Start;
+    uint64 Local_uint64Elapsed;
+
+    /*arena: the first aligned byte of an unaligned region , exhaustion leaves it as it is*/
+    Mem_VoidArenaInit(&Local_Arena,(uint8*)Test_uint64Storage + 3,sizeof(Test_uint64Storage) - 3);
+    TEST_CHECK(((uint32)Local_Arena.Base % MEM_ALIGNMENT) == 0);
+    TEST_CHECK(Local_Arena.Base == ((uint8*)Test_uint64Storage + MEM_ALIGNMENT));
+    TEST_CHECK(Mem_pArenaAlloc(&Local_Arena,0) == NULL);
+    Mem_VoidArenaInitHeap(&Local_Heap);
+    Local_Stats = Mem_ArenaGetStats(&Local_Heap);
+    TEST_CHECK((Local_Heap.Base == (uint8*)&_S_heap) && (Local_Stats.Capacity == 4096) && (Local_Stats.InUse == 0));
+    TEST_CHECK(Mem_pArenaAlloc(&Local_Heap,4000) == (void*)&_S_heap);
+    TEST_CHECK(Mem_pArenaAlloc(&Local_Heap,100) == NULL);
+    TEST_CHECK(Mem_pArenaAlloc(&Local_Heap,96) == (Local_Heap.Base + 4000));
+    Local_Stats = Mem_ArenaGetStats(&Local_Heap);
+    TEST_CHECK((Local_Stats.InUse == 4096) && (Local_Stats.Peak == 4096));
+    TEST_CHECK(Mem_pArenaAlloc(&Local_Heap,1) == NULL);
+
+    /*pool of 70: the map words past block 69 are never handed out*/
+    TEST_CHECK(Mem_Std_ReturnTypePoolInit(&Local_Pool,&Local_Arena,TEST_SMALL_SIZE,TEST_SMALL_BLOCKS) == OK);
+    TEST_CHECK(Local_Pool.BlockSize == 16);
+    TEST_CHECK(Local_Pool.Summary == 0x7);
+    TEST_CHECK(Local_Pool.FreeMap[2] == 0x3F);
+    Test_VoidDrain(&Local_Pool);
+    Local_Stats = Mem_PoolGetStats(&Local_Pool);
+    TEST_CHECK((Local_Stats.Capacity == 70) && (Local_Stats.InUse == 70) && (Local_Stats.Peak == 70) && (Local_Stats.Failures == 1));
+    /*double free , unaligned , outside and below the pool are refused and change nothing*/
+    TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,Test_pBlocks[5]) == OK);
+    TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,Test_pBlocks[5]) == N_OK);
+    TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,(uint8*)Test_pBlocks[6] + 1) == N_OK);
+    TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,Local_Pool.Base + (TEST_SMALL_BLOCKS * 16)) == N_OK);
+    TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,Local_Pool.Base - 16) == N_OK);
+    TEST_CHECK(Local_Pool.InUse == 69);
+    /*the only free block is the one given back*/
+    TEST_CHECK(Mem_pPoolAlloc(&Local_Pool) == Test_pBlocks[5]);
+    TEST_CHECK(Mem_pPoolAlloc(&Local_Pool) == NULL);
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_SMALL_BLOCKS; Local_uint32Itr++)
+    {
+        TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,Test_pBlocks[Local_uint32Itr]) == OK);
+    }
+    Local_Stats = Mem_PoolGetStats(&Local_Pool);
+    TEST_CHECK((Local_Stats.InUse == 0) && (Local_Stats.Peak == 70) && (Local_Stats.Failures == 2));
+    TEST_CHECK((Local_Pool.Summary == 0x7) && (Local_Pool.FreeMap[0] == 0xFFFFFFFFUL) && (Local_Pool.FreeMap[2] == 0x3F));
+
+    /*invalid sizes*/
+    TEST_CHECK(Mem_Std_ReturnTypePoolInit(&Local_Pool,&Local_Arena,0,10) == N_OK);
+    TEST_CHECK(Mem_Std_ReturnTypePoolInit(&Local_Pool,&Local_Arena,4,0) == N_OK);
+    TEST_CHECK(Mem_Std_ReturnTypePoolInit(&Local_Pool,&Local_Arena,4,MEM_POOL_MAX_BLOCKS + 1) == N_OK);
+    TEST_CHECK(Mem_pPoolAlloc(&Local_Pool) == NULL);
+
+    /*pool of 1024: full summary word , random sequence against a shadow map*/
+    TEST_CHECK(Mem_Std_ReturnTypePoolInit(&Local_Pool,&Local_Arena,4,MEM_POOL_MAX_BLOCKS) == OK);
+    TEST_CHECK(Local_Pool.Summary == 0xFFFFFFFFUL);
+    Test_VoidDrain(&Local_Pool);
+    for(Local_uint32Itr = 0; Local_uint32Itr < MEM_POOL_MAX_BLOCKS; Local_uint32Itr++)
+    {
+        TEST_CHECK(Mem_Std_ReturnTypePoolFree(&Local_Pool,Test_pBlocks[Local_uint32Itr]) == OK);
+        Test_uint8Taken[Local_uint32Itr] = 0;
+    }
+    srand(1);
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_RANDOM_STEPS; Local_uint32Itr++)
+    {
+        Local_uint32Index = (uint32)rand() % MEM_POOL_MAX_BLOCKS;
+        if(Test_uint8Taken[Local_uint32Index] != 0)
+        {
+            /*free a taken block: accepted once , refused the second time*/
+            if((Mem_Std_ReturnTypePoolFree(&Local_Pool,Local_Pool.Base + (Local_uint32Index * Local_Pool.BlockSize)) != OK) ||
+               (Mem_Std_ReturnTypePoolFree(&Local_Pool,Local_Pool.Base + (Local_uint32Index * Local_Pool.BlockSize)) != N_OK))
+            {
+                Local_uint32Mismatch++;
+            }
+            Test_uint8Taken[Local_uint32Index] = 0;
+            Local_uint32InUse--;
+        }
+        else if(Local_uint32InUse < MEM_POOL_MAX_BLOCKS)
+        {
+            /*allocate: must be a block the shadow map has free*/
+            Local_uint32Index = Test_uint32BlockIndex(&Local_Pool,Mem_pPoolAlloc(&Local_Pool));
+            if((Local_uint32Index == MEM_POOL_MAX_BLOCKS) || (Test_uint8Taken[Local_uint32Index] != 0))
+            {
+                Local_uint32Mismatch++;
+            }
+            else
+            {
+                Test_uint8Taken[Local_uint32Index] = 1;
+                Local_uint32InUse++;
+            }
+        }
+        if(Local_Pool.InUse != Local_uint32InUse)
+        {
+            Local_uint32Mismatch++;
+        }
+    }
+    printf("MEM_POOL: %lu random steps on %u blocks , %lu mismatches against the shadow map\n",
+           TEST_RANDOM_STEPS,MEM_POOL_MAX_BLOCKS,Local_uint32Mismatch);
+    TEST_CHECK(Local_uint32Mismatch == 0);
+    TEST_CHECK(Mem_PoolGetStats(&Local_Pool).Peak >= Local_uint32InUse);
+
+    /*cost of an alloc + free pair with the pool half full*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < MEM_POOL_MAX_BLOCKS; Local_uint32Itr++)
+    {
+        if(Test_uint8Taken[Local_uint32Itr] != 0)
+        {
+            (void)Mem_Std_ReturnTypePoolFree(&Local_Pool,Local_Pool.Base + (Local_uint32Itr * Local_Pool.BlockSize));
+        }
+    }
+    for(Local_uint32Itr = 0; Local_uint32Itr < (MEM_POOL_MAX_BLOCKS / 2); Local_uint32Itr++)
+    {
+        (void)Mem_pPoolAlloc(&Local_Pool);
+    }
+    Local_uint64Start = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_BENCH_LOOPS; Local_uint32Itr++)
+    {
+        (void)Mem_Std_ReturnTypePoolFree(&Local_Pool,Mem_pPoolAlloc(&Local_Pool));
+    }
+    Local_uint64Elapsed = Test_uint64NowNs() - Local_uint64Start;
+    TEST_CHECK(Local_Pool.InUse == (MEM_POOL_MAX_BLOCKS / 2));
+    printf("MEM_POOL: %lu ns per alloc + free (host)\n",(uint32)(Local_uint64Elapsed / TEST_BENCH_LOOPS));
+
+    /*bump: 100 bytes round up to 104 , allocations aligned and released back to a mark*/
+    TEST_CHECK(Mem_Std_ReturnTypeBumpInit(&Local_Bump,&Local_Arena,100) == OK);
+    TEST_CHECK(Local_Bump.Size == 104);
+    Local_pFirst = (uint8*)Mem_pBumpAlloc(&Local_Bump,10);
+    TEST_CHECK(Local_pFirst == Local_Bump.Base);
+    Local_uint32Mark = Mem_uint32BumpMark(&Local_Bump);
+    TEST_CHECK(Local_uint32Mark == 16);
+    Local_pSecond = (uint8*)Mem_pBumpAlloc(&Local_Bump,80);
+    TEST_CHECK(Local_pSecond == (Local_pFirst + 16));
+    TEST_CHECK(Mem_pBumpAlloc(&Local_Bump,16) == NULL);
+    TEST_CHECK(Mem_pBumpAlloc(&Local_Bump,0) == NULL);
+    Local_pThird = (uint8*)Mem_pBumpAlloc(&Local_Bump,8);
+    TEST_CHECK(Local_pThird == (Local_pFirst + 96));
+    TEST_CHECK(Mem_pBumpAlloc(&Local_Bump,1) == NULL);
+    /*a mark above the fill level is ignored*/
+    Mem_VoidBumpReset(&Local_Bump,Local_uint32Mark);
+    Mem_VoidBumpReset(&Local_Bump,64);
+    TEST_CHECK(Mem_uint32BumpMark(&Local_Bump) == Local_uint32Mark);
+    TEST_CHECK(Mem_pBumpAlloc(&Local_Bump,80) == Local_pSecond);
+    Local_Stats = Mem_BumpGetStats(&Local_Bump);
+    TEST_CHECK((Local_Stats.Capacity == 104) && (Local_Stats.InUse == 96) && (Local_Stats.Peak == 104) && (Local_Stats.Failures == 3));
+    Mem_VoidBumpReset(&Local_Bump,0);
+    TEST_CHECK(Mem_pBumpAlloc(&Local_Bump,104) == Local_pFirst);
+    TEST_CHECK(Mem_BumpGetStats(&Local_Bump).Peak == 104);
+    /*an arena that cannot hold the region*/
+    TEST_CHECK(Mem_Std_ReturnTypeBumpInit(&Local_Bump,&Local_Heap,8) == N_OK);
+    TEST_CHECK((Local_Bump.Size == 0) && (Mem_pBumpAlloc(&Local_Bump,8) == NULL));
+
+    printf("MEM_POOL: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
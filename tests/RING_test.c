@@ -0,0 +1,227 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  RING_test.c
+ *       Module:  Ring Buffer
+ *  Description:  pthread stress of the host (C11 builtins) branch of Atomic.h under Ring_Buffer.h (make -C tests).
+ *                SPSC : one producer thread and one consumer thread , every element must come out once and in order.
+ *                MPSC : TEST_PRODUCERS threads push numbered elements concurrently into one small ring , the consumer
+ *                       checks per producer that no number is missing (loss) , repeated (duplication) or out of
+ *                       order , and that no element was torn by a concurrent copy (check word).
+ *                the rings are small so every run wraps them many times and runs full and empty often.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#undef NULL
+
+#include "COTS/LIB/Ring_Buffer.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_CAPACITY               64UL
+#define TEST_SPSC_ELEMENTS          2000000UL
+#define TEST_PRODUCERS              4UL
+#define TEST_MPSC_ELEMENTS          500000UL        /*per producer*/
+#define TEST_CHECK_KEY              0x5A5AA5A5UL
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*several words so a copy interleaved with another producer's copy shows up in Check*/
+typedef struct
+{
+    uint32 Producer;
+    uint32 Number;
+    uint32 Check;
+}Test_Element_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static Ring_Buffer_t   Test_SpscRing;
+static Test_Element_t  Test_SpscStorage[TEST_CAPACITY];
+
+static Ring_Buffer_t   Test_MpscRing;
+static Test_Element_t  Test_MpscStorage[TEST_CAPACITY];
+static volatile uint32 Test_MpscSequence[TEST_CAPACITY];
+
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+static uint64 Test_uint64NowNs(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC,&Local_Time);
+    return ((uint64)Local_Time.tv_sec * 1000000000ULL) + (uint64)Local_Time.tv_nsec;
+}
+
+static void Test_VoidFill(Test_Element_t* Copy_pElement , uint32 Copy_uint32Producer , uint32 Copy_uint32Number)
+{
+    Copy_pElement->Producer = Copy_uint32Producer;
+    Copy_pElement->Number = Copy_uint32Number;
+    Copy_pElement->Check = Copy_uint32Producer ^ Copy_uint32Number ^ TEST_CHECK_KEY;
+}
+
+static void* Test_pSpscProducer(void* Copy_pArgument)
+{
+    Test_Element_t Local_Element;
+    uint32 Local_uint32Number;
+
+    for(Local_uint32Number = 0; Local_uint32Number < TEST_SPSC_ELEMENTS; Local_uint32Number++)
+    {
+        Test_VoidFill(&Local_Element,0,Local_uint32Number);
+        while(Ring_Std_ReturnTypeSpscPush(&Test_SpscRing,&Local_Element) != OK)
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void* Test_pMpscProducer(void* Copy_pArgument)
+{
+    uint32 Local_uint32Producer = (uint32)(unsigned long)Copy_pArgument;
+    Test_Element_t Local_Element;
+    uint32 Local_uint32Number;
+
+    for(Local_uint32Number = 0; Local_uint32Number < TEST_MPSC_ELEMENTS; Local_uint32Number++)
+    {
+        Test_VoidFill(&Local_Element,Local_uint32Producer,Local_uint32Number);
+        while(Ring_Std_ReturnTypeMpscPush(&Test_MpscRing,&Local_Element) != OK)
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    pthread_t Local_Thread[TEST_PRODUCERS];
+    Test_Element_t Local_Element;
+    uint32 Local_uint32Expected[TEST_PRODUCERS] = {0};
+    uint32 Local_uint32Received;
+    uint32 Local_uint32Lost = 0;
+    uint32 Local_uint32Repeated = 0;
+    uint32 Local_uint32Torn = 0;
+    uint32 Local_uint32Itr;
+    uint64 Local_uint64Start;
+    uint64 Local_uint64Elapsed;
+
+    /*SPSC: the only valid output is 0 , 1 , 2 ... in order*/
+    Ring_VoidInit(&Test_SpscRing,Test_SpscStorage,sizeof(Test_Element_t),TEST_CAPACITY,NULL);
+    Local_uint64Start = Test_uint64NowNs();
+    pthread_create(&Local_Thread[0],NULL,Test_pSpscProducer,NULL);
+    for(Local_uint32Received = 0; Local_uint32Received < TEST_SPSC_ELEMENTS; )
+    {
+        if(Ring_Std_ReturnTypeSpscPop(&Test_SpscRing,&Local_Element) != OK)
+        {
+            sched_yield();
+            continue;
+        }
+        if(Local_Element.Check != (Local_Element.Producer ^ Local_Element.Number ^ TEST_CHECK_KEY))
+        {
+            Local_uint32Torn++;
+        }
+        else if(Local_Element.Number > Local_uint32Expected[0])
+        {
+            Local_uint32Lost += Local_Element.Number - Local_uint32Expected[0];
+            Local_uint32Expected[0] = Local_Element.Number + 1;
+        }
+        else if(Local_Element.Number < Local_uint32Expected[0])
+        {
+            Local_uint32Repeated++;
+        }
+        else
+        {
+            Local_uint32Expected[0]++;
+        }
+        Local_uint32Received++;
+    }
+    pthread_join(Local_Thread[0],NULL);
+    Local_uint64Elapsed = Test_uint64NowNs() - Local_uint64Start;
+    printf("SPSC: %lu elements through %lu slots , lost %lu , repeated/reordered %lu , torn %lu , %lu ns/element\n",
+           TEST_SPSC_ELEMENTS,TEST_CAPACITY,Local_uint32Lost,Local_uint32Repeated,Local_uint32Torn,
+           (uint32)(Local_uint64Elapsed / TEST_SPSC_ELEMENTS));
+    TEST_CHECK(Local_uint32Lost == 0);
+    TEST_CHECK(Local_uint32Repeated == 0);
+    TEST_CHECK(Local_uint32Torn == 0);
+    TEST_CHECK(Local_uint32Expected[0] == TEST_SPSC_ELEMENTS);
+    TEST_CHECK(Ring_Std_ReturnTypeSpscPop(&Test_SpscRing,&Local_Element) == N_OK);
+    TEST_CHECK(Ring_uint32Count(&Test_SpscRing) == 0);
+
+    /*MPSC: producers interleave freely , each producer's own numbers must stay in order*/
+    Ring_VoidInit(&Test_MpscRing,Test_MpscStorage,sizeof(Test_Element_t),TEST_CAPACITY,Test_MpscSequence);
+    Local_uint32Expected[0] = 0;
+    Local_uint32Lost = 0;
+    Local_uint32Repeated = 0;
+    Local_uint32Torn = 0;
+    Local_uint64Start = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_PRODUCERS; Local_uint32Itr++)
+    {
+        pthread_create(&Local_Thread[Local_uint32Itr],NULL,Test_pMpscProducer,(void*)(unsigned long)Local_uint32Itr);
+    }
+    for(Local_uint32Received = 0; Local_uint32Received < (TEST_PRODUCERS * TEST_MPSC_ELEMENTS); )
+    {
+        if(Ring_Std_ReturnTypeMpscPop(&Test_MpscRing,&Local_Element) != OK)
+        {
+            sched_yield();
+            continue;
+        }
+        if((Local_Element.Producer >= TEST_PRODUCERS) ||
+           (Local_Element.Check != (Local_Element.Producer ^ Local_Element.Number ^ TEST_CHECK_KEY)))
+        {
+            Local_uint32Torn++;
+        }
+        else if(Local_Element.Number > Local_uint32Expected[Local_Element.Producer])
+        {
+            Local_uint32Lost += Local_Element.Number - Local_uint32Expected[Local_Element.Producer];
+            Local_uint32Expected[Local_Element.Producer] = Local_Element.Number + 1;
+        }
+        else if(Local_Element.Number < Local_uint32Expected[Local_Element.Producer])
+        {
+            Local_uint32Repeated++;
+        }
+        else
+        {
+            Local_uint32Expected[Local_Element.Producer]++;
+        }
+        Local_uint32Received++;
+    }
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_PRODUCERS; Local_uint32Itr++)
+    {
+        pthread_join(Local_Thread[Local_uint32Itr],NULL);
+        TEST_CHECK(Local_uint32Expected[Local_uint32Itr] == TEST_MPSC_ELEMENTS);
+    }
+    Local_uint64Elapsed = Test_uint64NowNs() - Local_uint64Start;
+    printf("MPSC: %lu producers x %lu elements through %lu slots , lost %lu , repeated/reordered %lu , torn %lu , %lu ns/element\n",
+           TEST_PRODUCERS,TEST_MPSC_ELEMENTS,TEST_CAPACITY,Local_uint32Lost,Local_uint32Repeated,Local_uint32Torn,
+           (uint32)(Local_uint64Elapsed / (TEST_PRODUCERS * TEST_MPSC_ELEMENTS)));
+    TEST_CHECK(Local_uint32Lost == 0);
+    TEST_CHECK(Local_uint32Repeated == 0);
+    TEST_CHECK(Local_uint32Torn == 0);
+    TEST_CHECK(Ring_Std_ReturnTypeMpscPop(&Test_MpscRing,&Local_Element) == N_OK);
+    TEST_CHECK(Ring_uint32Count(&Test_MpscRing) == 0);
+
+    printf("RING: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,317 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SCHED_test.c
+ *       Module:  SCHED Module
+ *  Description:  Linux build of the cooperative scheduler: behaviour checks and overhead benchmark (make -C tests).
+ *                31 tasks on priorities 0..30 (31 left empty) record every run and the events they got.
+ *                behaviour: most urgent first , events merged until the task runs , posts from a task to a more
+ *                           urgent one run next , invalid posts refused , run counts match SSCHED_Std_ReturnTypeGetStats.
+ *                threads  : poster threads play ISRs posting to their own task and to one shared task while the
+ *                           main thread dispatches , every post must lead to a run that carries its event (no lost
+ *                           wake up , no lost event bit).
+ *                overhead : host ns per post , per dispatch of an empty task and per post + dispatch pair.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#undef NULL
+
+#include "COTS/LIB/Std_Types.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_TASKS                  31U
+#define TEST_SHARED_TASK            30U
+#define TEST_POSTERS                4U
+#define TEST_POSTS                  200000UL        /*per poster thread*/
+#define TEST_WAIT_LOOPS             100000000UL
+#define TEST_BENCH_LOOPS            1000000UL
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*one task function per priority , all recording into the same tables*/
+#define TEST_TASK(PRIO)             static void Test_VoidTask##PRIO(uint32 Copy_uint32Events) { Test_VoidRun(PRIO,Copy_uint32Events); }
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static volatile uint32 Test_uint32Runs[TEST_TASKS];
+static volatile uint32 Test_uint32LastEvents[TEST_TASKS];
+/*runs of the shared task that carried the bit of each poster*/
+static volatile uint32 Test_uint32Delivered[TEST_POSTERS];
+static uint8 Test_uint8Order[1024];
+static uint32 Test_uint32OrderCount = 0;
+/*posts done by a task when it runs: (from , to) pairs*/
+static uint8 Test_uint8PostFrom = 0xFF;
+static uint8 Test_uint8PostTo[2];
+static volatile uint32 Test_uint32Done = 0;
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+Std_ReturnType SSCHED_Std_ReturnTypePostEvent(uint8 Copy_uint8Task , uint32 Copy_uint32Events);
+
+static void Test_VoidRun(uint8 Copy_uint8Priority , uint32 Copy_uint32Events)
+{
+    uint32 Local_uint32Itr;
+
+    Test_uint32Runs[Copy_uint8Priority]++;
+    Test_uint32LastEvents[Copy_uint8Priority] = Copy_uint32Events;
+    if(Test_uint32OrderCount < sizeof(Test_uint8Order))
+    {
+        Test_uint8Order[Test_uint32OrderCount++] = Copy_uint8Priority;
+    }
+    if(Copy_uint8Priority == TEST_SHARED_TASK)
+    {
+        for(Local_uint32Itr = 0; Local_uint32Itr < TEST_POSTERS; Local_uint32Itr++)
+        {
+            if((Copy_uint32Events & (1UL << Local_uint32Itr)) != 0)
+            {
+                Test_uint32Delivered[Local_uint32Itr]++;
+            }
+        }
+    }
+    if(Copy_uint8Priority == Test_uint8PostFrom)
+    {
+        SSCHED_Std_ReturnTypePostEvent(Test_uint8PostTo[0],1);
+        SSCHED_Std_ReturnTypePostEvent(Test_uint8PostTo[1],1);
+    }
+}
+
+TEST_TASK(0)  TEST_TASK(1)  TEST_TASK(2)  TEST_TASK(3)  TEST_TASK(4)  TEST_TASK(5)  TEST_TASK(6)  TEST_TASK(7)
+TEST_TASK(8)  TEST_TASK(9)  TEST_TASK(10) TEST_TASK(11) TEST_TASK(12) TEST_TASK(13) TEST_TASK(14) TEST_TASK(15)
+TEST_TASK(16) TEST_TASK(17) TEST_TASK(18) TEST_TASK(19) TEST_TASK(20) TEST_TASK(21) TEST_TASK(22) TEST_TASK(23)
+TEST_TASK(24) TEST_TASK(25) TEST_TASK(26) TEST_TASK(27) TEST_TASK(28) TEST_TASK(29) TEST_TASK(30)
+
+/*the table is listed in reverse: the priority , not the position , decides*/
+#define SCHED_TASKS  { SCHED_TASK(Test_VoidTask30,30) , SCHED_TASK(Test_VoidTask29,29) , SCHED_TASK(Test_VoidTask28,28) , \
+                       SCHED_TASK(Test_VoidTask27,27) , SCHED_TASK(Test_VoidTask26,26) , SCHED_TASK(Test_VoidTask25,25) , \
+                       SCHED_TASK(Test_VoidTask24,24) , SCHED_TASK(Test_VoidTask23,23) , SCHED_TASK(Test_VoidTask22,22) , \
+                       SCHED_TASK(Test_VoidTask21,21) , SCHED_TASK(Test_VoidTask20,20) , SCHED_TASK(Test_VoidTask19,19) , \
+                       SCHED_TASK(Test_VoidTask18,18) , SCHED_TASK(Test_VoidTask17,17) , SCHED_TASK(Test_VoidTask16,16) , \
+                       SCHED_TASK(Test_VoidTask15,15) , SCHED_TASK(Test_VoidTask14,14) , SCHED_TASK(Test_VoidTask13,13) , \
+                       SCHED_TASK(Test_VoidTask12,12) , SCHED_TASK(Test_VoidTask11,11) , SCHED_TASK(Test_VoidTask10,10) , \
+                       SCHED_TASK(Test_VoidTask9,9)   , SCHED_TASK(Test_VoidTask8,8)   , SCHED_TASK(Test_VoidTask7,7)   , \
+                       SCHED_TASK(Test_VoidTask6,6)   , SCHED_TASK(Test_VoidTask5,5)   , SCHED_TASK(Test_VoidTask4,4)   , \
+                       SCHED_TASK(Test_VoidTask3,3)   , SCHED_TASK(Test_VoidTask2,2)   , SCHED_TASK(Test_VoidTask1,1)   , \
+                       SCHED_TASK(Test_VoidTask0,0) }
+
+/*the scheduler is built with the table above*/
+#include "COTS/SERVICE/SCHED/SCHED_program.c"
+
+static uint64 Test_uint64NowNs(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC,&Local_Time);
+    return ((uint64)Local_Time.tv_sec * 1000000000ULL) + (uint64)Local_Time.tv_nsec;
+}
+
+/*time base of the CPU accounting: nanoseconds*/
+uint32 SSCHED_uint32HostTimestamp(void)
+{
+    return (uint32)Test_uint64NowNs();
+}
+
+/*an ISR stand in: post , then wait until a run of the task carried the event*/
+static void* Test_pPoster(void* Copy_pArgument)
+{
+    uint32 Local_uint32Poster = (uint32)(unsigned long)Copy_pArgument;
+    uint8 Local_uint8Task = (uint8)(Local_uint32Poster + 1);
+    uint32 Local_uint32Before;
+    uint32 Local_uint32Wait;
+    uint32 Local_uint32Post;
+    static uint32 Test_uint32Lost[TEST_POSTERS];
+
+    for(Local_uint32Post = 0; Local_uint32Post < TEST_POSTS; Local_uint32Post++)
+    {
+        if((Local_uint32Post & 1) == 0)
+        {
+            Local_uint32Before = Test_uint32Runs[Local_uint8Task];
+            SSCHED_Std_ReturnTypePostEvent(Local_uint8Task,1);
+            for(Local_uint32Wait = 0; (Test_uint32Runs[Local_uint8Task] == Local_uint32Before) && (Local_uint32Wait < TEST_WAIT_LOOPS); Local_uint32Wait++)
+            {
+                sched_yield();
+            }
+        }
+        else
+        {
+            Local_uint32Before = Test_uint32Delivered[Local_uint32Poster];
+            SSCHED_Std_ReturnTypePostEvent(TEST_SHARED_TASK,1UL << Local_uint32Poster);
+            for(Local_uint32Wait = 0; (Test_uint32Delivered[Local_uint32Poster] == Local_uint32Before) && (Local_uint32Wait < TEST_WAIT_LOOPS); Local_uint32Wait++)
+            {
+                sched_yield();
+            }
+        }
+        if(Local_uint32Wait == TEST_WAIT_LOOPS)
+        {
+            Test_uint32Lost[Local_uint32Poster]++;
+        }
+    }
+    Atomic_uint32FetchAdd(&Test_uint32Done,1);
+    return (void*)(unsigned long)Test_uint32Lost[Local_uint32Poster];
+}
+
+static void Test_VoidClearLog(void)
+{
+    Test_uint32OrderCount = 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    static const uint8 Local_uint8Shuffle[TEST_TASKS] = {17 , 3 , 30 , 8 , 0 , 22 , 11 , 29 , 5 , 14 , 26 , 1 , 19 , 9 , 24 ,
+                                                         6 , 28 , 13 , 2 , 21 , 16 , 27 , 7 , 10 , 25 , 4 , 18 , 12 , 23 , 15 , 20};
+    pthread_t Local_Thread[TEST_POSTERS];
+    SCHED_TaskStats_t Local_Stats = {0};
+    void* Local_pLost;
+    uint32 Local_uint32Lost = 0;
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32Dispatches = 0;
+    uint64 Local_uint64Ns;
+    uint64 Local_uint64PostNs;
+    uint64 Local_uint64DispatchNs;
+    uint64 Local_uint64PairNs;
+
+    TEST_CHECK(SSCHED_Std_ReturnTypeInit() == OK);
+    TEST_CHECK(SSCHED_uint8RunOnce() == 0);
+
+    /*invalid posts*/
+    TEST_CHECK(SSCHED_Std_ReturnTypePostEvent(31,1) == N_OK);
+    TEST_CHECK(SSCHED_Std_ReturnTypePostEvent(32,1) == N_OK);
+    TEST_CHECK(SSCHED_Std_ReturnTypePostEvent(5,0) == N_OK);
+    TEST_CHECK(SSCHED_uint8RunOnce() == 0);
+
+    /*most urgent first whatever the post order*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TASKS; Local_uint32Itr++)
+    {
+        TEST_CHECK(SSCHED_Std_ReturnTypePostEvent(Local_uint8Shuffle[Local_uint32Itr],1UL << Local_uint8Shuffle[Local_uint32Itr]) == OK);
+    }
+    SSCHED_VoidRun();
+    TEST_CHECK(Test_uint32OrderCount == TEST_TASKS);
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TASKS; Local_uint32Itr++)
+    {
+        TEST_CHECK(Test_uint8Order[Local_uint32Itr] == Local_uint32Itr);
+        TEST_CHECK(Test_uint32LastEvents[Local_uint32Itr] == (1UL << Local_uint32Itr));
+    }
+
+    /*events posted twice before the run are merged into one run*/
+    Test_VoidClearLog();
+    SSCHED_Std_ReturnTypePostEvent(7,0x1);
+    SSCHED_Std_ReturnTypePostEvent(7,0x4);
+    SSCHED_Std_ReturnTypePostEvent(7,0x1);
+    SSCHED_VoidRun();
+    TEST_CHECK(Test_uint32OrderCount == 1);
+    TEST_CHECK(Test_uint32LastEvents[7] == 0x5);
+
+    /*a task posting to a more urgent task: it runs before the less urgent ready ones*/
+    Test_VoidClearLog();
+    Test_uint8PostFrom = 20;
+    Test_uint8PostTo[0] = 5;
+    Test_uint8PostTo[1] = 25;
+    SSCHED_Std_ReturnTypePostEvent(30,1);
+    SSCHED_Std_ReturnTypePostEvent(20,1);
+    SSCHED_Std_ReturnTypePostEvent(10,1);
+    SSCHED_VoidRun();
+    Test_uint8PostFrom = 0xFF;
+    TEST_CHECK(Test_uint32OrderCount == 5);
+    TEST_CHECK((Test_uint8Order[0] == 10) && (Test_uint8Order[1] == 20) && (Test_uint8Order[2] == 5) &&
+               (Test_uint8Order[3] == 25) && (Test_uint8Order[4] == 30));
+
+    /*accounting follows the runs*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TASKS; Local_uint32Itr++)
+    {
+        TEST_CHECK(SSCHED_Std_ReturnTypeGetStats((uint8)Local_uint32Itr,&Local_Stats) == OK);
+        TEST_CHECK(Local_Stats.Runs == Test_uint32Runs[Local_uint32Itr]);
+    }
+    TEST_CHECK(SSCHED_Std_ReturnTypeGetStats(31,&Local_Stats) == N_OK);
+
+    /*threads: every post must be followed by a run carrying its event*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_POSTERS; Local_uint32Itr++)
+    {
+        Test_uint32Delivered[Local_uint32Itr] = 0;
+    }
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_POSTERS; Local_uint32Itr++)
+    {
+        pthread_create(&Local_Thread[Local_uint32Itr],NULL,Test_pPoster,(void*)(unsigned long)Local_uint32Itr);
+    }
+    Test_VoidClearLog();
+    Local_uint64Ns = Test_uint64NowNs();
+    for(;;)
+    {
+        if(SSCHED_uint8RunOnce() != 0)
+        {
+            Local_uint32Dispatches++;
+            continue;
+        }
+        /*idle: let the posters run , a poster is done once its last post was delivered*/
+        if(Test_uint32Done == TEST_POSTERS)
+        {
+            break;
+        }
+        sched_yield();
+    }
+    Local_uint64Ns = Test_uint64NowNs() - Local_uint64Ns;
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_POSTERS; Local_uint32Itr++)
+    {
+        pthread_join(Local_Thread[Local_uint32Itr],&Local_pLost);
+        Local_uint32Lost += (uint32)(unsigned long)Local_pLost;
+        TEST_CHECK(Test_uint32Delivered[Local_uint32Itr] == (TEST_POSTS / 2));
+    }
+    printf("threads: %u posters x %lu posts , %lu dispatches , %lu posts without a run , %llu ns per post\n",
+           TEST_POSTERS,TEST_POSTS,Local_uint32Dispatches,Local_uint32Lost,Local_uint64Ns / (TEST_POSTERS * TEST_POSTS));
+    TEST_CHECK(Local_uint32Lost == 0);
+
+    /*overhead of the scheduler alone: task 30 only counts (no log)*/
+    Test_uint32OrderCount = sizeof(Test_uint8Order);
+    Local_uint64Ns = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_BENCH_LOOPS; Local_uint32Itr++)
+    {
+        SSCHED_Std_ReturnTypePostEvent(TEST_SHARED_TASK,1UL << 8);
+    }
+    Local_uint64PostNs = Test_uint64NowNs() - Local_uint64Ns;
+    SSCHED_VoidRun();
+    Local_uint64Ns = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_BENCH_LOOPS; Local_uint32Itr++)
+    {
+        SSCHED_Std_ReturnTypePostEvent(TEST_SHARED_TASK,1UL << 8);
+        SSCHED_uint8RunOnce();
+    }
+    Local_uint64PairNs = Test_uint64NowNs() - Local_uint64Ns;
+    /*dispatch of a full ready mask , one task after the other*/
+    Local_uint64DispatchNs = 0;
+    for(Local_uint32Itr = 0; Local_uint32Itr < (TEST_BENCH_LOOPS / TEST_TASKS); Local_uint32Itr++)
+    {
+        for(Local_uint32Dispatches = 0; Local_uint32Dispatches < TEST_TASKS; Local_uint32Dispatches++)
+        {
+            SSCHED_Std_ReturnTypePostEvent((uint8)Local_uint32Dispatches,1UL << 8);
+        }
+        Local_uint64Ns = Test_uint64NowNs();
+        while(SSCHED_uint8RunOnce() != 0);
+        Local_uint64DispatchNs += Test_uint64NowNs() - Local_uint64Ns;
+    }
+    printf("overhead: post %llu ns , dispatch %llu ns (31 ready tasks , with CPU accounting) , post + dispatch %llu ns\n",
+           Local_uint64PostNs / TEST_BENCH_LOOPS,Local_uint64DispatchNs / ((TEST_BENCH_LOOPS / TEST_TASKS) * TEST_TASKS),
+           Local_uint64PairNs / TEST_BENCH_LOOPS);
+    TEST_CHECK(SSCHED_Std_ReturnTypeGetStats(TEST_SHARED_TASK,&Local_Stats) == OK);
+    printf("overhead: task %u ran %lu times , longest run %lu ns , average %llu ns (accounting time base)\n",
+           TEST_SHARED_TASK,Local_Stats.Runs,Local_Stats.MaxCycles,Local_Stats.TotalCycles / Local_Stats.Runs);
+    TEST_CHECK(Local_Stats.Runs == Test_uint32Runs[TEST_SHARED_TASK]);
+
+    printf("SCHED: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
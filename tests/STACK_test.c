@@ -0,0 +1,247 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  STACK_test.c
+ *       Module:  STACK Module
+ *  Description:  host test of the stack monitor (make -C tests). the .stack section of the linker script is played
+ *                by a block that the test defines between _S_stack and _stak_top , and a thread runs on it so the
+ *                main stack is painted from the running code as Rest_Handler does.
+ *                high-water: the main stack mark grows with a known call depth and keeps its peak after the
+ *                            return , a task stack reports the deepest word written.
+ *                guard     : an intact guard zone passes , a write into it (not above it) is reported for its region
+ *                            from the check and from the periodic SW_TIMER callback , every damaged region is reported.
+ *                register  : stacks no larger than the guard zone , NULL and a full table are refused.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <pthread.h>
+#undef NULL
+
+#include "COTS/SERVICE/STACK/STACK_interface.h"
+#include "COTS/SERVICE/SW_TIMER/SW_TIMER_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+/*main stack block in words , large enough for the thread that runs on it*/
+#define TEST_MAIN_WORDS             32768
+#define TEST_TASK_WORDS             128U
+/*calls of the deep path and the words each call writes on the stack*/
+#define TEST_DEPTH                  16U
+#define TEST_FRAME_WORDS            64U
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+#define TEST_STRING(X)              #X
+#define TEST_XSTRING(X)             TEST_STRING(X)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*the linker script symbols: _S_stack is the first word of the main stack , _stak_top the end of it*/
+__asm__
+(
+    ".bss                                       \n\t"
+    ".balign 64                                 \n\t"
+    ".globl _S_stack                            \n\t"
+    "_S_stack:                                  \n\t"
+    ".space " TEST_XSTRING(TEST_MAIN_WORDS) " * 8  \n\t"
+    ".globl _stak_top                           \n\t"
+    "_stak_top:                                 \n\t"
+    ".space 64                                  \n\t"
+    ".text                                      \n\t"
+);
+extern uint32 _S_stack;
+extern uint32 _stak_top;
+
+extern volatile uint8 SSTACK_uint8OverflowRegion;
+
+static uint32 Test_uint32TaskStack[STACK_MAX_REGIONS][TEST_TASK_WORDS];
+
+/*SW_TIMER stub: the periodic check timer*/
+static void (*Test_pTimerCallback)(void* Copy_pArg) = NULL;
+static uint32 Test_uint32TimerDelay = 0;
+static uint32 Test_uint32TimerPeriod = 0;
+
+/*overflow handler calls: count and regions in order*/
+static uint32 Test_uint32Overflows = 0;
+static uint8 Test_uint8OverflowRegion[STACK_MAX_REGIONS];
+
+/*main stack marks taken on the thread*/
+static uint32 Test_uint32MainSize = 0;
+static uint32 Test_uint32MainAfterPaint = 0;
+static uint32 Test_uint32MainDeep = 0;
+static uint32 Test_uint32MainAfterReturn = 0;
+static uint32 Test_uint32PaintedBelowSp = 0;
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+Std_ReturnType SSWTIMER_Std_ReturnTypeCreate(SW_TIMER_Handle_t* Copy_pHandle , void (*Copy_pCallback)(void* Copy_pArg) ,
+                                             void* Copy_pArg)
+{
+    Test_pTimerCallback = Copy_pCallback;
+    *Copy_pHandle = 0;
+    return OK;
+}
+
+Std_ReturnType SSWTIMER_Std_ReturnTypeStart(SW_TIMER_Handle_t Copy_Handle , uint32 Copy_uint32Delay , uint32 Copy_uint32Period)
+{
+    Test_uint32TimerDelay = Copy_uint32Delay;
+    Test_uint32TimerPeriod = Copy_uint32Period;
+    return OK;
+}
+
+static void Test_VoidOverflow(uint8 Copy_uint8Region)
+{
+    if(Test_uint32Overflows < STACK_MAX_REGIONS)
+    {
+        Test_uint8OverflowRegion[Test_uint32Overflows] = Copy_uint8Region;
+    }
+    Test_uint32Overflows++;
+}
+
+/*every call writes TEST_FRAME_WORDS words of its own frame*/
+static __attribute__((noinline)) uint32 Test_uint32Deep(uint32 Copy_uint32Depth)
+{
+    volatile uint32 Local_uint32Frame[TEST_FRAME_WORDS];
+    uint32 Local_uint32Itr;
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_FRAME_WORDS; Local_uint32Itr++)
+    {
+        Local_uint32Frame[Local_uint32Itr] = Local_uint32Itr;
+    }
+    if(Copy_uint32Depth > 1)
+    {
+        return Test_uint32Deep(Copy_uint32Depth - 1) + Local_uint32Frame[1];
+    }
+    return Local_uint32Frame[1];
+}
+
+/*runs on the main stack block like the code after Rest_Handler*/
+static void* Test_pMainStack(void* Copy_pArg)
+{
+    uint32 Local_uint32Sp = (uint32)&Local_uint32Sp;
+    const uint32* Local_pWord = &_S_stack;
+
+    SSTACK_VoidPaintMainStack();
+    SSTACK_VoidInit();
+    Test_uint32MainSize = SSTACK_uint32GetSize(0);
+    Test_uint32MainAfterPaint = SSTACK_uint32GetHighWater(0);
+    while(*Local_pWord == STACK_PAINT_PATTERN)
+    {
+        Local_pWord++;
+    }
+    /*painted up to a few words under the caller's frame , nothing above*/
+    Test_uint32PaintedBelowSp = (uint32)(((uint32*)Local_uint32Sp) - Local_pWord);
+    (void)Test_uint32Deep(TEST_DEPTH);
+    Test_uint32MainDeep = SSTACK_uint32GetHighWater(0);
+    (void)Test_uint32Deep(1);
+    Test_uint32MainAfterReturn = SSTACK_uint32GetHighWater(0);
+    return NULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    pthread_t Local_Thread;
+    pthread_attr_t Local_Attributes;
+    uint8 Local_uint8Region;
+    uint8 Local_uint8Second;
+    uint32 Local_uint32Itr;
+
+    /*main stack: region 0 , painted from the thread that runs on it*/
+    pthread_attr_init(&Local_Attributes);
+    pthread_attr_setstack(&Local_Attributes,&_S_stack,(size_t)((char*)&_stak_top - (char*)&_S_stack));
+    TEST_CHECK(pthread_create(&Local_Thread,&Local_Attributes,Test_pMainStack,NULL) == 0);
+    pthread_join(Local_Thread,NULL);
+    printf("STACK: main stack %lu words , used %lu after paint , %lu at depth %u , %lu after return (words)\n",
+           (uint32)TEST_MAIN_WORDS,Test_uint32MainAfterPaint / 4,Test_uint32MainDeep / 4,TEST_DEPTH,
+           Test_uint32MainAfterReturn / 4);
+    TEST_CHECK(Test_uint32MainSize == (TEST_MAIN_WORDS * 4));
+    TEST_CHECK(Test_uint32PaintedBelowSp > 0);
+    TEST_CHECK(Test_uint32PaintedBelowSp <= 64);
+    TEST_CHECK(Test_uint32MainAfterPaint > 0);
+    TEST_CHECK(Test_uint32MainAfterPaint < Test_uint32MainSize);
+    TEST_CHECK(Test_uint32MainDeep >= Test_uint32MainAfterPaint + (TEST_DEPTH * TEST_FRAME_WORDS * 4));
+    TEST_CHECK(Test_uint32MainAfterReturn == Test_uint32MainDeep);
+    TEST_CHECK(Test_pTimerCallback != NULL);
+    TEST_CHECK((Test_uint32TimerDelay == STACK_CHECK_PERIOD_TICKS) && (Test_uint32TimerPeriod == STACK_CHECK_PERIOD_TICKS));
+    /*the main stack guard is intact*/
+    TEST_CHECK(SSTACK_Std_ReturnTypeCheck() == OK);
+
+    /*task stack: nothing used after the paint , then the deepest word written counts*/
+    SSTACK_VoidPaint(Test_uint32TaskStack[0],TEST_TASK_WORDS);
+    TEST_CHECK(SSTACK_Std_ReturnTypeRegister(Test_uint32TaskStack[0],TEST_TASK_WORDS,&Local_uint8Region) == OK);
+    TEST_CHECK(Local_uint8Region == 1);
+    TEST_CHECK(SSTACK_uint32GetSize(Local_uint8Region) == (TEST_TASK_WORDS * 4));
+    TEST_CHECK(SSTACK_uint32GetHighWater(Local_uint8Region) == 0);
+    Test_uint32TaskStack[0][TEST_TASK_WORDS - 1] = 0;
+    TEST_CHECK(SSTACK_uint32GetHighWater(Local_uint8Region) == 4);
+    Test_uint32TaskStack[0][100] = 0;
+    TEST_CHECK(SSTACK_uint32GetHighWater(Local_uint8Region) == ((TEST_TASK_WORDS - 100) * 4));
+    /*a write above the mark does not lower it*/
+    Test_uint32TaskStack[0][110] = 0;
+    TEST_CHECK(SSTACK_uint32GetHighWater(Local_uint8Region) == ((TEST_TASK_WORDS - 100) * 4));
+    Test_uint32TaskStack[0][0] = 0;
+    TEST_CHECK(SSTACK_uint32GetHighWater(Local_uint8Region) == (TEST_TASK_WORDS * 4));
+    TEST_CHECK(SSTACK_uint32GetHighWater(STACK_MAX_REGIONS) == 0);
+    TEST_CHECK(SSTACK_uint32GetSize(STACK_MAX_REGIONS) == 0);
+
+    /*register: refused arguments leave the table as it is*/
+    TEST_CHECK(SSTACK_Std_ReturnTypeRegister(Test_uint32TaskStack[1],STACK_GUARD_BYTES / 4,&Local_uint8Second) == N_OK);
+    TEST_CHECK(Local_uint8Second == STACK_INVALID_REGION);
+    TEST_CHECK(SSTACK_Std_ReturnTypeRegister(NULL,TEST_TASK_WORDS,&Local_uint8Second) == N_OK);
+    TEST_CHECK(Local_uint8Second == STACK_INVALID_REGION);
+    TEST_CHECK(SSTACK_uint32GetSize(2) == 0);
+
+    /*guard: only a write inside the lowest STACK_GUARD_BYTES is an overflow*/
+    SSTACK_VoidSetOverflowHandler(Test_VoidOverflow);
+    SSTACK_VoidPaint(Test_uint32TaskStack[0],TEST_TASK_WORDS);
+    Test_uint32TaskStack[0][STACK_GUARD_BYTES / 4] = 0;
+    TEST_CHECK(SSTACK_Std_ReturnTypeCheck() == OK);
+    TEST_CHECK(Test_uint32Overflows == 0);
+    TEST_CHECK(SSTACK_uint8OverflowRegion == STACK_INVALID_REGION);
+    Test_uint32TaskStack[0][(STACK_GUARD_BYTES / 4) - 1] = 0;
+    TEST_CHECK(SSTACK_Std_ReturnTypeCheck() == N_OK);
+    TEST_CHECK((Test_uint32Overflows == 1) && (Test_uint8OverflowRegion[0] == Local_uint8Region));
+    TEST_CHECK(SSTACK_uint8OverflowRegion == Local_uint8Region);
+    /*the periodic check reports it too*/
+    Test_pTimerCallback(NULL);
+    TEST_CHECK((Test_uint32Overflows == 2) && (Test_uint8OverflowRegion[1] == Local_uint8Region));
+
+    /*full table: every damaged region is reported , in order*/
+    for(Local_uint32Itr = 1; Local_uint32Itr < (STACK_MAX_REGIONS - 1); Local_uint32Itr++)
+    {
+        SSTACK_VoidPaint(Test_uint32TaskStack[Local_uint32Itr],TEST_TASK_WORDS);
+        TEST_CHECK(SSTACK_Std_ReturnTypeRegister(Test_uint32TaskStack[Local_uint32Itr],TEST_TASK_WORDS,&Local_uint8Second) == OK);
+        TEST_CHECK(Local_uint8Second == (Local_uint32Itr + 1));
+    }
+    TEST_CHECK(SSTACK_Std_ReturnTypeRegister(Test_uint32TaskStack[STACK_MAX_REGIONS - 1],TEST_TASK_WORDS,&Local_uint8Second) == N_OK);
+    TEST_CHECK(Local_uint8Second == STACK_INVALID_REGION);
+    Test_uint32Overflows = 0;
+    Test_uint32TaskStack[STACK_MAX_REGIONS - 2][0] = 0;
+    TEST_CHECK(SSTACK_Std_ReturnTypeCheck() == N_OK);
+    TEST_CHECK(Test_uint32Overflows == 2);
+    TEST_CHECK((Test_uint8OverflowRegion[0] == Local_uint8Region) && (Test_uint8OverflowRegion[1] == (STACK_MAX_REGIONS - 1)));
+    TEST_CHECK(SSTACK_uint8OverflowRegion == (STACK_MAX_REGIONS - 1));
+    /*repaired: the check passes again*/
+    SSTACK_VoidPaint(Test_uint32TaskStack[0],TEST_TASK_WORDS);
+    SSTACK_VoidPaint(Test_uint32TaskStack[STACK_MAX_REGIONS - 2],TEST_TASK_WORDS);
+    Test_uint32Overflows = 0;
+    TEST_CHECK(SSTACK_Std_ReturnTypeCheck() == OK);
+    TEST_CHECK(Test_uint32Overflows == 0);
+
+    printf("STACK: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
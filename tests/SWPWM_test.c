@@ -0,0 +1,326 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SWPWM_test.c
+ *       Module:  SWPWM Module
+ *  Description:  host test of the edge schedule builder (make -C tests) in the 8 , 24 and 72 MHZ clock modes.
+ *                every schedule is replayed on a simulated port for one period and checked:
+ *                intervals sum to the period , no interval is shorter than the edge gap , no BSRR write both
+ *                sets and resets a pin , the high time of every channel is its duty within one gap and the
+ *                ISR count per period never exceeds channels + 1.
+ *                clock change: the gap follows HCLK , a running engine stops before the switch and restarts after
+ *                it with the last committed duties.
+ *                the ISR count per period and the resulting CPU load (SWPWM_ISR_CYCLES per ISR) are reported.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#undef NULL
+
+#include "COTS/HAL/SWPWM/SWPWM_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_RANDOM_SCHEDULES       200000UL
+/*GPIOA..GPIOE: the start of a period writes BSRR*/
+#define TEST_GPIO_PAGE              0x40010000UL
+#define TEST_GPIO_PAGE_SIZE         0x2000UL
+#define TEST_MODES                  3
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static const GPIO_PinNum Test_ChannelPins[SWPWM_NUM_CHANNELS] = SWPWM_CHANNEL_PINS;
+static uint32 Test_uint32Failures = 0;
+static uint32 Test_uint32Seed = 0x12345678UL;
+/*schedules per ISR count (index = edge groups per period)*/
+static uint32 Test_uint32IsrHistogram[SWPWM_NUM_CHANNELS + 2];
+/*live HCLK , edge gap of the mode under test , calls of the timer stubs*/
+static uint32 Test_uint32Hclk = 8000000UL;
+static uint16 Test_uint16Gap;
+static uint32 Test_uint32Starts = 0;
+static uint32 Test_uint32Stops = 0;
+static uint32 Test_uint32TickHz = 0;
+static void (*Test_pClockCallback)(uint8 Copy_uint8Event) = NULL;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*the builder has no hardware access , the driver calls of the module are stubbed*/
+Std_ReturnType MRCC_Std_ReturnTypeGetClock(uint8 Copy_uint8BusId , uint8 Copy_uint8PeripheralId , uint8 Copy_uint8Client)
+{
+    return OK;
+}
+Std_ReturnType MRCC_Std_ReturnTypeRegisterClockCallback(void (*Copy_pCallback)(uint8 Copy_uint8Event))
+{
+    Test_pClockCallback = Copy_pCallback;
+    return OK;
+}
+uint32 MRCC_u32GetHclk(void)
+{
+    return Test_uint32Hclk;
+}
+Std_ReturnType MTIM_Std_ReturnTypeSetTickHz(TIM_Num_t Copy_uint8Timer , uint32 Copy_uint32TickHz)
+{
+    Test_uint32TickHz = Copy_uint32TickHz;
+    return OK;
+}
+void MGPIO_VoidSetPinMode_TYPE(GPIO_Num Copy_u8Port , GPIO_PinNum Copy_u8Pin , GPIO_PinModeType Copy_u8Mode){}
+void MGPIO_VoidSetPinValue(GPIO_Num Copy_uint8Port , GPIO_PinNum Copy_uint8Pin ,GPIO_PinLevel  Copy_uint8Value){}
+void MTIM_VoidInit(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Prescaler){}
+void MTIM_VoidSetPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period){}
+void MTIM_VoidLoadPeriod(TIM_Num_t Copy_uint8Timer , uint16 Copy_uint16Period){}
+void MTIM_VoidStart(TIM_Num_t Copy_uint8Timer)
+{
+    Test_uint32Starts++;
+}
+void MTIM_VoidStop(TIM_Num_t Copy_uint8Timer)
+{
+    Test_uint32Stops++;
+}
+void MTIM_VoidSetUpdateCallback(TIM_Num_t Copy_uint8Timer , void (*callback)(void)){}
+
+static uint32 Test_uint32Random(void)
+{
+    Test_uint32Seed ^= (Test_uint32Seed << 13) & 0xFFFFFFFFUL;
+    Test_uint32Seed ^= Test_uint32Seed >> 17;
+    Test_uint32Seed ^= (Test_uint32Seed << 5) & 0xFFFFFFFFUL;
+    return Test_uint32Seed;
+}
+
+static void Test_VoidFail(const uint16 Copy_uint16Duty[] , const char* Copy_pMessage)
+{
+    uint8 Local_uint8Itr;
+    Test_uint32Failures++;
+    printf("FAIL %s duties:",Copy_pMessage);
+    for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+    {
+        printf(" %u",Copy_uint16Duty[Local_uint8Itr]);
+    }
+    printf("\n");
+}
+
+/*duty the output is expected to have: near 0% / 100% snaps to a constant level*/
+static uint32 Test_uint32EffectiveDuty(uint16 Copy_uint16Duty)
+{
+    if(Copy_uint16Duty < Test_uint16Gap)
+    {
+        return 0;
+    }
+    if(Copy_uint16Duty > (SWPWM_PERIOD_TICKS - Test_uint16Gap))
+    {
+        return SWPWM_PERIOD_TICKS;
+    }
+    return Copy_uint16Duty;
+}
+
+/*build , replay one period on a simulated ODR and check the schedule , returns the ISR count*/
+static uint8 Test_uint8Check(const uint16 Copy_uint16Duty[])
+{
+    SWPWM_Schedule_t Local_Schedule;
+    uint32 Local_uint32High[SWPWM_NUM_CHANNELS] = {0};
+    uint32 Local_uint32Odr = 0;
+    uint32 Local_uint32Time = 0;
+    uint8  Local_uint8Edge;
+    uint8  Local_uint8Itr;
+
+    HSWPWM_VoidBuildSchedule(Copy_uint16Duty,&Local_Schedule);
+
+    if((Local_Schedule.EdgeCount < 1) || (Local_Schedule.EdgeCount > (SWPWM_NUM_CHANNELS + 1)))
+    {
+        Test_VoidFail(Copy_uint16Duty,"edge count");
+        return Local_Schedule.EdgeCount;
+    }
+    for(Local_uint8Edge = 0; Local_uint8Edge < Local_Schedule.EdgeCount; Local_uint8Edge++)
+    {
+        uint32 Local_uint32Mask = Local_Schedule.BsrrMask[Local_uint8Edge];
+        uint16 Local_uint16Delta = Local_Schedule.Delta[Local_uint8Edge];
+
+        if(((Local_uint32Mask & 0xFFFFUL) & (Local_uint32Mask >> 16)) != 0)
+        {
+            Test_VoidFail(Copy_uint16Duty,"BSRR sets and resets one pin");
+        }
+        if(Local_uint16Delta < Test_uint16Gap)
+        {
+            Test_VoidFail(Copy_uint16Duty,"interval shorter than the minimum gap");
+        }
+        /*BSRR: set bits win over reset bits of the same pin , none expected here*/
+        Local_uint32Odr &= ~(Local_uint32Mask >> 16);
+        Local_uint32Odr |= (Local_uint32Mask & 0xFFFFUL);
+        for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+        {
+            if(READ_BIT(Local_uint32Odr,Test_ChannelPins[Local_uint8Itr]))
+            {
+                Local_uint32High[Local_uint8Itr] += Local_uint16Delta;
+            }
+        }
+        Local_uint32Time += Local_uint16Delta;
+    }
+    if(Local_uint32Time != SWPWM_PERIOD_TICKS)
+    {
+        Test_VoidFail(Copy_uint16Duty,"intervals do not sum to the period");
+    }
+    for(Local_uint8Itr = 0; Local_uint8Itr < SWPWM_NUM_CHANNELS; Local_uint8Itr++)
+    {
+        uint32 Local_uint32Expected = Test_uint32EffectiveDuty(Copy_uint16Duty[Local_uint8Itr]);
+        /*a merged falling edge is pulled earlier by less than one gap , never later*/
+        if((Local_uint32High[Local_uint8Itr] > Local_uint32Expected) ||
+           ((Local_uint32Expected - Local_uint32High[Local_uint8Itr]) >= Test_uint16Gap))
+        {
+            Test_VoidFail(Copy_uint16Duty,"high time differs from duty");
+        }
+    }
+    Test_uint32IsrHistogram[Local_Schedule.EdgeCount]++;
+    return Local_Schedule.EdgeCount;
+}
+
+static void Test_VoidReport(const char* Copy_pName , const uint16 Copy_uint16Duty[])
+{
+    uint8 Local_uint8Isrs = Test_uint8Check(Copy_uint16Duty);
+    /*load = ISRs * cycles per ISR / HCLK cycles per period*/
+    uint32 Local_uint32PeriodCycles = (uint32)(((uint64)SWPWM_PERIOD_TICKS * Test_uint32Hclk) / SWPWM_TICK_HZ);
+    printf("  %-28s %u ISR/period  load %lu.%02lu%%\n",Copy_pName,Local_uint8Isrs,
+           (Local_uint8Isrs * SWPWM_ISR_CYCLES * 100UL) / Local_uint32PeriodCycles,
+           ((Local_uint8Isrs * SWPWM_ISR_CYCLES * 10000UL) / Local_uint32PeriodCycles) % 100UL);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    static const uint32 Local_uint32Modes[TEST_MODES] = {8000000UL , 24000000UL , 72000000UL};
+    uint16 Local_uint16Duty[SWPWM_NUM_CHANNELS];
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32Total = 0;
+    uint32 Local_uint32Mode;
+    uint8  Local_uint8Channel;
+
+    if(mmap((void*)TEST_GPIO_PAGE,TEST_GPIO_PAGE_SIZE,PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED,-1,0) != (void*)TEST_GPIO_PAGE)
+    {
+        printf("SWPWM: cannot map the GPIO page\n");
+        return 1;
+    }
+    HSWPWM_VoidInit();
+    TEST_CHECK((Test_pClockCallback != NULL) && (Test_uint32TickHz == SWPWM_TICK_HZ));
+
+    for(Local_uint32Mode = 0; Local_uint32Mode < TEST_MODES; Local_uint32Mode++)
+    {
+        if(Local_uint32Mode != 0)
+        {
+            /*running engine with committed duties: stopped before the switch , restarted after it*/
+            for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+            {
+                HSWPWM_VoidSetDuty(Local_uint8Channel,((Local_uint8Channel + 1) * SWPWM_PERIOD_TICKS) / (SWPWM_NUM_CHANNELS + 1));
+            }
+            TEST_CHECK(HSWPWM_Std_ReturnTypeCommit() == OK);
+            HSWPWM_VoidStart();
+            Test_uint32Starts = 0;
+            Test_uint32Stops = 0;
+            Test_pClockCallback(RCC_CLOCK_PRE_CHANGE);
+            TEST_CHECK((Test_uint32Stops == 1) && (Test_uint32Starts == 0));
+            Test_uint32Hclk = Local_uint32Modes[Local_uint32Mode];
+            Test_pClockCallback(RCC_CLOCK_POST_CHANGE);
+            TEST_CHECK(Test_uint32Starts == 1);
+            /*the pending commit became the running schedule (the next mode commits again): one ISR per channel
+              plus the period start*/
+            TEST_CHECK(HSWPWM_uint8GetEdgeCount() == (SWPWM_NUM_CHANNELS + 1));
+            HSWPWM_VoidStop();
+        }
+        Test_uint16Gap = HSWPWM_uint16GetMinEdgeGap();
+        TEST_CHECK(Test_uint16Gap == ((SWPWM_ISR_CYCLES * SWPWM_TICK_HZ) + Test_uint32Hclk - 1UL) / Test_uint32Hclk);
+        printf("SWPWM: %lu MHZ , %u channels , period %u ticks , ISR %u cycles , %lu HCLK cycles/tick , min edge gap %u ticks\n",
+               Test_uint32Hclk / 1000000UL,SWPWM_NUM_CHANNELS,SWPWM_PERIOD_TICKS,SWPWM_ISR_CYCLES,
+               Test_uint32Hclk / SWPWM_TICK_HZ,Test_uint16Gap);
+
+        /*corner cases: constant levels , shared duties , edges one tick around the gap limits*/
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++) Local_uint16Duty[Local_uint8Channel] = 0;
+        Test_VoidReport("all 0%",Local_uint16Duty);
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++) Local_uint16Duty[Local_uint8Channel] = SWPWM_PERIOD_TICKS;
+        Test_VoidReport("all 100%",Local_uint16Duty);
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++) Local_uint16Duty[Local_uint8Channel] = SWPWM_PERIOD_TICKS / 2;
+        Test_VoidReport("all 50%",Local_uint16Duty);
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+        {
+            Local_uint16Duty[Local_uint8Channel] = ((Local_uint8Channel + 1) * SWPWM_PERIOD_TICKS) / (SWPWM_NUM_CHANNELS + 1);
+        }
+        Test_VoidReport("spread duties",Local_uint16Duty);
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+        {
+            Local_uint16Duty[Local_uint8Channel] = (SWPWM_PERIOD_TICKS / 2) + Local_uint8Channel * (Test_uint16Gap - 1);
+        }
+        Test_VoidReport("edges inside one gap",Local_uint16Duty);
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+        {
+            Local_uint16Duty[Local_uint8Channel] = (Local_uint8Channel & 1) ? (Test_uint16Gap - 1) : (SWPWM_PERIOD_TICKS - Test_uint16Gap + 1);
+        }
+        Test_VoidReport("snap to 0% / 100%",Local_uint16Duty);
+        for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+        {
+            Local_uint16Duty[Local_uint8Channel] = (Local_uint8Channel & 1) ? Test_uint16Gap : (SWPWM_PERIOD_TICKS - Test_uint16Gap);
+        }
+        Test_VoidReport("at the gap limits",Local_uint16Duty);
+
+        /*random duties , a quarter of them clustered to exercise the merging*/
+        for(Local_uint32Itr = 0; Local_uint32Itr < TEST_RANDOM_SCHEDULES; Local_uint32Itr++)
+        {
+            uint16 Local_uint16Base = Test_uint32Random() % (SWPWM_PERIOD_TICKS + 1);
+            for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+            {
+                if((Local_uint32Itr & 3) == 0)
+                {
+                    uint32 Local_uint32Duty = Local_uint16Base + (Test_uint32Random() % (2 * Test_uint16Gap));
+                    Local_uint16Duty[Local_uint8Channel] = (Local_uint32Duty > SWPWM_PERIOD_TICKS) ? SWPWM_PERIOD_TICKS : Local_uint32Duty;
+                }
+                else
+                {
+                    Local_uint16Duty[Local_uint8Channel] = Test_uint32Random() % (SWPWM_PERIOD_TICKS + 1);
+                }
+            }
+            (void)Test_uint8Check(Local_uint16Duty);
+        }
+
+        printf("  ISR/period over all schedules:");
+        Local_uint32Total = 0;
+        for(Local_uint8Channel = 1; Local_uint8Channel <= (SWPWM_NUM_CHANNELS + 1); Local_uint8Channel++)
+        {
+            Local_uint32Total += Test_uint32IsrHistogram[Local_uint8Channel];
+        }
+        for(Local_uint8Channel = 1; Local_uint8Channel <= (SWPWM_NUM_CHANNELS + 1); Local_uint8Channel++)
+        {
+            printf(" %u:%lu.%lu%%",Local_uint8Channel,(Test_uint32IsrHistogram[Local_uint8Channel] * 100UL) / Local_uint32Total,
+                   ((Test_uint32IsrHistogram[Local_uint8Channel] * 1000UL) / Local_uint32Total) % 10UL);
+            Test_uint32IsrHistogram[Local_uint8Channel] = 0;
+        }
+        printf("\n");
+    }
+
+    /*back to 8 MHZ: edges 1 tick apart need their own ISR at 72 MHZ , the schedule of the slower core merges them*/
+    for(Local_uint8Channel = 0; Local_uint8Channel < SWPWM_NUM_CHANNELS; Local_uint8Channel++)
+    {
+        HSWPWM_VoidSetDuty(Local_uint8Channel,(SWPWM_PERIOD_TICKS / 2) + (Local_uint8Channel * 3));
+    }
+    TEST_CHECK(HSWPWM_Std_ReturnTypeCommit() == OK);
+    HSWPWM_VoidStart();
+    Test_pClockCallback(RCC_CLOCK_PRE_CHANGE);
+    Test_uint32Hclk = Local_uint32Modes[0];
+    Test_pClockCallback(RCC_CLOCK_POST_CHANGE);
+    TEST_CHECK((HSWPWM_uint16GetMinEdgeGap() == 12) && (HSWPWM_uint8GetEdgeCount() == 2));
+    HSWPWM_VoidStop();
+
+    printf("SWPWM: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,305 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SW_TIMER_test.c
+ *       Module:  SW_TIMER Module
+ *  Description:  host test and benchmark of the timer wheel with SW_TIMER_POOL_SIZE 10000 (make -C tests).
+ *                the SysTick callback and the DPC level are played by the test: every tick calls the service
+ *                tick hook and runs the posted DPC item , every callback records the tick it ran at.
+ *                stepped : 10000 one shot and periodic timers , delays 0..5000 , stepped tick by tick ,
+ *                          a tenth of them stopped or restarted on the way.
+ *                tickless: 10000 timers up to 4 times the wheel range (2^24) , time advanced by
+ *                          SSWTIMER_uint32GetIdleTicks jumps only , as the idle loop does.
+ *                every timer must run exactly at its expiry tick , the right number of times.
+ *                reports host time per start , per stop , per tick with 10000 armed timers and per expiry.
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <time.h>
+#undef NULL
+
+#include "COTS/SERVICE/SW_TIMER/SW_TIMER_interface.h"
+#include "COTS/SERVICE/DPC/DPC_interface.h"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_TIMERS                 SW_TIMER_POOL_SIZE
+#define TEST_STEPPED_RANGE          5000UL
+#define TEST_STEPPED_PERIODS        4UL
+#define TEST_TICKLESS_RANGE         (4ULL * SW_TIMER_RANGE)
+#define TEST_TICKLESS_PERIODS       3UL
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA TYPES AND STRUCTURES
+---------------------------------------------------------------------------------------------------------------------*/
+/*expected and observed runs of one timer*/
+typedef struct
+{
+    SW_TIMER_Handle_t Handle;
+    uint64 Expected;                    /*tick of the next run , 0: must not run*/
+    uint32 Period;
+    uint32 Runs;
+    uint32 ExpectedRuns;
+    uint32 WrongTick;
+}Test_Timer_t;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+static Test_Timer_t Test_Timers[TEST_TIMERS];
+static uint64 Test_uint64Now = 0;
+static uint32 Test_uint32Seed = 12345;
+static void (*Test_pTickHook)(void) = NULL;
+static DPC_Item_t* Test_pItem = NULL;
+static uint8 Test_uint8Posted = 0;
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*SysTick and DPC are played by the test*/
+uint64 MSYSTICK_uint64GetTickCount(void)
+{
+    return Test_uint64Now;
+}
+void MSYSTICK_VoidSetCallBack(void (*Copy_pCallBack)(void))
+{
+    Test_pTickHook = Copy_pCallBack;
+}
+void MSYSTICK_VoidSleepTicks(uint32 Copy_uint32Ticks){}
+void SDPC_VoidInitItem(DPC_Item_t* Copy_pItem , void (*Copy_pFunction)(void* Copy_pArg) , void* Copy_pArg)
+{
+    Copy_pItem->Function = Copy_pFunction;
+    Copy_pItem->Arg = Copy_pArg;
+    Test_pItem = Copy_pItem;
+}
+Std_ReturnType SDPC_Std_ReturnTypePost(uint8 Copy_uint8Level , DPC_Item_t* Copy_pItem)
+{
+    Test_uint8Posted = 1;
+    return OK;
+}
+
+static uint32 Test_uint32Random(void)
+{
+    Test_uint32Seed = (Test_uint32Seed * 1103515245UL + 12345UL) & 0x7FFFFFFFUL;
+    return Test_uint32Seed;
+}
+
+static uint64 Test_uint64NowNs(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC,&Local_Time);
+    return ((uint64)Local_Time.tv_sec * 1000000000ULL) + (uint64)Local_Time.tv_nsec;
+}
+
+/*one SysTick interrupt at the current tick , then the DPC level it posted*/
+static void Test_VoidTick(void)
+{
+    Test_pTickHook();
+    if(Test_uint8Posted == 1)
+    {
+        Test_uint8Posted = 0;
+        Test_pItem->Function(Test_pItem->Arg);
+    }
+}
+
+static void Test_VoidCallback(void* Copy_pArg)
+{
+    Test_Timer_t* Local_pTimer = (Test_Timer_t*)Copy_pArg;
+
+    if(Test_uint64Now != Local_pTimer->Expected)
+    {
+        if(Local_pTimer->WrongTick++ == 0)
+        {
+            printf("timer %u ran at %llu , expected %llu\n",Local_pTimer->Handle,Test_uint64Now,Local_pTimer->Expected);
+        }
+    }
+    Local_pTimer->Runs++;
+    Local_pTimer->Expected = (Local_pTimer->Period != 0) ? (Test_uint64Now + Local_pTimer->Period) : 0;
+    if(Local_pTimer->Runs == Local_pTimer->ExpectedRuns)
+    {
+        /*the callback may stop its own timer*/
+        SSWTIMER_Std_ReturnTypeStop(Local_pTimer->Handle);
+        Local_pTimer->Expected = 0;
+    }
+}
+
+/*arm a timer and set what it must do: delay 0 runs on the next tick*/
+static void Test_VoidArm(Test_Timer_t* Copy_pTimer , uint64 Copy_uint64Delay , uint32 Copy_uint32Period , uint32 Copy_uint32Runs)
+{
+    Copy_pTimer->Expected = Test_uint64Now + ((Copy_uint64Delay == 0) ? 1 : Copy_uint64Delay);
+    Copy_pTimer->Period = Copy_uint32Period;
+    Copy_pTimer->Runs = 0;
+    Copy_pTimer->ExpectedRuns = Copy_uint32Runs;
+    Copy_pTimer->WrongTick = 0;
+    TEST_CHECK(SSWTIMER_Std_ReturnTypeStart(Copy_pTimer->Handle,(uint32)Copy_uint64Delay,Copy_uint32Period) == OK);
+}
+
+/*every timer ran the expected number of times at the expected ticks and the wheel is empty*/
+static void Test_VoidVerify(const char* Copy_pName)
+{
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32Wrong = 0;
+    uint32 Local_uint32Missing = 0;
+    uint32 Local_uint32Runs = 0;
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr++)
+    {
+        Local_uint32Wrong += Test_Timers[Local_uint32Itr].WrongTick;
+        Local_uint32Runs += Test_Timers[Local_uint32Itr].Runs;
+        if(Test_Timers[Local_uint32Itr].Runs != Test_Timers[Local_uint32Itr].ExpectedRuns)
+        {
+            if(Local_uint32Missing++ == 0)
+            {
+                printf("timer %lu ran %lu times , expected %lu\n",Local_uint32Itr,
+                       Test_Timers[Local_uint32Itr].Runs,Test_Timers[Local_uint32Itr].ExpectedRuns);
+            }
+        }
+    }
+    printf("%s: %lu timers , %lu runs , %lu at a wrong tick , %lu with a wrong run count , final tick %llu\n",
+           Copy_pName,(uint32)TEST_TIMERS,Local_uint32Runs,Local_uint32Wrong,Local_uint32Missing,Test_uint64Now);
+    TEST_CHECK(Local_uint32Wrong == 0);
+    TEST_CHECK(Local_uint32Missing == 0);
+    TEST_CHECK(SSWTIMER_uint32GetIdleTicks() == 0xFFFFFFFFUL);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    SW_TIMER_Handle_t Local_Handle;
+    uint32 Local_uint32Itr;
+    uint32 Local_uint32Idle;
+    uint32 Local_uint32Ticks = 0;
+    uint32 Local_uint32Jumps = 0;
+    uint32 Local_uint32Runs = 0;
+    uint64 Local_uint64Start;
+    uint64 Local_uint64StartNs;
+    uint64 Local_uint64StopNs;
+    uint64 Local_uint64TickNs;
+    uint64 Local_uint64Ns;
+
+    Test_uint64Now = 1000;
+    SSWTIMER_VoidInit();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr++)
+    {
+        TEST_CHECK(SSWTIMER_Std_ReturnTypeCreate(&Test_Timers[Local_uint32Itr].Handle,Test_VoidCallback,&Test_Timers[Local_uint32Itr]) == OK);
+    }
+    /*pool exhausted , invalid handles*/
+    TEST_CHECK(SSWTIMER_Std_ReturnTypeCreate(&Local_Handle,Test_VoidCallback,NULL) == N_OK);
+    TEST_CHECK(Local_Handle == SW_TIMER_INVALID_HANDLE);
+    TEST_CHECK(SSWTIMER_Std_ReturnTypeStart(SW_TIMER_INVALID_HANDLE,1,0) == N_OK);
+    TEST_CHECK(SSWTIMER_uint32GetIdleTicks() == 0xFFFFFFFFUL);
+
+    /*stepped: a quarter periodic , every tick runs the wheel*/
+    Local_uint64Ns = Test_uint64NowNs();
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr++)
+    {
+        if((Local_uint32Itr & 3) == 0)
+        {
+            Test_VoidArm(&Test_Timers[Local_uint32Itr],Test_uint32Random() % TEST_STEPPED_RANGE,
+                         1 + (Test_uint32Random() % (TEST_STEPPED_RANGE / TEST_STEPPED_PERIODS)),TEST_STEPPED_PERIODS);
+        }
+        else
+        {
+            Test_VoidArm(&Test_Timers[Local_uint32Itr],Test_uint32Random() % TEST_STEPPED_RANGE,0,1);
+        }
+    }
+    Local_uint64StartNs = Test_uint64NowNs() - Local_uint64Ns;
+    Local_uint64Start = Test_uint64Now;
+    Local_uint64TickNs = 0;
+    Local_uint64StopNs = 0;
+    while(SSWTIMER_uint32GetIdleTicks() != 0xFFFFFFFFUL)
+    {
+        Test_uint64Now++;
+        Local_uint32Ticks++;
+        Local_uint64Ns = Test_uint64NowNs();
+        Test_VoidTick();
+        Local_uint64TickNs += Test_uint64NowNs() - Local_uint64Ns;
+        if(Test_uint64Now == (Local_uint64Start + (TEST_STEPPED_RANGE / 2)))
+        {
+            /*half way: every tenth timer still armed is stopped or restarted*/
+            Local_uint64Ns = Test_uint64NowNs();
+            for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr += 10)
+            {
+                if(SSWTIMER_uint8IsActive(Test_Timers[Local_uint32Itr].Handle) == 0)
+                {
+                    continue;
+                }
+                if((Local_uint32Itr & 1) == 0)
+                {
+                    TEST_CHECK(SSWTIMER_Std_ReturnTypeStop(Test_Timers[Local_uint32Itr].Handle) == OK);
+                    Test_Timers[Local_uint32Itr].ExpectedRuns = Test_Timers[Local_uint32Itr].Runs;
+                    Test_Timers[Local_uint32Itr].Expected = 0;
+                }
+                else
+                {
+                    Test_VoidArm(&Test_Timers[Local_uint32Itr],Test_uint32Random() % TEST_STEPPED_RANGE,0,1);
+                }
+            }
+            Local_uint64StopNs = Test_uint64NowNs() - Local_uint64Ns;
+        }
+    }
+    Test_VoidVerify("stepped");
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr++)
+    {
+        Local_uint32Runs += Test_Timers[Local_uint32Itr].Runs;
+    }
+    printf("stepped: start %llu ns , stop/restart of %lu timers %llu ns , tick %llu ns average over %lu ticks\n",
+           Local_uint64StartNs / TEST_TIMERS,(uint32)(TEST_TIMERS / 10),Local_uint64StopNs,
+           Local_uint64TickNs / Local_uint32Ticks,Local_uint32Ticks);
+    printf("stepped: %llu ns per expiry (tick time / runs)\n",Local_uint64TickNs / Local_uint32Runs);
+
+    /*tickless: only jumps to the next wheel event , most timers cascade several levels*/
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr++)
+    {
+        if((Local_uint32Itr % 5) == 0)
+        {
+            Test_VoidArm(&Test_Timers[Local_uint32Itr],(Test_uint32Random() * 4ULL) % TEST_TICKLESS_RANGE,
+                         1 + (Test_uint32Random() % SW_TIMER_RANGE),TEST_TICKLESS_PERIODS);
+        }
+        else
+        {
+            Test_VoidArm(&Test_Timers[Local_uint32Itr],(Test_uint32Random() * 4ULL) % TEST_TICKLESS_RANGE,0,1);
+        }
+    }
+    Local_uint64Ns = Test_uint64NowNs();
+    for(;;)
+    {
+        Local_uint32Idle = SSWTIMER_uint32GetIdleTicks();
+        if(Local_uint32Idle == 0xFFFFFFFFUL)
+        {
+            break;
+        }
+        /*the sleep ends on the tick the wheel asked for (0: work is due on the next tick)*/
+        Test_uint64Now += (Local_uint32Idle == 0) ? 1 : Local_uint32Idle;
+        Local_uint32Jumps++;
+        Test_VoidTick();
+    }
+    Local_uint64Ns = Test_uint64NowNs() - Local_uint64Ns;
+    Test_VoidVerify("tickless");
+    printf("tickless: %lu wakeups over %llu ticks , %llu ns per wakeup\n",
+           Local_uint32Jumps,Test_uint64Now - Local_uint64Start,Local_uint64Ns / Local_uint32Jumps);
+
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_TIMERS; Local_uint32Itr++)
+    {
+        TEST_CHECK(SSWTIMER_Std_ReturnTypeDelete(Test_Timers[Local_uint32Itr].Handle) == OK);
+    }
+    TEST_CHECK(SSWTIMER_Std_ReturnTypeDelete(Test_Timers[0].Handle) == N_OK);
+    TEST_CHECK(SSWTIMER_Std_ReturnTypeCreate(&Local_Handle,Test_VoidCallback,NULL) == OK);
+
+    printf("SW_TIMER: %s (%lu failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,291 @@
+/*********************************************************************************/
+/* Author    : Hossam Ahmed                                                     */
+/* Version   : V01                                                               */
+/* Date      : 19 OCT 2026                                                       */
+/*********************************************************************************/
+/*---------------------------------------------------------------------------------------------------------------------
+ *  *  FILE DESCRIPTION
+ *  --------------------
+ *         File:  SYSTICK_test.c
+ *       Module:  SYSTICK Module
+ *  Description:  host test of the timebase readers against a model of the SysTick counter (make -C tests).
+ *                the register page (0xE000E000) is mapped at its target address and a periodic signal plays the
+ *                hardware: every signal is one step of the counter , the reload clock or the SysTick interrupt ,
+ *                and lands on any instruction of the reader like the real interrupt does.
+ *                directed cases: 32-bit carry of the tick count , VAL==0 and VAL==LOAD with PENDSTSET set.
+ *                stress: the reader runs through the carry of the low word a thousand times (hi/lo/hi retry) ,
+ *                half of the runs with SysTick masked so reloads stay pending (PENDSTSET path) , and every
+ *                MSYSTICK_uint64GetTimeUs value must be monotonic and inside the model time around the call ,
+ *                every MSYSTICK_uint64GetTickCount value inside the epoch (a torn high/low pair is 2^32 ms off).
+---------------------------------------------------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  INCLUDES
+---------------------------------------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#undef NULL
+
+/*target word sizes: uint32 is 32 bits as on the Cortex-M3 , so the tick count carries where it carries on target*/
+#define STD_TYPES_H
+typedef unsigned char         uint8;
+typedef unsigned short        uint16;
+typedef unsigned int          uint32;
+typedef signed char           sint8;
+typedef signed short          sint16;
+typedef signed int            sint32;
+typedef unsigned long long    uint64;
+typedef signed long long      sint64;
+typedef enum
+{
+    N_OK,
+    OK,
+}Std_ReturnType;
+#define NULL                    ((void*)0)
+
+/*the statics of the driver are set up directly*/
+#include "COTS/MCAL/SYSTick/SYSTick_program.c"
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL MACROS
+---------------------------------------------------------------------------------------------------------------------*/
+#define TEST_HCLK                   72000000UL
+#define TEST_REGISTER_PAGE          0xE000E000UL
+#define TEST_REGISTER_PAGE_SIZE     0x1000UL
+/*counter clocks per signal: about 10 steps per millisecond plus the reload and interrupt signals*/
+#define TEST_STEP_CYCLES            7001U
+#define TEST_SIGNAL_PERIOD_US       20
+#define TEST_EPOCHS                 1000U
+/*every epoch starts this many ticks before the carry of the low word and runs TEST_EPOCH_TICKS ticks*/
+#define TEST_TICKS_BEFORE_CARRY     1U
+#define TEST_EPOCH_TICKS            3U
+/*reads per masked / unmasked phase of the masked epochs*/
+#define TEST_MASK_PHASE_READS       2048U
+
+#define TEST_CHECK(COND)            do{ if(!(COND)) { printf("FAIL line %d: %s\n",__LINE__,#COND); Test_uint32Failures++; } }while(0)
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL DATA
+---------------------------------------------------------------------------------------------------------------------*/
+/*model time: counter clocks since the epoch started on a tick boundary*/
+static volatile uint64 Test_uint64Cycles = 0;
+static uint64 Test_uint64BaseUs = 0;
+/*SysTick masked by the reader: the model pends the interrupt but does not take it*/
+static volatile uint8 Test_uint8Masked = 0;
+static volatile uint32 Test_uint32Signals = 0;
+static volatile uint32 Test_uint32Interrupts = 0;
+static sint32 Test_sint32AppliedException = -1;
+static uint32 Test_uint32Failures = 0;
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  LOCAL FUNCTIONS
+---------------------------------------------------------------------------------------------------------------------*/
+/*the driver runs against the register model , its other dependencies are stubbed*/
+uint32 MRCC_u32GetHclk(void)
+{
+    return TEST_HCLK;
+}
+Std_ReturnType MRCC_Std_ReturnTypeRegisterClockCallback(void (*Copy_pCallback)(uint8 Copy_uint8Event))
+{
+    return OK;
+}
+void MNVIC_VoidApplySystemPriority(NVIC_SystemException_t Copy_Exception)
+{
+    Test_sint32AppliedException = (sint32)Copy_Exception;
+}
+
+/*one signal = one event of the counter: the reload after VAL hit 0 , the pending interrupt being taken , or up to
+  TEST_STEP_CYCLES clocks stopping on the 1 -> 0 transition that pends the interrupt*/
+static void Test_VoidHardware(int Copy_intSignal)
+{
+    uint32 Local_uint32Itr;
+    uint8 Local_uint8Pending = ((*SCB_ICSR & SCB_ICSR_PENDSTSET) != 0) ? 1 : 0;
+
+    Test_uint32Signals++;
+    if((Local_uint8Pending == 1) && (*STK_VAL == 0))
+    {
+        *STK_VAL = *STK_LOAD;
+        Test_uint64Cycles++;
+        return;
+    }
+    if((Local_uint8Pending == 1) && (Test_uint8Masked == 0))
+    {
+        *SCB_ICSR &= ~SCB_ICSR_PENDSTSET;
+        Test_uint32Interrupts++;
+        SysTick_Handler();
+        return;
+    }
+    for(Local_uint32Itr = 0; Local_uint32Itr < TEST_STEP_CYCLES; Local_uint32Itr++)
+    {
+        if(*STK_VAL == 0)
+        {
+            /*VAL cleared by a write: reloads without pending*/
+            *STK_VAL = *STK_LOAD;
+        }
+        else if((*STK_VAL == 1) && (Local_uint8Pending == 1))
+        {
+            /*masked for a whole tick: the model waits here , a second reload would lose a tick (documented)*/
+            break;
+        }
+        else if(--(*STK_VAL) == 0)
+        {
+            *SCB_ICSR |= SCB_ICSR_PENDSTSET;
+            Test_uint64Cycles++;
+            break;
+        }
+        Test_uint64Cycles++;
+    }
+}
+
+static uint64 Test_uint64ModelUs(void)
+{
+    return Test_uint64BaseUs + ((Test_uint64Cycles * 1000ULL) / (TEST_HCLK / SYSTICK_TIMEBASE_HZ));
+}
+
+static void Test_VoidBlock(int Copy_intHow)
+{
+    sigset_t Local_Set;
+    sigemptyset(&Local_Set);
+    sigaddset(&Local_Set,SIGALRM);
+    sigprocmask(Copy_intHow,&Local_Set,NULL);
+}
+
+/*start of an epoch: tick count set , counter at the start of a tick , nothing pending (signals blocked)*/
+static void Test_VoidSetTicks(uint32 Copy_uint32High , uint32 Copy_uint32Low)
+{
+    SysTick_uint32TickCountHigh = Copy_uint32High;
+    SysTick_uint32TickCount = Copy_uint32Low;
+    *STK_VAL = *STK_LOAD;
+    *SCB_ICSR = 0;
+    Test_uint64Cycles = 0;
+    Test_uint64BaseUs = ((((uint64)Copy_uint32High) << 32) | Copy_uint32Low) * 1000ULL;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------
+ *  GLOBAL FUNCTION IMPLEMENTION
+---------------------------------------------------------------------------------------------------------------------*/
+int main(void)
+{
+    struct sigaction Local_Action = {0};
+    struct itimerval Local_Timer = {0};
+    uint64 Local_uint64Before;
+    uint64 Local_uint64After;
+    uint64 Local_uint64Time;
+    uint64 Local_uint64Previous;
+    uint64 Local_uint64End;
+    uint64 Local_uint64Ticks;
+    uint32 Local_uint32Epoch;
+    uint32 Local_uint32Reads;
+    uint32 Local_uint32Backward = 0;
+    uint32 Local_uint32Outside = 0;
+    uint32 Local_uint32Torn = 0;
+    uint32 Local_uint32TotalReads = 0;
+
+    if(mmap((void*)TEST_REGISTER_PAGE,TEST_REGISTER_PAGE_SIZE,PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED,-1,0) == MAP_FAILED)
+    {
+        printf("SYSTICK: cannot map the register page\n");
+        return 1;
+    }
+
+    /*stopped timebase: no time , no expiry*/
+    TEST_CHECK(MSYSTICK_uint64GetTimeUs() == 0);
+    TEST_CHECK(MSYSTICK_uint8TimeoutExpired(0,1) == 0);
+
+    /*start: 1 ms reload from HCLK , priority from the NVIC table*/
+    MSYSTICK_VoidStartTimebase();
+    TEST_CHECK(*STK_LOAD == ((TEST_HCLK / SYSTICK_TIMEBASE_HZ) - 1UL));
+    TEST_CHECK(STK_CTRL->B.ENABLE == 1);
+    TEST_CHECK(STK_CTRL->B.TICKINT == 1);
+    TEST_CHECK(Test_sint32AppliedException == (sint32)NVIC_EXC_SYSTICK);
+
+    /*32-bit carry of the tick count into the high word*/
+    Test_VoidSetTicks(3,0xFFFFFFFFU);
+    TEST_CHECK(MSYSTICK_uint64GetTickCount() == ((3ULL << 32) | 0xFFFFFFFFULL));
+    SysTick_Handler();
+    TEST_CHECK(MSYSTICK_uint64GetTickCount() == (4ULL << 32));
+    TEST_CHECK(MSYSTICK_uint32GetTickCount() == 0);
+
+    /*1 -> 0 transition: interrupt pending , VAL still 0 , tick not counted yet*/
+    Test_VoidSetTicks(0,1000);
+    *STK_VAL = 0;
+    *SCB_ICSR = SCB_ICSR_PENDSTSET;
+    TEST_CHECK(MSYSTICK_uint64GetTimeUs() == 1001000ULL);
+    /*reloaded , interrupt not taken yet*/
+    *STK_VAL = *STK_LOAD;
+    TEST_CHECK(MSYSTICK_uint64GetTimeUs() == 1001000ULL);
+    /*interrupt taken*/
+    *SCB_ICSR = 0;
+    SysTick_Handler();
+    TEST_CHECK(MSYSTICK_uint64GetTimeUs() == 1001000ULL);
+    /*half a tick later*/
+    *STK_VAL = *STK_LOAD / 2;
+    TEST_CHECK(MSYSTICK_uint64GetTimeUs() == 1001500ULL);
+
+    /*stress: the model interrupts the reader at random instructions*/
+    Test_VoidBlock(SIG_BLOCK);
+    Local_Action.sa_handler = Test_VoidHardware;
+    Local_Action.sa_flags = SA_RESTART;
+    sigaction(SIGALRM,&Local_Action,NULL);
+    Local_Timer.it_interval.tv_usec = TEST_SIGNAL_PERIOD_US;
+    Local_Timer.it_value.tv_usec = TEST_SIGNAL_PERIOD_US;
+    setitimer(ITIMER_REAL,&Local_Timer,NULL);
+
+    for(Local_uint32Epoch = 0; Local_uint32Epoch < TEST_EPOCHS; Local_uint32Epoch++)
+    {
+        Test_VoidSetTicks(Local_uint32Epoch,0xFFFFFFFFU - TEST_TICKS_BEFORE_CARRY);
+        Local_uint64End = MSYSTICK_uint64GetTickCount() + TEST_EPOCH_TICKS;
+        Local_uint64Previous = 0;
+        Local_uint32Reads = 0;
+        Test_VoidBlock(SIG_UNBLOCK);
+        while(MSYSTICK_uint64GetTickCount() < Local_uint64End)
+        {
+            /*odd epochs: SysTick masked in every other phase , reloads wait in PENDSTSET*/
+            Test_uint8Masked = (uint8)((Local_uint32Epoch & 1U) & ((Local_uint32Reads / TEST_MASK_PHASE_READS) & 1U));
+            Local_uint64Before = Test_uint64ModelUs();
+            Local_uint64Time = MSYSTICK_uint64GetTimeUs();
+            Local_uint64After = Test_uint64ModelUs();
+            if(Local_uint64Time < Local_uint64Previous)
+            {
+                Local_uint32Backward++;
+            }
+            /*a reader on the 1 -> 0 transition already counts the tick: one cycle (< 1 us) early*/
+            if((Local_uint64Time < Local_uint64Before) || (Local_uint64Time > (Local_uint64After + 1)))
+            {
+                if(Local_uint32Outside++ == 0)
+                {
+                    printf("first outside: %llu not in [%llu , %llu]\n",Local_uint64Time,Local_uint64Before,Local_uint64After);
+                }
+            }
+            Local_uint64Previous = Local_uint64Time;
+            /*the tick count alone: a torn high/low pair is 2^32 ms off*/
+            Local_uint64Before = Test_uint64BaseUs / 1000ULL;
+            Local_uint64Ticks = MSYSTICK_uint64GetTickCount();
+            if((Local_uint64Ticks < Local_uint64Before) || (Local_uint64Ticks > (Local_uint64Before + TEST_EPOCH_TICKS + 1)))
+            {
+                Local_uint32Torn++;
+            }
+            Local_uint32Reads++;
+        }
+        Test_VoidBlock(SIG_BLOCK);
+        Test_uint8Masked = 0;
+        Local_uint32TotalReads += Local_uint32Reads;
+    }
+    Local_Timer.it_interval.tv_usec = 0;
+    Local_Timer.it_value.tv_usec = 0;
+    setitimer(ITIMER_REAL,&Local_Timer,NULL);
+
+    printf("SYSTICK: %u epochs across the 32-bit carry , %u reads , %u model signals , %u interrupts\n",
+           TEST_EPOCHS,Local_uint32TotalReads,Test_uint32Signals,Test_uint32Interrupts);
+    printf("SYSTICK: %u reads stepped back , %u reads outside the model time , %u torn tick counts\n",
+           Local_uint32Backward,Local_uint32Outside,Local_uint32Torn);
+    TEST_CHECK(Local_uint32Backward == 0);
+    TEST_CHECK(Local_uint32Outside == 0);
+    TEST_CHECK(Local_uint32Torn == 0);
+    TEST_CHECK(Test_uint32Interrupts >= (TEST_EPOCHS * TEST_EPOCH_TICKS));
+
+    printf("SYSTICK: %s (%u failures)\n",(Test_uint32Failures == 0) ? "PASS" : "FAIL",Test_uint32Failures);
+    return (Test_uint32Failures == 0) ? 0 : 1;
+}